@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <Reaktoro/Common/BlockDiagonalChemicalVector.hpp>
 #include <Reaktoro/Common/ChemicalScalar.hpp>
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/Constants.hpp>
@@ -0,0 +1,93 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "BlockDiagonalChemicalVector.hpp"
+
+namespace Reaktoro {
+
+BlockDiagonalChemicalVector::BlockDiagonalChemicalVector()
+{}
+
+BlockDiagonalChemicalVector::BlockDiagonalChemicalVector(const Indices& sizes)
+{
+    resize(sizes);
+}
+
+auto BlockDiagonalChemicalVector::resize(const Indices& sizes) -> void
+{
+    ddn.resize(sizes);
+    val = zeros(ddn.rows());
+    ddT = zeros(ddn.rows());
+    ddP = zeros(ddn.rows());
+}
+
+auto BlockDiagonalChemicalVector::size() const -> Index
+{
+    return val.size();
+}
+
+auto BlockDiagonalChemicalVector::block(Index irow, Index nrows) -> ChemicalVectorRef
+{
+    return {val.segment(irow, nrows), ddT.segment(irow, nrows), ddP.segment(irow, nrows), ddn.block(irow, nrows)};
+}
+
+auto BlockDiagonalChemicalVector::block(Index irow, Index nrows) const -> ChemicalVectorConstRef
+{
+    return {val.segment(irow, nrows), ddT.segment(irow, nrows), ddP.segment(irow, nrows), ddn.block(irow, nrows)};
+}
+
+auto BlockDiagonalChemicalVector::operator[](Index irow) const -> ChemicalScalar
+{
+    return {val[irow], ddT[irow], ddP[irow], ddn.row(irow)};
+}
+
+auto BlockDiagonalChemicalVector::dense() const -> ChemicalVector
+{
+    return {val, ddT, ddP, ddn.dense()};
+}
+
+BlockDiagonalChemicalVector::operator ChemicalVector() const
+{
+    return dense();
+}
+
+auto rows(const BlockDiagonalChemicalVector& vec, Index irow, Index nrows) -> ChemicalVector
+{
+    Indices irows(nrows);
+    for(Index i = 0; i < nrows; ++i)
+        irows[i] = irow + i;
+    return rows(vec, irows);
+}
+
+auto rows(const BlockDiagonalChemicalVector& vec, const Indices& irows) -> ChemicalVector
+{
+    ChemicalVector res(irows.size(), vec.size());
+    for(Index i = 0; i < irows.size(); ++i)
+    {
+        const Index irow = irows[i];
+        const Index iblock = vec.ddn.indexBlockWithRow(irow);
+        const Index offset = vec.ddn.blockOffset(iblock);
+        const Index size = vec.ddn.blockSize(iblock);
+        res.val[i] = vec.val[irow];
+        res.ddT[i] = vec.ddT[irow];
+        res.ddP[i] = vec.ddP[irow];
+        res.ddn.row(i).segment(offset, size) = vec.ddn.block(iblock).row(irow - offset);
+    }
+    return res;
+}
+
+} // namespace Reaktoro
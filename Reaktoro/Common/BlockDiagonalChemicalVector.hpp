@@ -0,0 +1,88 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/ChemicalScalar.hpp>
+#include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Common/ThermoVector.hpp>
+#include <Reaktoro/Math/BlockDiagonalMatrix.hpp>
+
+namespace Reaktoro {
+
+/// A type that represents a vector of chemical properties of species with block-diagonal molar derivatives.
+/// The molar derivatives of a property of a species are zero with respect to the amounts of species in
+/// other phases. A BlockDiagonalChemicalVector exploits this by storing only the diagonal blocks of the
+/// matrix of molar derivatives, one block per phase. A dense ChemicalVector is assembled only on demand.
+/// @see ChemicalVector, BlockDiagonalMatrix
+class BlockDiagonalChemicalVector
+{
+public:
+    /// The vector of chemical scalars
+    Vector val;
+
+    /// The vector of partial temperature derivatives of the chemical scalars
+    Vector ddT;
+
+    /// The vector of partial pressure derivatives of the chemical scalars
+    Vector ddP;
+
+    /// The block-diagonal matrix of partial mole derivatives of the chemical scalars
+    BlockDiagonalMatrix ddn;
+
+    /// Construct a default BlockDiagonalChemicalVector instance.
+    BlockDiagonalChemicalVector();
+
+    /// Construct a BlockDiagonalChemicalVector instance with given number of species in each block.
+    /// @param sizes The number of species in each block (e.g., in each phase).
+    explicit BlockDiagonalChemicalVector(const Indices& sizes);
+
+    /// Resize this BlockDiagonalChemicalVector instance with given number of species in each block.
+    /// @param sizes The number of species in each block (e.g., in each phase).
+    auto resize(const Indices& sizes) -> void;
+
+    /// Return the number of rows of this BlockDiagonalChemicalVector instance.
+    auto size() const -> Index;
+
+    /// Return a mutable view of the chemical properties of a range of species in a single block.
+    /// @param irow The index of the first species in the range.
+    /// @param nrows The number of species in the range.
+    auto block(Index irow, Index nrows) -> ChemicalVectorRef;
+
+    /// Return a constant view of the chemical properties of a range of species in a single block.
+    /// @param irow The index of the first species in the range.
+    /// @param nrows The number of species in the range.
+    auto block(Index irow, Index nrows) const -> ChemicalVectorConstRef;
+
+    /// Return a ChemicalScalar with the chemical property of a species and its dense molar derivatives.
+    auto operator[](Index irow) const -> ChemicalScalar;
+
+    /// Return a dense ChemicalVector with the chemical properties of all species.
+    auto dense() const -> ChemicalVector;
+
+    /// Convert this BlockDiagonalChemicalVector instance into a dense ChemicalVector instance.
+    operator ChemicalVector() const;
+};
+
+/// Return a dense ChemicalVector with the chemical properties of a range of species.
+auto rows(const BlockDiagonalChemicalVector& vec, Index irow, Index nrows) -> ChemicalVector;
+
+/// Return a dense ChemicalVector with the chemical properties of given species.
+auto rows(const BlockDiagonalChemicalVector& vec, const Indices& irows) -> ChemicalVector;
+
+} // namespace Reaktoro
@@ -40,6 +40,17 @@ using ChemicalScalarRef = ChemicalScalarBase<double&, Eigen::Ref<RowVector, 0, E
 /// A type that represents a chemical property and its derivatives.
 using ChemicalScalarConstRef = ChemicalScalarBase<const double&, Eigen::Ref<const RowVector, 0, Eigen::InnerStride<Eigen::Dynamic>>>;
 
+/// A type that represents a chemical property and its derivatives for a fixed number of species.
+/// The partial mole derivatives are stored inline, so that operations on ChemicalScalarFixed
+/// instances need no memory allocation and have their loops over the species unrolled by the
+/// compiler. Use `Eigen::Dynamic` as the number of species to store a variable number of species,
+/// up to a given maximum, also inline.
+/// @tparam NumSpecies The number of species in the chemical system
+/// @tparam MaxSpecies The maximum number of species in the chemical system
+/// @see ChemicalScalar, ChemicalVectorFixed
+template<int NumSpecies, int MaxSpecies = NumSpecies>
+using ChemicalScalarFixed = ChemicalScalarBase<double, RowVectorFixed<NumSpecies, MaxSpecies>>;
+
 /// A template base class to represent a chemical scalar and its partial derivatives.
 /// A *chemical scalar* is a quantity that depends on temperature, pressure,
 /// and mole amounts of species.
@@ -67,13 +78,13 @@ public:
     /// Construct a ChemicalScalarBase instance with given number of species.
     /// @param nspecies The number of species for the molar derivatives
     explicit ChemicalScalarBase(Index nspecies)
-    : ChemicalScalarBase(0.0, 0.0, 0.0, RowVector::Zero(nspecies)) {}
+    : ChemicalScalarBase(0.0, 0.0, 0.0, N::Zero(nspecies)) {}
 
     /// Construct a ChemicalScalarBase instance with given number of species and a constant value.
     /// @param nspecies The number of species for the molar derivatives
     /// @param val The constant value
     ChemicalScalarBase(Index nspecies, double val)
-    : ChemicalScalarBase(val, 0.0, 0.0, RowVector::Zero(nspecies)) {}
+    : ChemicalScalarBase(val, 0.0, 0.0, N::Zero(nspecies)) {}
 
     /// Construct a ChemicalScalarBase instance with given values and derivatives.
     /// @param val The value of the chemical scalar
@@ -44,6 +44,17 @@ using ChemicalVectorRef = ChemicalVectorBase<VectorRef,VectorRef,VectorRef,Matri
 /// A type that represents a vector of chemical properties and their derivatives.
 using ChemicalVectorConstRef = ChemicalVectorBase<VectorConstRef,VectorConstRef,VectorConstRef,MatrixConstRef>;
 
+/// A type that represents a vector of chemical properties and their derivatives for a fixed number of species.
+/// The number of rows is the number of species. The values and derivatives are stored inline, so that
+/// operations on ChemicalVectorFixed instances need no memory allocation and have their loops over the
+/// species unrolled by the compiler. Use `Eigen::Dynamic` as the number of species to store a variable
+/// number of species, up to a given maximum, also inline.
+/// @tparam NumSpecies The number of species in the chemical system
+/// @tparam MaxSpecies The maximum number of species in the chemical system
+/// @see ChemicalVector, ChemicalScalarFixed
+template<int NumSpecies, int MaxSpecies = NumSpecies>
+using ChemicalVectorFixed = ChemicalVectorBase<VectorFixed<NumSpecies, MaxSpecies>, VectorFixed<NumSpecies, MaxSpecies>, VectorFixed<NumSpecies, MaxSpecies>, MatrixFixed<NumSpecies, NumSpecies, MaxSpecies, MaxSpecies>>;
+
 /// A template base class to represent a vector of chemical properties and their partial derivatives.
 /// @see ThermoScalar, ThermoVector, ChemicalScalar, ChemicalVector
 template<typename V, typename T, typename P, typename N>
@@ -155,13 +166,14 @@ public:
 	}
 
     /// Assign another ChemicalVectorBase instance to this.
+    /// The values are assigned last, since the derivatives of an expression such as `x = x/y` refer to the values of `x`.
     template<typename VR, typename TR, typename PR, typename NR>
     auto operator=(const ChemicalVectorBase<VR,TR,PR,NR>& other) -> ChemicalVectorBase&
     {
-        val = other.val;
         ddT = other.ddT;
         ddP = other.ddP;
         ddn = other.ddn;
+        val = other.val;
         return *this;
     }
 
@@ -397,9 +409,9 @@ auto operator<<(std::ostream& out, const ChemicalVectorBase<V,T,P,N>& r) -> std:
 }
 
 template<typename V, typename T, typename P, typename N>
-auto operator+(const ChemicalVectorBase<V,T,P,N>& r) -> ChemicalVectorBase<V,T,P,N>
+auto operator+(const ChemicalVectorBase<V,T,P,N>& r) -> ChemicalVectorBase<NestedType<decltype(r.val)>, NestedType<decltype(r.ddT)>, NestedType<decltype(r.ddP)>, NestedType<decltype(r.ddn)>>
 {
-    return r;
+    return {r.val, r.ddT, r.ddP, r.ddn};
 }
 
 template<typename V, typename T, typename P, typename N>
@@ -415,7 +427,7 @@ auto operator+(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ChemicalVectorBas
 }
 
 template<typename VL, typename TL, typename PL, typename NL, typename VR, typename TR, typename PR>
-auto operator+(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoVectorBase<VR,TR,PR>& r) -> ChemicalVectorBase<decltype(l.val + r.val), decltype(l.ddT + r.ddT), decltype(l.ddP + r.ddP), decltype(l.ddn)>
+auto operator+(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoVectorBase<VR,TR,PR>& r) -> ChemicalVectorBase<decltype(l.val + r.val), decltype(l.ddT + r.ddT), decltype(l.ddP + r.ddP), NestedType<decltype(l.ddn)>>
 {
     return {l.val + r.val, l.ddT + r.ddT, l.ddP + r.ddP, l.ddn};
 }
@@ -427,7 +439,7 @@ auto operator+(const ThermoVectorBase<VL,TL,PL>& l, const ChemicalVectorBase<VR,
 }
 
 template<typename VL, typename TL, typename PL, typename NL, typename VR>
-auto operator+(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoScalarBase<VR>& r) -> ChemicalVectorBase<decltype(l.val + r.val*ones(l.size())), decltype(l.ddT + r.ddT*ones(l.size())), decltype(l.ddP + r.ddP*ones(l.size())), decltype(l.ddn)>
+auto operator+(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoScalarBase<VR>& r) -> ChemicalVectorBase<decltype(l.val + r.val*ones(l.size())), decltype(l.ddT + r.ddT*ones(l.size())), decltype(l.ddP + r.ddP*ones(l.size())), NestedType<decltype(l.ddn)>>
 {
     return {l.val + r.val*ones(l.size()), l.ddT + r.ddT*ones(l.size()), l.ddP + r.ddP*ones(l.size()), l.ddn};
 }
@@ -439,7 +451,7 @@ auto operator+(const ThermoScalarBase<VL>& l, const ChemicalVectorBase<VR,TR,PR,
 }
 
 template<typename V, typename T, typename P, typename N, typename Derived>
-auto operator+(const ChemicalVectorBase<V,T,P,N>& l, const Eigen::MatrixBase<Derived>& r) -> ChemicalVectorBase<decltype(l.val + r),T,P,N>
+auto operator+(const ChemicalVectorBase<V,T,P,N>& l, const Eigen::MatrixBase<Derived>& r) -> ChemicalVectorBase<decltype(l.val + r), NestedType<T>, NestedType<P>, NestedType<N>>
 {
     return {l.val + r, l.ddT, l.ddP, l.ddn};
 }
@@ -457,7 +469,7 @@ auto operator-(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ChemicalVectorBas
 }
 
 template<typename VL, typename TL, typename PL, typename NL, typename VR, typename TR, typename PR>
-auto operator-(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoVectorBase<VR,TR,PR>& r) -> ChemicalVectorBase<decltype(l.val - r.val), decltype(l.ddT - r.ddT), decltype(l.ddP - r.ddP), decltype(l.ddn)>
+auto operator-(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoVectorBase<VR,TR,PR>& r) -> ChemicalVectorBase<decltype(l.val - r.val), decltype(l.ddT - r.ddT), decltype(l.ddP - r.ddP), NestedType<decltype(l.ddn)>>
 {
     return {l.val - r.val, l.ddT - r.ddT, l.ddP - r.ddP, l.ddn};
 }
@@ -469,19 +481,19 @@ auto operator-(const ThermoVectorBase<VL,TL,PL>& l, const ChemicalVectorBase<VR,
 }
 
 template<typename VL, typename TL, typename PL, typename NL, typename VR>
-auto operator-(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoScalarBase<VR>& r) -> ChemicalVectorBase<decltype(l.val - r.val*ones(l.size())), decltype(l.ddT - r.ddT*ones(l.size())), decltype(l.ddP - r.ddP*ones(l.size())), decltype(l.ddn)>
+auto operator-(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoScalarBase<VR>& r) -> ChemicalVectorBase<decltype(l.val - r.val*ones(l.size())), decltype(l.ddT - r.ddT*ones(l.size())), decltype(l.ddP - r.ddP*ones(l.size())), NestedType<decltype(l.ddn)>>
 {
     return {l.val - r.val*ones(l.size()), l.ddT - r.ddT*ones(l.size()), l.ddP - r.ddP*ones(l.size()), l.ddn};
 }
 
 template<typename VL, typename VR, typename TR, typename PR, typename NR>
-auto operator-(const ThermoScalarBase<VL>& l, const ChemicalVectorBase<VR,TR,PR,NR>& r) -> decltype(r + l)
+auto operator-(const ThermoScalarBase<VL>& l, const ChemicalVectorBase<VR,TR,PR,NR>& r) -> decltype(-(r - l))
 {
     return -(r - l);
 }
 
 template<typename V, typename T, typename P, typename N, typename Derived>
-auto operator-(const ChemicalVectorBase<V,T,P,N>& l, const Eigen::MatrixBase<Derived>& r) -> ChemicalVectorBase<decltype(l.val - r),T,P,N>
+auto operator-(const ChemicalVectorBase<V,T,P,N>& l, const Eigen::MatrixBase<Derived>& r) -> ChemicalVectorBase<decltype(l.val - r), NestedType<T>, NestedType<P>, NestedType<N>>
 {
     return {l.val - r, l.ddT, l.ddP, l.ddn};
 }
@@ -517,9 +529,9 @@ auto operator*(const ChemicalVectorBase<VL,T,P,N>& l, const ThermoScalarBase<VR>
 }
 
 template<typename VL, typename TL, typename PL, typename NL, typename VR, typename NR>
-auto operator*(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ChemicalScalarBase<VR,NR>& r) -> ChemicalVectorBase<decltype(l.val * r.val), decltype(l.val * r.ddT + l.ddT * r.val), decltype(l.val * r.ddP + l.ddP * r.val), decltype(l.val * r.ddn + l.ddn * r.val)>
+auto operator*(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ChemicalScalarBase<VR,NR>& r) -> ChemicalVectorBase<decltype(l.val * r.val), decltype(l.val * r.ddT + l.ddT * r.val), decltype(l.val * r.ddP + l.ddP * r.val), decltype(diag(l.val) * r.ddn.replicate(l.size(), 1) + l.ddn * r.val)>
 {
-    return {l.val * r.val, l.val * r.ddT + l.ddT * r.val, l.val * r.ddP + l.ddP * r.val, l.val * r.ddn + l.ddn * r.val};
+    return {l.val * r.val, l.val * r.ddT + l.ddT * r.val, l.val * r.ddP + l.ddP * r.val, diag(l.val) * r.ddn.replicate(l.size(), 1) + l.ddn * r.val};
 }
 
 template<typename VL, typename NL, typename VR, typename TR, typename PR, typename NR>
@@ -566,33 +578,31 @@ auto operator%(const ChemicalVectorBase<VL,TL,PL,NL>& l, const Eigen::MatrixBase
 }
 
 template<typename VL, typename TL, typename PL, typename NL, typename VR, typename TR, typename PR, typename NR>
-auto operator/(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ChemicalVectorBase<VR,TR,PR,NR>& r) -> ChemicalVector
+auto operator/(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ChemicalVectorBase<VR,TR,PR,NR>& r) -> ChemicalVectorBase<decltype(l.val/r.val), decltype(diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT)), decltype(diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP)), decltype(diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddn - diag(l.val) * r.ddn))>
 {
-    const Vector tmp = 1.0/(r.val % r.val);
     return {l.val/r.val,
-            diag(tmp) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT),
-            diag(tmp) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP),
-            diag(tmp) * (diag(r.val) * l.ddn - diag(l.val) * r.ddn)};
+            diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT),
+            diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP),
+            diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddn - diag(l.val) * r.ddn)};
 }
 
-template<typename VL, typename TL, typename PL, typename NL, typename VR, typename TR, typename PR, typename NR>
-auto operator/(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoVectorBase<VR,TR,PR>& r) -> ChemicalVector
+template<typename VL, typename TL, typename PL, typename NL, typename VR, typename TR, typename PR>
+auto operator/(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ThermoVectorBase<VR,TR,PR>& r) -> ChemicalVectorBase<decltype(l.val/r.val), decltype(diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT)), decltype(diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP)), decltype(diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddn))>
 {
-    const Vector tmp = 1.0/(r.val % r.val);
     return {l.val/r.val,
-            diag(tmp) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT),
-            diag(tmp) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP),
-            diag(tmp) * (diag(r.val) * l.ddn)};
+            diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT),
+            diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP),
+            diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddn)};
 }
 
 template<typename VL, typename TL, typename PL, typename NL, typename VR, typename NR>
-auto operator/(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ChemicalScalarBase<VR,NR>& r) -> ChemicalVector
+auto operator/(const ChemicalVectorBase<VL,TL,PL,NL>& l, const ChemicalScalarBase<VR,NR>& r) -> ChemicalVectorBase<decltype(l.val/r.val), decltype(double() * (r.val * l.ddT - l.val * r.ddT)), decltype(double() * (r.val * l.ddP - l.val * r.ddP)), decltype(double() * (r.val * l.ddn - diag(l.val) * r.ddn.replicate(l.size(), 1)))>
 {
     const double tmp = 1.0/(r.val * r.val);
     return {l.val/r.val,
             tmp * (r.val * l.ddT - l.val * r.ddT),
             tmp * (r.val * l.ddP - l.val * r.ddP),
-            tmp * (r.val * l.ddn - l.val * r.ddn)};
+            tmp * (r.val * l.ddn - diag(l.val) * r.ddn.replicate(l.size(), 1))};
 }
 
 template<typename VL, typename VR, typename T, typename P, typename N>
@@ -732,49 +742,52 @@ auto rows(const ChemicalVectorBase<V,T,P,N>& vec, const Indices& irows, const In
 }
 
 template<typename V, typename T, typename P, typename N>
-auto abs(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVector
+auto abs(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVectorBase<PlainType<V>, decltype(diag(l.val/abs(l.val)) * l.ddT), decltype(diag(l.val/abs(l.val)) * l.ddP), decltype(diag(l.val/abs(l.val)) * l.ddn)>
 {
-    const Vector tmp1 = abs(l.val);
-    const Vector tmp2 = l.val/tmp1;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP, diag(tmp2) * l.ddn};
+    return {abs(l.val), diag(l.val/abs(l.val)) * l.ddT, diag(l.val/abs(l.val)) * l.ddP, diag(l.val/abs(l.val)) * l.ddn};
 }
 
 template<typename V, typename T, typename P, typename N>
-auto sqrt(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVector
+auto sqrt(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVectorBase<PlainType<V>, decltype(diag(0.5 * sqrt(l.val)/l.val) * l.ddT), decltype(diag(0.5 * sqrt(l.val)/l.val) * l.ddP), decltype(diag(0.5 * sqrt(l.val)/l.val) * l.ddn)>
 {
-    const Vector tmp1 = sqrt(l.val);
-    const Vector tmp2 = 0.5 * tmp1/l.val;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP, diag(tmp2) * l.ddn};
+    return {sqrt(l.val), diag(0.5 * sqrt(l.val)/l.val) * l.ddT, diag(0.5 * sqrt(l.val)/l.val) * l.ddP, diag(0.5 * sqrt(l.val)/l.val) * l.ddn};
 }
 
 template<typename V, typename T, typename P, typename N>
-auto pow(const ChemicalVectorBase<V,T,P,N>& l, double power) -> ChemicalVector
+auto pow(const ChemicalVectorBase<V,T,P,N>& l, double power) -> ChemicalVectorBase<PlainType<V>, PlainType<T>, PlainType<P>, PlainType<N>>
 {
-    const Vector tmp1 = pow(l.val, power);
-    const Vector tmp2 = power * tmp1/l.val;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP, diag(tmp2) * l.ddn};
+    ChemicalVectorBase<PlainType<V>, PlainType<T>, PlainType<P>, PlainType<N>> res;
+    res.val = pow(l.val, power);
+    const PlainType<V> tmp = power * res.val/l.val;
+    res.ddT = diag(tmp) * l.ddT;
+    res.ddP = diag(tmp) * l.ddP;
+    res.ddn = diag(tmp) * l.ddn;
+    return res;
 }
 
 template<typename V, typename T, typename P, typename N>
-auto exp(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVector
+auto exp(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVectorBase<PlainType<V>, PlainType<T>, PlainType<P>, PlainType<N>>
 {
-    const Vector tmp = exp(l.val);
-    return {tmp, diag(tmp) * l.ddT, diag(tmp) * l.ddP, diag(tmp) * l.ddn};
+    ChemicalVectorBase<PlainType<V>, PlainType<T>, PlainType<P>, PlainType<N>> res;
+    res.val = exp(l.val);
+    res.ddT = diag(res.val) * l.ddT;
+    res.ddP = diag(res.val) * l.ddP;
+    res.ddn = diag(res.val) * l.ddn;
+    return res;
 }
 
 template<typename V, typename T, typename P, typename N>
-auto log(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVector
+auto log(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVectorBase<PlainType<V>, decltype(diag(1.0/l.val) * l.ddT), decltype(diag(1.0/l.val) * l.ddP), decltype(diag(1.0/l.val) * l.ddn)>
 {
-    const Vector tmp1 = log(l.val);
-    const Vector tmp2 = 1.0/l.val;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP, diag(tmp2) * l.ddn};
+    return {log(l.val), diag(1.0/l.val) * l.ddT, diag(1.0/l.val) * l.ddP, diag(1.0/l.val) * l.ddn};
 }
 
 template<typename V, typename T, typename P, typename N>
-auto log10(const ChemicalVectorBase<V,T,P,N>& l) -> decltype(log(l)/double())
+auto log10(const ChemicalVectorBase<V,T,P,N>& l) -> ChemicalVectorBase<PlainType<V>, decltype(double() * (diag(1.0/l.val) * l.ddT)), decltype(double() * (diag(1.0/l.val) * l.ddP)), decltype(double() * (diag(1.0/l.val) * l.ddn))>
 {
     const double ln10 = 2.302585092994046;
-    return log(l)/ln10;
+    const double factor = 1.0/ln10;
+    return {factor * log(l.val), factor * (diag(1.0/l.val) * l.ddT), factor * (diag(1.0/l.val) * l.ddP), factor * (diag(1.0/l.val) * l.ddn)};
 }
 
 template<typename V, typename T, typename P, typename N>
@@ -41,6 +41,16 @@ using ThermoVectorRef = ThermoVectorBase<VectorRef,VectorRef,VectorRef>;
 /// A type that defines a vector of thermodynamic properties.
 using ThermoVectorConstRef = ThermoVectorBase<VectorConstRef,VectorConstRef,VectorConstRef>;
 
+/// A type that defines a vector of thermodynamic properties with a fixed number of rows.
+/// The values and derivatives are stored inline, so that operations on ThermoVectorFixed
+/// instances need no memory allocation. Use `Eigen::Dynamic` as the number of rows to
+/// store a variable number of rows, up to a given maximum, also inline.
+/// @tparam NumRows The number of rows of the vector
+/// @tparam MaxRows The maximum number of rows of the vector
+/// @see ThermoVector, ChemicalVectorFixed
+template<int NumRows, int MaxRows = NumRows>
+using ThermoVectorFixed = ThermoVectorBase<VectorFixed<NumRows, MaxRows>, VectorFixed<NumRows, MaxRows>, VectorFixed<NumRows, MaxRows>>;
+
 /// A template base class to represent a vector of thermodynamic scalars and their partial derivatives.
 /// @see ThermoScalar, ThermoVector, ChemicalScalar, ChemicalVector
 template<typename V, typename T, typename P>
@@ -123,12 +133,13 @@ public:
 	}
 
     /// Assign a ThermoVectorBase instance to this ThermoVectorBase instance.
+    /// The values are assigned last, since the derivatives of an expression such as `t = t/u` refer to the values of `t`.
     template<typename VR, typename TR, typename PR>
     auto operator=(const ThermoVectorBase<VR,TR,PR>& other) -> ThermoVectorBase&
     {
-        val = other.val;
         ddT = other.ddT;
         ddP = other.ddP;
+        val = other.val;
         return *this;
     }
 
@@ -290,9 +301,9 @@ auto operator<<(std::ostream& out, const ThermoVectorBase<V,T,P>& a) -> std::ost
 }
 
 template<typename V, typename T, typename P>
-auto operator+(const ThermoVectorBase<V,T,P>& l) -> ThermoVectorBase<V,T,P>
+auto operator+(const ThermoVectorBase<V,T,P>& l) -> ThermoVectorBase<NestedType<decltype(l.val)>, NestedType<decltype(l.ddT)>, NestedType<decltype(l.ddP)>>
 {
-    return l;
+    return {l.val, l.ddT, l.ddP};
 }
 
 template<typename V, typename T, typename P>
@@ -307,14 +318,14 @@ auto operator+(const ThermoVectorBase<VL,TL,PL>& l, const ThermoVectorBase<VR,TR
     return {l.val + r.val, l.ddT + r.ddT, l.ddP + r.ddP};
 }
 
-template<typename V, typename T, typename P>
-auto operator+(const ThermoVectorBase<V,T,P>& l, VectorConstRef r) -> ThermoVectorBase<decltype(l.val + r),T,P>
+template<typename V, typename T, typename P, typename Derived>
+auto operator+(const ThermoVectorBase<V,T,P>& l, const Eigen::MatrixBase<Derived>& r) -> ThermoVectorBase<decltype(l.val + r), NestedType<T>, NestedType<P>>
 {
     return {l.val + r, l.ddT, l.ddP};
 }
 
-template<typename V, typename T, typename P>
-auto operator+(VectorConstRef l, const ThermoVectorBase<V,T,P>& r) -> decltype(r + l)
+template<typename V, typename T, typename P, typename Derived>
+auto operator+(const Eigen::MatrixBase<Derived>& l, const ThermoVectorBase<V,T,P>& r) -> decltype(r + l)
 {
     return r + l;
 }
@@ -325,14 +336,14 @@ auto operator-(const ThermoVectorBase<VL,TL,PL>& l, const ThermoVectorBase<VR,TR
     return {l.val - r.val, l.ddT - r.ddT, l.ddP - r.ddP};
 }
 
-template<typename V, typename T, typename P>
-auto operator-(const ThermoVectorBase<V,T,P>& l, VectorConstRef r) -> ThermoVectorBase<decltype(l.val - r),T,P>
+template<typename V, typename T, typename P, typename Derived>
+auto operator-(const ThermoVectorBase<V,T,P>& l, const Eigen::MatrixBase<Derived>& r) -> ThermoVectorBase<decltype(l.val - r), NestedType<T>, NestedType<P>>
 {
     return {l.val - r, l.ddT, l.ddP};
 }
 
-template<typename V, typename T, typename P>
-auto operator-(VectorConstRef l, const ThermoVectorBase<V,T,P>& r) -> decltype(-(r - l))
+template<typename V, typename T, typename P, typename Derived>
+auto operator-(const Eigen::MatrixBase<Derived>& l, const ThermoVectorBase<V,T,P>& r) -> decltype(-(r - l))
 {
     return -(r - l);
 }
@@ -369,27 +380,26 @@ auto operator%(const ThermoVectorBase<VL,TL,PL>& l, const ThermoVectorBase<VR,TR
             diag(l.val) * r.ddP + diag(r.val) * l.ddP};
 }
 
-template<typename V, typename T, typename P>
-auto operator%(VectorConstRef l, const ThermoVectorBase<V,T,P>& r) -> ThermoVectorBase<decltype(diag(l) * r.val), decltype(diag(l) * r.ddT), decltype(diag(l) * r.ddP)>
+template<typename V, typename T, typename P, typename Derived>
+auto operator%(const Eigen::MatrixBase<Derived>& l, const ThermoVectorBase<V,T,P>& r) -> ThermoVectorBase<decltype(diag(l) * r.val), decltype(diag(l) * r.ddT), decltype(diag(l) * r.ddP)>
 {
     return {diag(l) * r.val,
             diag(l) * r.ddT,
             diag(l) * r.ddP};
 }
 
-template<typename VL, typename TL, typename PL, typename VR, typename TR, typename PR>
-auto operator%(const ThermoVectorBase<VL,TL,PL>& l, VectorConstRef r) -> decltype(r % l)
+template<typename VL, typename TL, typename PL, typename Derived>
+auto operator%(const ThermoVectorBase<VL,TL,PL>& l, const Eigen::MatrixBase<Derived>& r) -> decltype(r % l)
 {
     return r % l;
 }
 
 template<typename VL, typename TL, typename PL, typename VR, typename TR, typename PR>
-auto operator/(const ThermoVectorBase<VL,TL,PL>& l, const ThermoVectorBase<VR,TR,PR>& r) -> ThermoVector
+auto operator/(const ThermoVectorBase<VL,TL,PL>& l, const ThermoVectorBase<VR,TR,PR>& r) -> ThermoVectorBase<decltype(l.val/r.val), decltype(diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT)), decltype(diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP))>
 {
-    const Vector tmp = 1.0/(r.val % r.val);
     return {l.val/r.val,
-            diag(tmp) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT),
-            diag(tmp) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP)};
+            diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddT - diag(l.val) * r.ddT),
+            diag(1.0/(r.val % r.val)) * (diag(r.val) * l.ddP - diag(l.val) * r.ddP)};
 }
 
 template<typename V, typename T, typename P, typename VR>
@@ -484,51 +494,49 @@ auto rows(const ThermoVectorBase<V,T,P>& vec, const Indices& irows) -> ThermoVec
 }
 
 template<typename V, typename T, typename P>
-auto abs(const ThermoVectorBase<V,T,P>& l) -> ThermoVector
+auto abs(const ThermoVectorBase<V,T,P>& l) -> ThermoVectorBase<PlainType<V>, decltype(diag(l.val/abs(l.val)) * l.ddT), decltype(diag(l.val/abs(l.val)) * l.ddP)>
 {
-    const Vector tmp1 = abs(l.val);
-    const Vector tmp2 = l.val/tmp1;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP};
+    return {abs(l.val), diag(l.val/abs(l.val)) * l.ddT, diag(l.val/abs(l.val)) * l.ddP};
 }
 
 template<typename V, typename T, typename P>
-auto sqrt(const ThermoVectorBase<V,T,P>& l) -> ThermoVector
+auto sqrt(const ThermoVectorBase<V,T,P>& l) -> ThermoVectorBase<PlainType<V>, decltype(diag(0.5 * sqrt(l.val)/l.val) * l.ddT), decltype(diag(0.5 * sqrt(l.val)/l.val) * l.ddP)>
 {
-    const Vector tmp1 = sqrt(l.val);
-    const Vector tmp2 = 0.5 * tmp1/l.val;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP};
+    return {sqrt(l.val), diag(0.5 * sqrt(l.val)/l.val) * l.ddT, diag(0.5 * sqrt(l.val)/l.val) * l.ddP};
 }
 
 template<typename V, typename T, typename P>
-auto pow(const ThermoVectorBase<V,T,P>& l, double power) -> ThermoVector
+auto pow(const ThermoVectorBase<V,T,P>& l, double power) -> ThermoVectorBase<PlainType<V>, PlainType<T>, PlainType<P>>
 {
-    const Vector tmp1 = pow(l.val, power);
-    const Vector tmp2 = power * tmp1/l.val;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP};
+    ThermoVectorBase<PlainType<V>, PlainType<T>, PlainType<P>> res;
+    res.val = pow(l.val, power);
+    const PlainType<V> tmp = power * res.val/l.val;
+    res.ddT = diag(tmp) * l.ddT;
+    res.ddP = diag(tmp) * l.ddP;
+    return res;
 }
 
 template<typename V, typename T, typename P>
-auto exp(const ThermoVectorBase<V,T,P>& l) -> ThermoVector
+auto exp(const ThermoVectorBase<V,T,P>& l) -> ThermoVectorBase<PlainType<V>, PlainType<T>, PlainType<P>>
 {
-    const Vector tmp = exp(l.val);
-    return {tmp, diag(tmp) * l.ddT, diag(tmp) * l.ddP};
+    ThermoVectorBase<PlainType<V>, PlainType<T>, PlainType<P>> res;
+    res.val = exp(l.val);
+    res.ddT = diag(res.val) * l.ddT;
+    res.ddP = diag(res.val) * l.ddP;
+    return res;
 }
 
 template<typename V, typename T, typename P>
-auto log(const ThermoVectorBase<V,T,P>& l) -> ThermoVector
+auto log(const ThermoVectorBase<V,T,P>& l) -> ThermoVectorBase<PlainType<V>, decltype(diag(1.0/l.val) * l.ddT), decltype(diag(1.0/l.val) * l.ddP)>
 {
-    const Vector tmp1 = log(l.val);
-    const Vector tmp2 = 1.0/l.val;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP};
+    return {log(l.val), diag(1.0/l.val) * l.ddT, diag(1.0/l.val) * l.ddP};
 }
 
 template<typename V, typename T, typename P>
-auto log10(const ThermoVectorBase<V,T,P>& l) -> ThermoVector
+auto log10(const ThermoVectorBase<V,T,P>& l) -> ThermoVectorBase<PlainType<V>, decltype(diag(double()/l.val) * l.ddT), decltype(diag(double()/l.val) * l.ddP)>
 {
     const double log10e = 0.4342944819032518166679324;
-    const Vector tmp1 = log10e*log(l.val);
-    const Vector tmp2 = log10e/l.val;
-    return {tmp1, diag(tmp2) * l.ddT, diag(tmp2) * l.ddP, diag(tmp2) * l.ddn};
+    return {log10e*log(l.val), diag(log10e/l.val) * l.ddT, diag(log10e/l.val) * l.ddP};
 }
 
 } // namespace Reaktoro
@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+#include "Units.hpp"
+
 // C++ includes
 #include <algorithm>
 #include <cmath>
@@ -22,6 +24,8 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -639,25 +643,113 @@ inline void checkConvertibleUnits(const DerivedUnit& from, const DerivedUnit& to
     }
 }
 
+/// Return the affine conversion `(factor, offset)` from a temperature unit to kelvin
+std::pair<double, double> toKelvinAffine(const string& from)
+{
+    if(from == "K") return {1.0, 0.0};
+    const auto& unit = temperatureUnitsMap.at(from);
+    const auto inner = toKelvinAffine(unit.symbol);
+    return {inner.first/unit.factor, inner.second - inner.first*unit.translate/unit.factor};
+}
+
+/// Return the affine conversion `(factor, offset)` from kelvin to a temperature unit
+std::pair<double, double> fromKelvinAffine(const string& to)
+{
+    if(to == "K") return {1.0, 0.0};
+    const auto& unit = temperatureUnitsMap.at(to);
+    const auto inner = fromKelvinAffine(unit.symbol);
+    return {unit.factor * inner.first, unit.factor * inner.second + unit.translate};
+}
+
+/// An entry in the cache of converters, which also records pairs of units that are not convertible
+struct ConverterEntry
+{
+    bool convertible;
+    Converter converter;
+};
+
+/// The process-wide cache of converters between pairs of units
+struct ConverterCache
+{
+    std::shared_mutex mutex;
+    map<string, map<string, ConverterEntry, std::less<>>, std::less<>> entries;
+
+    /// Return a pointer to the entry of a pair of units, or nullptr if there is none.
+    const ConverterEntry* find(const string& from, const string& to)
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        const auto i = entries.find(from);
+        if(i == entries.end()) return nullptr;
+        const auto j = i->second.find(to);
+        if(j == i->second.end()) return nullptr;
+        return &j->second;
+    }
+
+    /// Insert the entry of a pair of units.
+    void insert(const string& from, const string& to, const ConverterEntry& entry)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        entries[from].emplace(to, entry);
+    }
+};
+
+ConverterCache& converterCache()
+{
+    static ConverterCache cache;
+    return cache;
+}
+
 } // namespace internal
 
-double convert(double value, const string& from, const string& to)
+Converter::Converter(const std::string& from, const std::string& to)
 {
     if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
-        return internal::convertTemperature(value, from, to);
+    {
+        const auto a = internal::toKelvinAffine(from);
+        const auto b = internal::fromKelvinAffine(to);
+        m_factor = a.first * b.first;
+        m_offset = a.second * b.first + b.second;
+        return;
+    }
     auto parsed_from = internal::parseUnit(from);
     auto parsed_to   = internal::parseUnit(to);
     internal::checkConvertibleUnits(parsed_from, parsed_to, from, to);
-    return value * internal::factor(parsed_from)/internal::factor(parsed_to);
+    m_factor  = internal::factor(parsed_from);
+    m_divisor = internal::factor(parsed_to);
+}
+
+auto converter(const std::string& from, const std::string& to) -> Converter
+{
+    auto& cache = internal::converterCache();
+    if(const auto* entry = cache.find(from, to))
+        if(entry->convertible)
+            return entry->converter;
+    Converter converter(from, to);
+    cache.insert(from, to, {true, converter});
+    return converter;
+}
+
+double convert(double value, const string& from, const string& to)
+{
+    return converter(from, to)(value);
 }
 
 bool convertible(const std::string& from, const std::string& to)
 {
+    auto& cache = internal::converterCache();
+    if(const auto* entry = cache.find(from, to))
+        return entry->convertible;
     if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
         return true;
     auto parsed_from = internal::parseUnit(from);
     auto parsed_to   = internal::parseUnit(to);
-    return dimension(parsed_from) == dimension(parsed_to);
+    if(dimension(parsed_from) != dimension(parsed_to))
+    {
+        cache.insert(from, to, {false, Converter()});
+        return false;
+    }
+    cache.insert(from, to, {true, Converter(from, to)});
+    return true;
 }
 
 } // namespace units
@@ -22,6 +22,53 @@
 
 namespace units {
 
+/// A conversion of numeric values from a unit to another, whose unit strings are parsed only once.
+/// Every conversion, including those of temperature, is affine: `value * factor / divisor + offset`.
+/// The factors of the units are kept apart (instead of their ratio) so that the converted values
+/// are identical to those of function @ref convert.
+class Converter
+{
+public:
+    /// Construct a default Converter instance, which does not change values
+    constexpr Converter() = default;
+
+    /// Construct a Converter instance with given factor, divisor, and offset
+    constexpr Converter(double factor, double divisor, double offset)
+    : m_factor(factor), m_divisor(divisor), m_offset(offset)
+    {}
+
+    /// Construct a Converter instance by parsing the strings of two units
+    /// @param from The string representing the unit from which the conversion is made
+    /// @param to The string representing the unit to which the conversion is made
+    Converter(const std::string& from, const std::string& to);
+
+    /// Convert a numeric value
+    constexpr auto operator()(double value) const -> double
+    {
+        return m_factor * value / m_divisor + m_offset;
+    }
+
+    /// Return the factor of the conversion
+    constexpr auto factor() const -> double { return m_factor; }
+
+    /// Return the divisor of the conversion
+    constexpr auto divisor() const -> double { return m_divisor; }
+
+    /// Return the offset of the conversion
+    constexpr auto offset() const -> double { return m_offset; }
+
+private:
+    double m_factor = 1.0;
+    double m_divisor = 1.0;
+    double m_offset = 0.0;
+};
+
+/// Return the converter between two units.
+/// The converter of each pair of units is created once and kept in a thread-safe cache for the whole process.
+/// @param from The string representing the unit from which the conversion is made
+/// @param to The string representing the unit to which the conversion is made
+auto converter(const std::string& from, const std::string& to) -> Converter;
+
 /// Convert a numeric value from a unit to another
 /// @param value The value
 /// @param from The string representing the unit from which the conversion is made
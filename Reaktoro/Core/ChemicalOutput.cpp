@@ -64,6 +64,10 @@ struct ChemicalOutput::Impl
     /// The names of the quantities to be output.
     std::vector<std::string> data;
 
+    /// The functions that evaluate the quantities in `data`, created when the output is opened.
+    /// An empty function denotes the iteration number column `i`.
+    std::vector<ChemicalQuantity::Function> functions;
+
     /// The names of the quantities to appear as column header in the output.
     std::vector<std::string> headings;
 
@@ -135,6 +139,11 @@ struct ChemicalOutput::Impl
         // Set the floating-point precision in the output.
         datafile << std::setprecision(precision);
 
+        // Parse the quantities once, so that updates only evaluate the created functions
+        functions.clear();
+        for(auto word : data)
+            functions.push_back(word == "i" ? ChemicalQuantity::Function() : quantity.function(word));
+
         // Determine the spacings between the columns
         spacings.clear();
         for(auto word : headings)
@@ -174,10 +183,10 @@ struct ChemicalOutput::Impl
 
         // For each quantity, ouput its value on each column
         icolumn = 0;
-        for(auto word : data)
+        for(const auto& func : functions)
         {
             auto space = spacings[icolumn];
-            auto val = (word == "i") ? iteration : quantity.value(word);
+            auto val = func ? func() : iteration;
             if(datafile.is_open()) datafile << std::left << std::setw(space) << val;
             if(terminal) std::cout << std::left << std::setw(space) << val;
             ++icolumn;
@@ -17,20 +17,57 @@
 
 #include "ChemicalProperties.hpp"
 
+// C++ includes
+#include <atomic>
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/Utils.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return the number of species in each phase of a chemical system.
+auto numSpeciesInPhases(const ChemicalSystem& system) -> Indices
+{
+    Indices res(system.numPhases());
+    for(Index iphase = 0; iphase < res.size(); ++iphase)
+        res[iphase] = system.numSpeciesInPhase(iphase);
+    return res;
+}
+
+} // namespace
+
+struct ChemicalProperties::PhaseQuantities
+{
+    /// The amounts, masses, molar volumes and volumes of the phases and their derivatives.
+    ChemicalVector amounts, masses, molar_volumes, volumes;
+
+    /// The values of the amounts, masses, molar volumes and volumes of the phases.
+    Vector amount_values, mass_values, molar_volume_values, volume_values;
+
+    /// The flag that indicates if the phase quantities need to be recomputed.
+    std::atomic<bool> outdated{true};
+
+    /// The flag that indicates if the values of the phase quantities need to be recomputed.
+    std::atomic<bool> values_outdated{true};
+
+    /// The mutex that serializes the computation of the phase quantities by concurrent readers.
+    std::mutex mutex;
+};
 
 ChemicalProperties::ChemicalProperties()
+: phase_quantities(std::make_shared<PhaseQuantities>())
 {}
 
 ChemicalProperties::ChemicalProperties(const ChemicalSystem& system)
 : system(system), num_species(system.numSpecies()), num_phases(system.numPhases()),
-  T(NAN), P(NAN), n(zeros(num_species)), x(num_species),
-  tres(num_phases, num_species), cres(num_phases, num_species)
+  T(NAN), P(NAN), n(zeros(num_species)), x(numSpeciesInPhases(system)),
+  tres(num_phases, num_species), cres(numSpeciesInPhases(system)),
+  molar_masses(Reaktoro::molarMasses(system.species())),
+  phase_quantities(std::make_shared<PhaseQuantities>())
 {}
 
 auto ChemicalProperties::update(double T_, double P_) -> void
@@ -41,6 +78,7 @@ auto ChemicalProperties::update(double T_, double P_) -> void
         T = T_;
         P = P_;
         system.thermoModel()(tres, T, P);
+        resetPhaseQuantities();
     }
 }
 
@@ -53,6 +91,7 @@ auto ChemicalProperties::update(VectorConstRef n_) -> void
 
     n = n_;
     system.chemicalModel()(cres, T, P, n);
+    resetPhaseQuantities();
 
     // Update mole fractions
     Index offset = 0;
@@ -61,7 +100,7 @@ auto ChemicalProperties::update(VectorConstRef n_) -> void
         const auto size = system.numSpeciesInPhase(iphase);
         const auto np = rows(n, offset, size);
         const auto npc = Composition(np);
-        auto xp = rows(x, offset, offset, size, size);
+        auto xp = x.block(offset, size);
         if(size == 1) {
             xp = 1.0;
         }
@@ -89,6 +128,7 @@ auto ChemicalProperties::update(double T_, double P_, VectorConstRef n_, const T
     n = n_;
     tres = tres_;
     cres = cres_;
+    resetPhaseQuantities();
 }
 
 auto ChemicalProperties::temperature() const -> Temperature
@@ -116,12 +156,12 @@ auto ChemicalProperties::chemicalModelResult() const -> const ChemicalModelResul
     return cres;
 }
 
-auto ChemicalProperties::moleFractions() const -> ChemicalVector
+auto ChemicalProperties::moleFractions() const -> const BlockDiagonalChemicalVector&
 {
     return x;
 }
 
-auto ChemicalProperties::lnActivityCoefficients() const -> ChemicalVectorConstRef
+auto ChemicalProperties::lnActivityCoefficients() const -> const BlockDiagonalChemicalVector&
 {
     return cres.lnActivityCoefficients();
 }
@@ -131,12 +171,12 @@ auto ChemicalProperties::lnActivityConstants() const -> ThermoVectorConstRef
     return tres.lnActivityConstants();
 }
 
-auto ChemicalProperties::lnActivities() const -> ChemicalVectorConstRef
+auto ChemicalProperties::lnActivities() const -> const BlockDiagonalChemicalVector&
 {
     return cres.lnActivities();
 }
 
-auto ChemicalProperties::partialMolarVolumes() const -> ChemicalVectorConstRef
+auto ChemicalProperties::partialMolarVolumes() const -> const BlockDiagonalChemicalVector&
 {
     return cres.partialMolarVolumes();
 }
@@ -145,7 +185,7 @@ auto ChemicalProperties::chemicalPotentials() const -> ChemicalVector
 {
     const auto& R = universalGasConstant;
     const auto& G = standardPartialMolarGibbsEnergies();
-    const auto& lna = lnActivities();
+    const auto lna = lnActivities().dense();
     return G + R*T*lna;
 }
 
@@ -202,7 +242,7 @@ auto ChemicalProperties::phaseMolarGibbsEnergies() const -> ChemicalVector
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
         const auto nspecies = system.numSpeciesInPhase(iphase);
-        const auto xp = rows(x, ispecies, ispecies, nspecies, nspecies);
+        const auto xp = x.block(ispecies, nspecies);
         const auto tp = tres.phaseProperties(iphase, ispecies, nspecies);
         const auto cp = cres.phaseProperties(iphase, ispecies, nspecies);
         row(res, iphase, ispecies, nspecies) = sum(xp % tp.standard_partial_molar_gibbs_energies);
@@ -219,7 +259,7 @@ auto ChemicalProperties::phaseMolarEnthalpies() const -> ChemicalVector
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
         const auto nspecies = system.numSpeciesInPhase(iphase);
-        const auto xp = rows(x, ispecies, ispecies, nspecies, nspecies);
+        const auto xp = x.block(ispecies, nspecies);
         const auto tp = tres.phaseProperties(iphase, ispecies, nspecies);
         const auto cp = cres.phaseProperties(iphase, ispecies, nspecies);
         row(res, iphase, ispecies, nspecies) = sum(xp % tp.standard_partial_molar_enthalpies);
@@ -229,26 +269,9 @@ auto ChemicalProperties::phaseMolarEnthalpies() const -> ChemicalVector
     return res;
 }
 
-auto ChemicalProperties::phaseMolarVolumes() const -> ChemicalVector
+auto ChemicalProperties::phaseMolarVolumes() const -> const ChemicalVector&
 {
-    ChemicalVector res(num_phases, num_species);
-    Index ispecies = 0;
-    for(Index iphase = 0; iphase < num_phases; ++iphase)
-    {
-        const auto nspecies = system.numSpeciesInPhase(iphase);
-        const auto tp = tres.phaseProperties(iphase, ispecies, nspecies);
-        const auto cp = cres.phaseProperties(iphase, ispecies, nspecies);
-        if(cp.molar_volume > 0.0)
-            row(res, iphase, ispecies, nspecies) = cp.molar_volume;
-        else
-        {
-            const auto xp = rows(x, ispecies, ispecies, nspecies, nspecies);
-            row(res, iphase, ispecies, nspecies) = sum(xp % tp.standard_partial_molar_volumes);
-        }
-
-        ispecies += nspecies;
-    }
-    return res;
+    return updatePhaseQuantities().molar_volumes;
 }
 
 auto ChemicalProperties::phaseMolarEntropies() const -> ChemicalVector
@@ -279,7 +302,7 @@ auto ChemicalProperties::phaseMolarHeatCapacitiesConstP() const -> ChemicalVecto
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
         const auto nspecies = system.numSpeciesInPhase(iphase);
-        const auto xp = rows(x, ispecies, ispecies, nspecies, nspecies);
+        const auto xp = x.block(ispecies, nspecies);
         const auto tp = tres.phaseProperties(iphase, ispecies, nspecies);
         const auto cp = cres.phaseProperties(iphase, ispecies, nspecies);
         row(res, iphase, ispecies, nspecies) = sum(xp % tp.standard_partial_molar_heat_capacities_cp);
@@ -296,7 +319,7 @@ auto ChemicalProperties::phaseMolarHeatCapacitiesConstV() const -> ChemicalVecto
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
         const auto nspecies = system.numSpeciesInPhase(iphase);
-        const auto xp = rows(x, ispecies, ispecies, nspecies, nspecies);
+        const auto xp = x.block(ispecies, nspecies);
         const auto tp = tres.phaseProperties(iphase, ispecies, nspecies);
         const auto cp = cres.phaseProperties(iphase, ispecies, nspecies);
         row(res, iphase, ispecies, nspecies) = sum(xp % tp.standard_partial_molar_heat_capacities_cv);
@@ -348,44 +371,22 @@ auto ChemicalProperties::phaseSpecificHeatCapacitiesConstV() const -> ChemicalVe
 
 auto ChemicalProperties::phaseDensities() const -> ChemicalVector
 {
-    return phaseMasses()/(phaseAmounts() % phaseMolarVolumes());
+    return phaseMasses()/phaseVolumes();
 }
 
-auto ChemicalProperties::phaseMasses() const -> ChemicalVector
+auto ChemicalProperties::phaseMasses() const -> const ChemicalVector&
 {
-    const auto nc = Composition(n);
-    const auto mm = Reaktoro::molarMasses(system.species());
-    ChemicalVector res(num_phases, num_species);
-    Index ispecies = 0;
-    for(Index iphase = 0; iphase < num_phases; ++iphase)
-    {
-        const auto nspecies = system.numSpeciesInPhase(iphase);
-        const auto np = rows(nc, ispecies, ispecies, nspecies, nspecies);
-        auto mmp = rows(mm, ispecies, nspecies);
-        row(res, iphase, ispecies, nspecies) = sum(mmp % np);
-        ispecies += nspecies;
-    }
-    return res;
+    return updatePhaseQuantities().masses;
 }
 
-auto ChemicalProperties::phaseAmounts() const -> ChemicalVector
+auto ChemicalProperties::phaseAmounts() const -> const ChemicalVector&
 {
-    const auto nc = Composition(n);
-    ChemicalVector res(num_phases, num_species);
-    Index ispecies = 0;
-    for(Index iphase = 0; iphase < num_phases; ++iphase)
-    {
-        const auto nspecies = system.numSpeciesInPhase(iphase);
-        const auto np = rows(nc, ispecies, ispecies, nspecies, nspecies);
-        row(res, iphase, ispecies, nspecies) = sum(np);
-        ispecies += nspecies;
-    }
-    return res;
+    return updatePhaseQuantities().amounts;
 }
 
-auto ChemicalProperties::phaseVolumes() const -> ChemicalVector
+auto ChemicalProperties::phaseVolumes() const -> const ChemicalVector&
 {
-    return phaseAmounts() % phaseMolarVolumes();
+    return updatePhaseQuantities().volumes;
 }
 
 auto ChemicalProperties::volume() const -> ChemicalScalar
@@ -400,14 +401,165 @@ auto ChemicalProperties::subvolume(const Indices& iphases) const -> ChemicalScal
 
 auto ChemicalProperties::fluidVolume() const -> ChemicalScalar
 {
-    const Indices iphases = system.indicesFluidPhases();
-    return sum(rows(phaseVolumes(), iphases));
+    return subvolume(system.indicesFluidPhases());
 }
 
 auto ChemicalProperties::solidVolume() const -> ChemicalScalar
 {
-    const Indices iphases = system.indicesSolidPhases();
-    return sum(rows(phaseVolumes(), iphases));
+    return subvolume(system.indicesSolidPhases());
+}
+
+auto ChemicalProperties::phaseMassValues() const -> VectorConstRef
+{
+    return updatePhaseQuantityValues().mass_values;
+}
+
+auto ChemicalProperties::phaseAmountValues() const -> VectorConstRef
+{
+    return updatePhaseQuantityValues().amount_values;
+}
+
+auto ChemicalProperties::phaseMolarVolumeValues() const -> VectorConstRef
+{
+    return updatePhaseQuantityValues().molar_volume_values;
+}
+
+auto ChemicalProperties::phaseVolumeValues() const -> VectorConstRef
+{
+    return updatePhaseQuantityValues().volume_values;
+}
+
+auto ChemicalProperties::phaseDensityValues() const -> Vector
+{
+    const PhaseQuantities& q = updatePhaseQuantityValues();
+    return q.mass_values.array()/q.volume_values.array();
+}
+
+auto ChemicalProperties::volumeValue() const -> double
+{
+    return phaseVolumeValues().sum();
+}
+
+auto ChemicalProperties::subvolumeValue(const Indices& iphases) const -> double
+{
+    VectorConstRef v = phaseVolumeValues();
+    double res = 0.0;
+    for(Index iphase : iphases)
+        res += v[iphase];
+    return res;
+}
+
+auto ChemicalProperties::fluidVolumeValue() const -> double
+{
+    return subvolumeValue(system.indicesFluidPhases());
+}
+
+auto ChemicalProperties::solidVolumeValue() const -> double
+{
+    return subvolumeValue(system.indicesSolidPhases());
+}
+
+auto ChemicalProperties::updatePhaseQuantities() const -> const PhaseQuantities&
+{
+    PhaseQuantities& q = *phase_quantities;
+
+    if(!q.outdated.load(std::memory_order_acquire))
+        return q;
+
+    std::lock_guard<std::mutex> lock(q.mutex);
+
+    // Check again, since another reader may have computed the phase quantities while this one waited for the lock
+    if(!q.outdated.load(std::memory_order_relaxed))
+        return q;
+
+    const auto nc = Composition(n);
+    q.amounts = ChemicalVector(num_phases, num_species);
+    q.masses = ChemicalVector(num_phases, num_species);
+    q.molar_volumes = ChemicalVector(num_phases, num_species);
+    Index ispecies = 0;
+    for(Index iphase = 0; iphase < num_phases; ++iphase)
+    {
+        const auto nspecies = system.numSpeciesInPhase(iphase);
+        const auto np = rows(nc, ispecies, ispecies, nspecies, nspecies);
+        const auto mmp = rows(molar_masses, ispecies, nspecies);
+        const auto tp = tres.phaseProperties(iphase, ispecies, nspecies);
+        const auto cp = cres.phaseProperties(iphase, ispecies, nspecies);
+        row(q.amounts, iphase, ispecies, nspecies) = sum(np);
+        row(q.masses, iphase, ispecies, nspecies) = sum(mmp % np);
+        if(cp.molar_volume > 0.0)
+            row(q.molar_volumes, iphase, ispecies, nspecies) = cp.molar_volume;
+        else
+        {
+            const auto xp = x.block(ispecies, nspecies);
+            row(q.molar_volumes, iphase, ispecies, nspecies) = sum(xp % tp.standard_partial_molar_volumes);
+        }
+        ispecies += nspecies;
+    }
+    q.volumes = q.amounts % q.molar_volumes;
+    q.outdated.store(false, std::memory_order_release);
+    return q;
+}
+
+auto ChemicalProperties::updatePhaseQuantityValues() const -> const PhaseQuantities&
+{
+    PhaseQuantities& q = *phase_quantities;
+
+    if(!q.values_outdated.load(std::memory_order_acquire))
+        return q;
+
+    std::lock_guard<std::mutex> lock(q.mutex);
+
+    // Check again, since another reader may have computed the values while this one waited for the lock
+    if(!q.values_outdated.load(std::memory_order_relaxed))
+        return q;
+
+    // Reuse the values of the phase quantities if these have already been computed with their derivatives
+    if(!q.outdated.load(std::memory_order_relaxed))
+    {
+        q.amount_values = q.amounts.val;
+        q.mass_values = q.masses.val;
+        q.molar_volume_values = q.molar_volumes.val;
+        q.volume_values = q.volumes.val;
+        q.values_outdated.store(false, std::memory_order_release);
+        return q;
+    }
+
+    q.amount_values.resize(num_phases);
+    q.mass_values.resize(num_phases);
+    q.molar_volume_values.resize(num_phases);
+    Index ispecies = 0;
+    for(Index iphase = 0; iphase < num_phases; ++iphase)
+    {
+        const auto nspecies = system.numSpeciesInPhase(iphase);
+        const auto np = rows(n, ispecies, nspecies);
+        const auto mmp = rows(molar_masses, ispecies, nspecies);
+        const auto molar_volume = cres.phaseProperties(iphase, ispecies, nspecies).molar_volume.val;
+        q.amount_values[iphase] = np.sum();
+        q.mass_values[iphase] = mmp.dot(np);
+        if(molar_volume > 0.0)
+            q.molar_volume_values[iphase] = molar_volume;
+        else
+        {
+            const auto xp = rows(x.val, ispecies, nspecies);
+            const auto vp = rows(tres.standardPartialMolarVolumes().val, ispecies, nspecies);
+            q.molar_volume_values[iphase] = xp.dot(vp);
+        }
+        ispecies += nspecies;
+    }
+    q.volume_values = q.amount_values.array() * q.molar_volume_values.array();
+    q.values_outdated.store(false, std::memory_order_release);
+    return q;
+}
+
+auto ChemicalProperties::resetPhaseQuantities() -> void
+{
+    // Copies of this instance may still read the current phase quantities, so these are only reused if not shared
+    if(phase_quantities.use_count() == 1)
+    {
+        phase_quantities->outdated = true;
+        phase_quantities->values_outdated = true;
+    }
+    else phase_quantities = std::make_shared<PhaseQuantities>();
 }
 
 } // namespace Reaktoro
@@ -17,7 +17,11 @@
 
 #pragma once
 
+// C++ includes
+#include <memory>
+
 // Reaktoro includes
+#include <Reaktoro/Common/BlockDiagonalChemicalVector.hpp>
 #include <Reaktoro/Common/ChemicalScalar.hpp>
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/ThermoScalar.hpp>
@@ -77,19 +81,19 @@ public:
     auto chemicalModelResult() const -> const ChemicalModelResult&;
 
     /// Return the mole fractions of the species.
-    auto moleFractions() const -> ChemicalVector;
+    auto moleFractions() const -> const BlockDiagonalChemicalVector&;
 
     /// Return the ln activity coefficients of the species.
-    auto lnActivityCoefficients() const -> ChemicalVectorConstRef;
+    auto lnActivityCoefficients() const -> const BlockDiagonalChemicalVector&;
 
     /// Return the ln activity constants of the species.
     auto lnActivityConstants() const -> ThermoVectorConstRef;
 
     /// Return the ln activities of the species.
-    auto lnActivities() const -> ChemicalVectorConstRef;
+    auto lnActivities() const -> const BlockDiagonalChemicalVector&;
 
     /// Return the partial molar volume of the species in that phase (in units of m3/mol).
-    auto partialMolarVolumes() const -> ChemicalVectorConstRef;
+    auto partialMolarVolumes() const -> const BlockDiagonalChemicalVector&;
 
     /// Return the chemical potentials of the species (in units of J/mol).
     auto chemicalPotentials() const -> ChemicalVector;
@@ -125,7 +129,7 @@ public:
     auto phaseMolarEnthalpies() const -> ChemicalVector;
 
     /// Return the molar volumes of the phases (in units of m3/mol).
-    auto phaseMolarVolumes() const -> ChemicalVector;
+    auto phaseMolarVolumes() const -> const ChemicalVector&;
 
     /// Return the molar entropies of the phases (in units of J/(mol*K)).
     auto phaseMolarEntropies() const -> ChemicalVector;
@@ -170,13 +174,13 @@ public:
     auto phaseDensities() const -> ChemicalVector;
 
     /// Return the masses of the phases (in units of kg).
-    auto phaseMasses() const -> ChemicalVector;
+    auto phaseMasses() const -> const ChemicalVector&;
 
     /// Return the molar amounts of the phases (in units of mol).
-    auto phaseAmounts() const -> ChemicalVector;
+    auto phaseAmounts() const -> const ChemicalVector&;
 
     /// Return the volumes of the phases (in units of m3).
-    auto phaseVolumes() const -> ChemicalVector;
+    auto phaseVolumes() const -> const ChemicalVector&;
 
     /// Return the volume of the system (in units of m3).
     auto volume() const -> ChemicalScalar;
@@ -193,6 +197,34 @@ public:
     /// The solid volume is defined as the sum of volumes of all solid phases.
     auto solidVolume() const -> ChemicalScalar;
 
+    /// Return the masses of the phases without their derivatives (in units of kg).
+    auto phaseMassValues() const -> VectorConstRef;
+
+    /// Return the molar amounts of the phases without their derivatives (in units of mol).
+    auto phaseAmountValues() const -> VectorConstRef;
+
+    /// Return the molar volumes of the phases without their derivatives (in units of m3/mol).
+    auto phaseMolarVolumeValues() const -> VectorConstRef;
+
+    /// Return the volumes of the phases without their derivatives (in units of m3).
+    auto phaseVolumeValues() const -> VectorConstRef;
+
+    /// Return the densities of the phases without their derivatives (in units of kg/m3).
+    auto phaseDensityValues() const -> Vector;
+
+    /// Return the volume of the system without its derivatives (in units of m3).
+    auto volumeValue() const -> double;
+
+    /// Return the total volume occupied by given phases without its derivatives (in units of m3).
+    /// @param iphases The indices of the phases.
+    auto subvolumeValue(const Indices& iphases) const -> double;
+
+    /// Return the total fluid volume of the system without its derivatives (in units of m3).
+    auto fluidVolumeValue() const -> double;
+
+    /// Return the total solid volume of the system without its derivatives (in units of m3).
+    auto solidVolumeValue() const -> double;
+
 private:
     /// The chemical system
     ChemicalSystem system;
@@ -213,13 +245,32 @@ private:
     Vector n;
 
     /// The mole fractions of the species in the system (in units of mol/mol).
-    ChemicalVector x;
+    BlockDiagonalChemicalVector x;
 
     /// The results of the evaluation of the PhaseThermoModel functions of each phase.
     ThermoModelResult tres;
 
     /// The results of the evaluation of the PhaseChemicalModel functions of each phase.
     ChemicalModelResult cres;
+
+    /// The molar masses of the species (in units of kg/mol).
+    Vector molar_masses;
+
+    /// The amounts, masses, molar volumes and volumes of the phases, computed on demand after each update.
+    struct PhaseQuantities;
+
+    /// The phase quantities of the last update, shared by copies of this instance.
+    /// These are computed under a lock, so that concurrent reads of a shared instance are safe.
+    std::shared_ptr<PhaseQuantities> phase_quantities;
+
+    /// Return the amounts, masses, molar volumes and volumes of the phases with their derivatives, computing them if outdated.
+    auto updatePhaseQuantities() const -> const PhaseQuantities&;
+
+    /// Return the values of the amounts, masses, molar volumes and volumes of the phases, computing them if outdated.
+    auto updatePhaseQuantityValues() const -> const PhaseQuantities&;
+
+    /// Mark the phase quantities as outdated after an update.
+    auto resetPhaseQuantities() -> void;
 };
 
 } // namespace Reaktoro
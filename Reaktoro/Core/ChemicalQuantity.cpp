@@ -159,8 +159,14 @@ struct ChemicalQuantity::Impl
     /// The thermodynamic properties of the chemical system at (*T*, *P*, **n**)
     ChemicalProperties properties;
 
+    /// The flag that indicates if `properties` needs to be recomputed before its next use
+    bool properties_outdated = false;
+
+    /// The flag that indicates if `rates` needs to be recomputed before its next use
+    bool rates_outdated = false;
+
     /// The progress variable at which the chemical state is referred (if time, in units of s)
-    double tag;
+    double tag = 0.0;
 
     /// The temperature of the chemical system (in units of K).
     double T;
@@ -181,13 +187,13 @@ struct ChemicalQuantity::Impl
 
     /// Construct a custom Impl instance with given ChemicalSystem object
     explicit Impl(const ChemicalSystem& system)
-    : system(system), state(system)
+    : system(system), state(system), properties(system)
     {
     }
 
     /// Construct a custom Impl instance with given ReactionSystem object
     Impl(const ReactionSystem& reactions)
-    : system(reactions.system()), state(system), reactions(reactions)
+    : system(reactions.system()), state(system), reactions(reactions), properties(system)
     {
     }
 
@@ -211,12 +217,29 @@ struct ChemicalQuantity::Impl
         P = state.pressure();
         n = state.speciesAmounts();
 
-        // Update the thermodynamic properties of the system
-        properties = system.properties(T, P, n);
+        // Mark the thermodynamic properties and reaction rates for lazy evaluation,
+        // so that quantities depending only on the chemical state do not pay for them
+        properties_outdated = true;
+        rates_outdated = true;
+    }
 
-        // Update the rates of the reactions
-        if(!reactions.reactions().empty())
-            rates = reactions.rates(properties);
+    /// Return the thermodynamic properties of the system, computing them only if outdated
+    auto updatedProperties() -> const ChemicalProperties&
+    {
+        // The standard thermodynamic properties are only recomputed if (T, P) have changed
+        if(properties_outdated)
+            properties.update(T, P, n);
+        properties_outdated = false;
+        return properties;
+    }
+
+    /// Return the rates of the reactions, computing them only if outdated
+    auto updatedRates() -> const ChemicalVector&
+    {
+        if(rates_outdated && !reactions.reactions().empty())
+            rates = reactions.rates(updatedProperties());
+        rates_outdated = false;
+        return rates;
     }
 
     auto function(const ChemicalQuantity& quantity, std::string str) -> const Function&
@@ -277,12 +300,12 @@ auto ChemicalQuantity::state() const -> const ChemicalState&
 
 auto ChemicalQuantity::properties() const -> const ChemicalProperties&
 {
-    return pimpl->properties;
+    return pimpl->updatedProperties();
 }
 
 auto ChemicalQuantity::rates() const -> const ChemicalVector&
 {
-    return pimpl->rates;
+    return pimpl->updatedRates();
 }
 
 auto ChemicalQuantity::tag() const -> double
@@ -398,7 +421,7 @@ auto volume(const ChemicalQuantity& quantity, std::string arguments) -> std::fun
     auto func = [=]() -> double
     {
         const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.volume().val;
+        const double val = properties.volumeValue();
         return factor * val;
     };
     return func;
@@ -593,7 +616,7 @@ auto elementMolarity(const ChemicalQuantity& quantity, std::string arguments) ->
         const ChemicalProperties& properties = quantity.properties();
         const ChemicalState& state = quantity.state();
         const double amount = state.elementAmountInPhase(ielement, iphase);
-        const double volume = properties.phaseVolumes()[iphase].val;
+        const double volume = properties.phaseVolumeValues()[iphase];
         const double liter = convertCubicMeterToLiter(volume);
         const double ci = liter ? amount/liter : 0.0;
         return factor * ci;
@@ -670,7 +693,7 @@ auto speciesMolarity(const ChemicalQuantity& quantity, std::string arguments) ->
         const ChemicalProperties& properties = quantity.properties();
         const ChemicalState& state = quantity.state();
         const double amount = state.speciesAmount(ispecies);
-        const double volume = properties.phaseVolumes()[iphase].val;
+        const double volume = properties.phaseVolumeValues()[iphase];
         const double liter = convertCubicMeterToLiter(volume);
         const double ci = liter ? amount/liter : 0.0;
         return factor * ci;
@@ -689,7 +712,7 @@ auto phaseAmount(const ChemicalQuantity& quantity, std::string arguments) -> std
     auto func = [=]() -> double
     {
         const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.phaseAmounts().val[iphase];
+        const double val = properties.phaseAmountValues()[iphase];
         return factor * val;
     };
     return func;
@@ -706,7 +729,7 @@ auto phaseMass(const ChemicalQuantity& quantity, std::string arguments) -> std::
     auto func = [=]() -> double
     {
         const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.phaseMasses().val[iphase];
+        const double val = properties.phaseMassValues()[iphase];
         return factor * val;
     };
     return func;
@@ -723,7 +746,7 @@ auto phaseVolume(const ChemicalQuantity& quantity, std::string arguments) -> std
     auto func = [=]() -> double
     {
         const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.phaseVolumes().val[iphase];
+        const double val = properties.phaseVolumeValues()[iphase];
         return factor * val;
     };
     return func;
@@ -785,7 +808,7 @@ auto fluidVolume(const ChemicalQuantity& quantity, std::string arguments) -> std
     auto func = [=]() -> double
     {
         const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.fluidVolume().val;
+        const double val = properties.fluidVolumeValue();
         return factor * val;
     };
     return func;
@@ -797,8 +820,8 @@ auto fluidVolumeFraction(const ChemicalQuantity& quantity, std::string arguments
     auto func = [=]() -> double
     {
         const ChemicalProperties& properties = quantity.properties();
-        const double volume = properties.volume().val;
-        const double fluid_volume = properties.fluidVolume().val;
+        const double volume = properties.volumeValue();
+        const double fluid_volume = properties.fluidVolumeValue();
         return fluid_volume/volume;
     };
     return func;
@@ -812,7 +835,7 @@ auto solidVolume(const ChemicalQuantity& quantity, std::string arguments) -> std
     auto func = [=]() -> double
     {
         const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.solidVolume().val;
+        const double val = properties.solidVolumeValue();
         return factor * val;
     };
     return func;
@@ -824,8 +847,8 @@ auto solidVolumeFraction(const ChemicalQuantity& quantity, std::string arguments
     auto func = [=]() -> double
     {
         const ChemicalProperties& properties = quantity.properties();
-        const double volume = properties.volume().val;
-        const double solid_volume = properties.solidVolume().val;
+        const double volume = properties.volumeValue();
+        const double solid_volume = properties.solidVolumeValue();
         return solid_volume/volume;
     };
     return func;
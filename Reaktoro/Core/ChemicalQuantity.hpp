@@ -127,9 +127,11 @@ public:
     auto state() const -> const ChemicalState&;
 
     /// Return the chemical properties of the ChemicalQuantity instance.
+    /// These are only computed on the first call after an update.
     auto properties() const -> const ChemicalProperties&;
 
     /// Return the reaction rates of the ChemicalQuantity instance.
+    /// These are only computed on the first call after an update.
     auto rates() const -> const ChemicalVector&;
 
     /// Return the tag variable of the ChemicalQuantity instance.
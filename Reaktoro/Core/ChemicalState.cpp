@@ -18,6 +18,7 @@
 #include "ChemicalState.hpp"
 
 // C++ includes
+#include <atomic>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -54,8 +55,17 @@ struct ChemicalState::Impl
     /// The dual chemical potentials of the species (in units of J/mol)
     Vector z;
 
+    /// The chemical properties of the system at (*T*, *P*, **n**), computed on demand (null if outdated)
+    mutable std::shared_ptr<const ChemicalProperties> properties_cache;
+
     Impl() = delete;
 
+    /// Construct a copy of a ChemicalState::Impl instance, which shares the computed properties of the other
+    Impl(const Impl& other)
+    : system(other.system), T(other.T), P(other.P), n(other.n), y(other.y), z(other.z),
+      properties_cache(std::atomic_load(&other.properties_cache))
+    {}
+
     /// Construct a custom ChemicalState::Impl instance
     explicit Impl(const ChemicalSystem& system)
     : system(system)
@@ -66,11 +76,19 @@ struct ChemicalState::Impl
         z = zeros(system.numSpecies());
     }
 
+    /// Mark the computed properties as outdated.
+    /// The cache is accessed atomically everywhere, since copies of this state may compute the properties concurrently.
+    auto resetProperties() -> void
+    {
+        std::atomic_store(&properties_cache, std::shared_ptr<const ChemicalProperties>());
+    }
+
     auto setTemperature(double val) -> void
     {
         Assert(val > 0.0, "Cannot set temperature of the chemical "
             "state with a non-positive value.", "");
         T = val;
+        resetProperties();
     }
 
     auto setTemperature(double val, std::string units) -> void
@@ -83,6 +101,7 @@ struct ChemicalState::Impl
         Assert(val > 0.0, "Cannot set pressure of the chemical "
             "state with a non-positive value.", "");
         P = val;
+        resetProperties();
     }
 
     auto setPressure(double val, std::string units) -> void
@@ -96,6 +115,7 @@ struct ChemicalState::Impl
             "Cannot set the molar amounts of the species.",
             "The given molar abount is negative.");
         n.fill(val);
+        resetProperties();
     }
 
     auto setSpeciesAmounts(VectorConstRef values) -> void
@@ -105,6 +125,7 @@ struct ChemicalState::Impl
             "The dimension of the molar abundance vector "
             "is different than the number of species.");
         n = values;
+        resetProperties();
     }
 
     auto setSpeciesAmounts(VectorConstRef values, const Indices& indices) -> void
@@ -114,6 +135,7 @@ struct ChemicalState::Impl
             "The dimension of the molar abundance vector "
             "is different than the number of indices.");
         n(indices) = values;
+        resetProperties();
     }
 
     auto setSpeciesAmount(Index index, double amount) -> void
@@ -125,6 +147,7 @@ struct ChemicalState::Impl
             "Cannot set the molar amount of the species.",
             "The given species index is out-of-range.");
         n[index] = amount;
+        resetProperties();
     }
 
     auto setSpeciesAmount(std::string species, double amount) -> void
@@ -227,9 +250,8 @@ struct ChemicalState::Impl
             "The given volume is negative.");
         Assert(index < system.numPhases(), "Cannot set the volume of the phase.",
             "The given phase index is out of range.");
-        ChemicalProperties properties = system.properties(T, P, n);
-        const Vector v = properties.phaseVolumes().val;
-        const double scalar = (v[index] != 0.0) ? volume/v[index] : 0.0;
+        const double v = properties()->phaseVolumeValues()[index];
+        const double scalar = (v != 0.0) ? volume/v : 0.0;
         scaleSpeciesAmountsInPhase(index, scalar);
     }
 
@@ -253,8 +275,8 @@ struct ChemicalState::Impl
 
     auto scaleFluidVolume(double volume) -> void
     {
-        const auto& fluid_volume = properties().fluidVolume();
-        const auto& factor = fluid_volume.val ? volume/fluid_volume.val : 0.0;
+        const auto& fluid_volume = properties()->fluidVolumeValue();
+        const auto& factor = fluid_volume ? volume/fluid_volume : 0.0;
         const auto& ifluidspecies = system.indicesFluidSpecies();
         scaleSpeciesAmounts(factor, ifluidspecies);
     }
@@ -267,8 +289,8 @@ struct ChemicalState::Impl
 
     auto scaleSolidVolume(double volume) -> void
     {
-        const auto& solid_volume = properties().solidVolume();
-        const auto& factor = solid_volume.val ? volume/solid_volume.val : 0.0;
+        const auto& solid_volume = properties()->solidVolumeValue();
+        const auto& factor = solid_volume ? volume/solid_volume : 0.0;
         const auto& isolidspecies = system.indicesSolidSpecies();
         scaleSpeciesAmounts(factor, isolidspecies);
     }
@@ -283,9 +305,7 @@ struct ChemicalState::Impl
     {
         Assert(volume >= 0.0, "Cannot set the volume of the chemical state.",
             "The given volume is negative.");
-        ChemicalProperties properties = system.properties(T, P, n);
-        const Vector v = properties.phaseVolumes().val;
-        const double vtotal = sum(v);
+        const double vtotal = properties()->volumeValue();
         const double scalar = (vtotal != 0.0) ? volume/vtotal : 0.0;
         scaleSpeciesAmounts(scalar);
     }
@@ -411,11 +431,22 @@ struct ChemicalState::Impl
         return units::convert(phaseAmount(name), "mol", units);
     }
 
-    auto properties() const -> ChemicalProperties
+    auto properties() const -> std::shared_ptr<const ChemicalProperties>
     {
-        ChemicalProperties res(system);
-        res.update(T, P, n);
-        return res;
+        auto cached = std::atomic_load(&properties_cache);
+        if(cached)
+            return cached;
+
+        auto computed = std::make_shared<ChemicalProperties>(system);
+        computed->update(T, P, n);
+
+        // Copies of this state may share this instance and compute the properties concurrently,
+        // so only the first computed properties are stored and returned by every caller
+        std::shared_ptr<const ChemicalProperties> snapshot = computed;
+        std::shared_ptr<const ChemicalProperties> expected;
+        if(std::atomic_compare_exchange_strong(&properties_cache, &expected, snapshot))
+            return snapshot;
+        return expected;
     }
 
     // Return the stability indices of the phases
@@ -466,10 +497,9 @@ ChemicalState::ChemicalState(const ChemicalSystem& system)
 {}
 
 ChemicalState::ChemicalState(const ChemicalState& other)
-: pimpl(new Impl(*other.pimpl))
+: pimpl(other.pimpl)
 {}
 
-//It needs Imp implementation because of its std::unique_ptr.
 ChemicalState::~ChemicalState() = default;
 
 auto ChemicalState::operator=(ChemicalState other) -> ChemicalState&
@@ -478,149 +508,156 @@ auto ChemicalState::operator=(ChemicalState other) -> ChemicalState&
     return *this;
 }
 
+auto ChemicalState::mutableImpl() -> Impl&
+{
+    if(pimpl.use_count() > 1)
+        pimpl = std::make_shared<Impl>(*pimpl);
+    return *pimpl;
+}
+
 auto ChemicalState::setTemperature(double val) -> void
 {
-    pimpl->setTemperature(val);
+    mutableImpl().setTemperature(val);
 }
 
 auto ChemicalState::setTemperature(double val, std::string units) -> void
 {
-    pimpl->setTemperature(val, units);
+    mutableImpl().setTemperature(val, units);
 }
 
 auto ChemicalState::setPressure(double val) -> void
 {
-    pimpl->setPressure(val);
+    mutableImpl().setPressure(val);
 }
 
 auto ChemicalState::setPressure(double val, std::string units) -> void
 {
-    pimpl->setPressure(val, units);
+    mutableImpl().setPressure(val, units);
 }
 
 auto ChemicalState::setSpeciesAmounts(double val) -> void
 {
-    pimpl->setSpeciesAmounts(val);
+    mutableImpl().setSpeciesAmounts(val);
 }
 
 auto ChemicalState::setSpeciesAmounts(VectorConstRef n) -> void
 {
-    pimpl->setSpeciesAmounts(n);
+    mutableImpl().setSpeciesAmounts(n);
 }
 
 auto ChemicalState::setSpeciesAmounts(VectorConstRef n, const Indices& indices) -> void
 {
-    pimpl->setSpeciesAmounts(n, indices);
+    mutableImpl().setSpeciesAmounts(n, indices);
 }
 
 auto ChemicalState::setSpeciesAmount(Index index, double amount) -> void
 {
-    pimpl->setSpeciesAmount(index, amount);
+    mutableImpl().setSpeciesAmount(index, amount);
 }
 
 auto ChemicalState::setSpeciesAmount(std::string species, double amount) -> void
 {
-    pimpl->setSpeciesAmount(species, amount);
+    mutableImpl().setSpeciesAmount(species, amount);
 }
 
 auto ChemicalState::setSpeciesAmount(Index index, double amount, std::string units) -> void
 {
-    pimpl->setSpeciesAmount(index, amount, units);
+    mutableImpl().setSpeciesAmount(index, amount, units);
 }
 
 auto ChemicalState::setSpeciesAmount(std::string species, double amount, std::string units) -> void
 {
-    pimpl->setSpeciesAmount(species, amount, units);
+    mutableImpl().setSpeciesAmount(species, amount, units);
 }
 
 auto ChemicalState::setSpeciesMass(Index index, double mass) -> void
 {
-    pimpl->setSpeciesMass(index, mass);
+    mutableImpl().setSpeciesMass(index, mass);
 }
 
 auto ChemicalState::setSpeciesMass(std::string name, double mass) -> void
 {
-    pimpl->setSpeciesMass(name, mass);
+    mutableImpl().setSpeciesMass(name, mass);
 }
 
 auto ChemicalState::setSpeciesMass(Index index, double mass, std::string units) -> void
 {
-    pimpl->setSpeciesMass(index, mass, units);
+    mutableImpl().setSpeciesMass(index, mass, units);
 }
 
 auto ChemicalState::setSpeciesMass(std::string name, double mass, std::string units) -> void
 {
-    pimpl->setSpeciesMass(name, mass, units);
+    mutableImpl().setSpeciesMass(name, mass, units);
 }
 
 auto ChemicalState::setSpeciesDualPotentials(VectorConstRef z) -> void
 {
-    pimpl->setSpeciesDualPotentials(z);
+    mutableImpl().setSpeciesDualPotentials(z);
 }
 
 auto ChemicalState::setElementDualPotentials(VectorConstRef y) -> void
 {
-    pimpl->setElementDualPotentials(y);
+    mutableImpl().setElementDualPotentials(y);
 }
 
 auto ChemicalState::scaleSpeciesAmounts(double scalar) -> void
 {
-    pimpl->scaleSpeciesAmounts(scalar);
+    mutableImpl().scaleSpeciesAmounts(scalar);
 }
 
 auto ChemicalState::scaleSpeciesAmountsInPhase(Index index, double scalar) -> void
 {
-    pimpl->scaleSpeciesAmountsInPhase(index, scalar);
+    mutableImpl().scaleSpeciesAmountsInPhase(index, scalar);
 }
 
 auto ChemicalState::scalePhaseVolume(Index index, double volume) -> void
 {
-    pimpl->scalePhaseVolume(index, volume);
+    mutableImpl().scalePhaseVolume(index, volume);
 }
 
 auto ChemicalState::scalePhaseVolume(Index index, double volume, std::string units) -> void
 {
-    pimpl->scalePhaseVolume(index, volume, units);
+    mutableImpl().scalePhaseVolume(index, volume, units);
 }
 
 auto ChemicalState::scalePhaseVolume(std::string name, double volume) -> void
 {
-    pimpl->scalePhaseVolume(name, volume);
+    mutableImpl().scalePhaseVolume(name, volume);
 }
 
 auto ChemicalState::scalePhaseVolume(std::string name, double volume, std::string units) -> void
 {
-    pimpl->scalePhaseVolume(name, volume, units);
+    mutableImpl().scalePhaseVolume(name, volume, units);
 }
 
 auto ChemicalState::scaleFluidVolume(double volume) -> void
 {
-    pimpl->scaleFluidVolume(volume);
+    mutableImpl().scaleFluidVolume(volume);
 }
 
 auto ChemicalState::scaleFluidVolume(double volume, std::string units) -> void
 {
-    pimpl->scaleFluidVolume(volume, units);
+    mutableImpl().scaleFluidVolume(volume, units);
 }
 
 auto ChemicalState::scaleSolidVolume(double volume) -> void
 {
-    pimpl->scaleSolidVolume(volume);
+    mutableImpl().scaleSolidVolume(volume);
 }
 
 auto ChemicalState::scaleSolidVolume(double volume, std::string units) -> void
 {
-    pimpl->scaleSolidVolume(volume, units);
+    mutableImpl().scaleSolidVolume(volume, units);
 }
 
 auto ChemicalState::scaleVolume(double volume) -> void
 {
-    pimpl->scaleVolume(volume);
+    mutableImpl().scaleVolume(volume);
 }
 
 auto ChemicalState::scaleVolume(double volume, std::string units) -> void
 {
-    pimpl->scaleVolume(volume, units);
+    mutableImpl().scaleVolume(volume, units);
 }
 
 auto ChemicalState::system() const -> const ChemicalSystem&
@@ -770,7 +807,7 @@ auto ChemicalState::phaseStabilityIndices() const -> Vector
 
 auto ChemicalState::properties() const -> ChemicalProperties
 {
-    return pimpl->properties();
+    return *pimpl->properties();
 }
 
 auto ChemicalState::output(std::ostream& out, int precision) const -> void
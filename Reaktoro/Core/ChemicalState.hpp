@@ -71,7 +71,9 @@ public:
     /// @param system The chemical system instance
     explicit ChemicalState(const ChemicalSystem& system);
 
-    /// Construct a copy of a ChemicalState instance
+    /// Construct a copy of a ChemicalState instance.
+    /// The copy shares the data of `other` until either of them is modified (copy-on-write),
+    /// so that copying a chemical state does not allocate memory.
     ChemicalState(const ChemicalState& other);
 
     /// Destroy the instance
@@ -366,6 +368,9 @@ public:
     auto phaseStabilityIndices() const -> Vector;
 
     /// Return the chemical properties of the system.
+    /// The properties are computed on the first call and reused until the temperature, pressure,
+    /// or amounts of the species are changed. The returned properties are a copy of the cached ones,
+    /// so these remain valid after the state is modified.
     auto properties() const -> ChemicalProperties;
 
     /// Output the ChemicalState instance to a stream.
@@ -377,7 +382,10 @@ public:
 private:
     struct Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    /// Return the implementation of this instance for modification, copying it first if shared with other instances.
+    auto mutableImpl() -> Impl&;
+
+    std::shared_ptr<Impl> pimpl;
 };
 
 /// Outputs a ChemicalState instance.
@@ -0,0 +1,197 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalStateBatch.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+
+namespace Reaktoro {
+
+auto ChemicalStateView::system() const -> const ChemicalSystem&
+{
+    return batch->system();
+}
+
+auto ChemicalStateView::setTemperature(double val) -> void
+{
+    Assert(val > 0.0, "Cannot set temperature of the chemical "
+        "state with a non-positive value.", "");
+    batch->temperatures()[icell] = val;
+}
+
+auto ChemicalStateView::setPressure(double val) -> void
+{
+    Assert(val > 0.0, "Cannot set pressure of the chemical "
+        "state with a non-positive value.", "");
+    batch->pressures()[icell] = val;
+}
+
+auto ChemicalStateView::setSpeciesAmounts(VectorConstRef n) -> void
+{
+    Assert(n.rows() == batch->speciesAmounts().rows(),
+        "Cannot set the molar amounts of the species.",
+        "The dimension of the molar abundance vector "
+        "is different than the number of species.");
+    batch->speciesAmounts().col(icell) = n;
+}
+
+auto ChemicalStateView::temperature() const -> double
+{
+    return batch->temperatures()[icell];
+}
+
+auto ChemicalStateView::pressure() const -> double
+{
+    return batch->pressures()[icell];
+}
+
+auto ChemicalStateView::speciesAmounts() -> VectorRef
+{
+    return batch->speciesAmounts().col(icell);
+}
+
+auto ChemicalStateView::speciesAmounts() const -> VectorConstRef
+{
+    const ChemicalStateBatch& cbatch = *batch;
+    return cbatch.speciesAmounts().col(icell);
+}
+
+auto ChemicalStateView::speciesAmount(Index index) const -> double
+{
+    return batch->speciesAmounts()(index, icell);
+}
+
+auto ChemicalStateView::elementDualPotentials() -> VectorRef
+{
+    return batch->elementDualPotentials().col(icell);
+}
+
+auto ChemicalStateView::elementDualPotentials() const -> VectorConstRef
+{
+    const ChemicalStateBatch& cbatch = *batch;
+    return cbatch.elementDualPotentials().col(icell);
+}
+
+auto ChemicalStateView::speciesDualPotentials() -> VectorRef
+{
+    return batch->speciesDualPotentials().col(icell);
+}
+
+auto ChemicalStateView::speciesDualPotentials() const -> VectorConstRef
+{
+    const ChemicalStateBatch& cbatch = *batch;
+    return cbatch.speciesDualPotentials().col(icell);
+}
+
+auto ChemicalStateView::elementAmounts() const -> Vector
+{
+    return system().elementAmounts(speciesAmounts());
+}
+
+auto ChemicalStateView::elementAmountsInSpecies(const Indices& indices) const -> Vector
+{
+    return system().elementAmountsInSpecies(indices, speciesAmounts());
+}
+
+auto ChemicalStateView::operator=(const ChemicalState& state) -> ChemicalStateView&
+{
+    batch->set(icell, state);
+    return *this;
+}
+
+ChemicalStateView::operator ChemicalState() const
+{
+    return batch->state(icell);
+}
+
+ChemicalStateBatch::ChemicalStateBatch()
+{}
+
+ChemicalStateBatch::ChemicalStateBatch(Index size, const ChemicalSystem& system)
+: ChemicalStateBatch(size, ChemicalState(system))
+{}
+
+ChemicalStateBatch::ChemicalStateBatch(Index size, const ChemicalState& state)
+: m_system(state.system()),
+  m_temperatures(size),
+  m_pressures(size),
+  m_n(m_system.numSpecies(), size),
+  m_y(m_system.numElements(), size),
+  m_z(m_system.numSpecies(), size)
+{
+    set(state);
+}
+
+auto ChemicalStateBatch::set(const ChemicalState& state) -> void
+{
+    m_temperatures.fill(state.temperature());
+    m_pressures.fill(state.pressure());
+    m_n.colwise() = state.speciesAmounts();
+    m_y.colwise() = state.elementDualPotentials();
+    m_z.colwise() = state.speciesDualPotentials();
+}
+
+auto ChemicalStateBatch::set(Index icell, const ChemicalState& state) -> void
+{
+    Assert(icell < size(),
+        "Cannot set the chemical state of a cell in the batch.",
+        "The given cell index is out-of-range.");
+    m_temperatures[icell] = state.temperature();
+    m_pressures[icell] = state.pressure();
+    m_n.col(icell) = state.speciesAmounts();
+    m_y.col(icell) = state.elementDualPotentials();
+    m_z.col(icell) = state.speciesDualPotentials();
+}
+
+auto ChemicalStateBatch::get(Index icell, ChemicalState& state) const -> void
+{
+    Assert(icell < size(),
+        "Cannot get the chemical state of a cell in the batch.",
+        "The given cell index is out-of-range.");
+    state.setTemperature(m_temperatures[icell]);
+    state.setPressure(m_pressures[icell]);
+    state.setSpeciesAmounts(m_n.col(icell));
+    state.setElementDualPotentials(m_y.col(icell));
+    state.setSpeciesDualPotentials(m_z.col(icell));
+}
+
+auto ChemicalStateBatch::state(Index icell) const -> ChemicalState
+{
+    ChemicalState res(m_system);
+    get(icell, res);
+    return res;
+}
+
+auto ChemicalStateBatch::elementAmounts() const -> Matrix
+{
+    return m_system.formulaMatrix() * m_n;
+}
+
+auto ChemicalStateBatch::elementAmountsInSpecies(const Indices& indices) const -> Matrix
+{
+    // The formula matrix with the columns of the species not in the group set to zero,
+    // so that the amounts of the elements in every cell are given by a single dense product
+    MatrixConstRef W = m_system.formulaMatrix();
+    Matrix Wg = zeros(W.rows(), W.cols());
+    for(Index i : indices)
+        Wg.col(i) = W.col(i);
+    return Wg * m_n;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,220 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class ChemicalStateBatch;
+
+/// A lightweight view of the chemical state of a single cell in a ChemicalStateBatch instance.
+/// The view does not own any data. Its accessors have the same names as those of ChemicalState,
+/// and they read from and write to the contiguous arrays of the batch directly.
+/// @see ChemicalStateBatch
+/// @ingroup Core
+class ChemicalStateView
+{
+public:
+    /// Construct a ChemicalStateView instance of a cell in a batch of chemical states.
+    ChemicalStateView(ChemicalStateBatch& batch, Index icell) : batch(&batch), icell(icell) {}
+
+    /// Return the index of the cell in the batch of chemical states.
+    auto index() const -> Index { return icell; }
+
+    /// Return the chemical system of the chemical state.
+    auto system() const -> const ChemicalSystem&;
+
+    /// Set the temperature of the chemical state (in units of K).
+    auto setTemperature(double val) -> void;
+
+    /// Set the pressure of the chemical state (in units of Pa).
+    auto setPressure(double val) -> void;
+
+    /// Set the molar amounts of the species (in units of mol).
+    auto setSpeciesAmounts(VectorConstRef n) -> void;
+
+    /// Return the temperature of the chemical state (in units of K).
+    auto temperature() const -> double;
+
+    /// Return the pressure of the chemical state (in units of Pa).
+    auto pressure() const -> double;
+
+    /// Return the molar amounts of the species (in units of mol).
+    auto speciesAmounts() -> VectorRef;
+
+    /// Return the molar amounts of the species (in units of mol).
+    auto speciesAmounts() const -> VectorConstRef;
+
+    /// Return the molar amount of a species (in units of mol).
+    auto speciesAmount(Index index) const -> double;
+
+    /// Return the dual potentials of the elements (in units of J/mol).
+    auto elementDualPotentials() -> VectorRef;
+
+    /// Return the dual potentials of the elements (in units of J/mol).
+    auto elementDualPotentials() const -> VectorConstRef;
+
+    /// Return the dual potentials of the species (in units of J/mol).
+    auto speciesDualPotentials() -> VectorRef;
+
+    /// Return the dual potentials of the species (in units of J/mol).
+    auto speciesDualPotentials() const -> VectorConstRef;
+
+    /// Return the molar amounts of the elements (in units of mol).
+    auto elementAmounts() const -> Vector;
+
+    /// Return the molar amounts of the elements in a group of species (in units of mol).
+    auto elementAmountsInSpecies(const Indices& indices) const -> Vector;
+
+    /// Assign a chemical state to the cell of this view.
+    auto operator=(const ChemicalState& state) -> ChemicalStateView&;
+
+    /// Convert this view into a ChemicalState instance.
+    operator ChemicalState() const;
+
+private:
+    /// The batch of chemical states that owns the data of the view.
+    ChemicalStateBatch* batch;
+
+    /// The index of the cell in the batch of chemical states.
+    Index icell;
+};
+
+/// A class that stores the chemical states of many cells in contiguous arrays.
+/// The temperatures and pressures of the cells are stored in vectors. The molar amounts of the
+/// species and the dual potentials of the elements and species are stored in column-major
+/// matrices, so that the `i`-th column contains the data of the `i`-th cell. The amounts of the
+/// species of all cells are therefore a single contiguous array, and quantities such as the
+/// amounts of the elements in every cell are calculated with a single matrix product.
+///
+/// **Usage**
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/// // Create a batch of 1000 chemical states equal to a given one
+/// ChemicalStateBatch batch(1000, state);
+///
+/// // Change the temperature of the fifth cell using a lightweight view
+/// batch[4].setTemperature(350.0);
+///
+/// // Calculate the amounts of the elements in every cell (one column per cell)
+/// Matrix b = batch.elementAmounts();
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/// @see ChemicalState, ChemicalStateView
+/// @ingroup Core
+class ChemicalStateBatch
+{
+public:
+    /// Construct a default ChemicalStateBatch instance.
+    ChemicalStateBatch();
+
+    /// Construct a ChemicalStateBatch instance with chemical states at standard conditions.
+    /// @param size The number of cells in the batch
+    /// @param system The chemical system common to all cells
+    ChemicalStateBatch(Index size, const ChemicalSystem& system);
+
+    /// Construct a ChemicalStateBatch instance with all cells equal to a chemical state.
+    /// @param size The number of cells in the batch
+    /// @param state The chemical state of every cell
+    ChemicalStateBatch(Index size, const ChemicalState& state);
+
+    /// Return the number of cells in the batch.
+    auto size() const -> Index { return m_temperatures.size(); }
+
+    /// Return the chemical system common to all cells.
+    auto system() const -> const ChemicalSystem& { return m_system; }
+
+    /// Set the chemical state of every cell.
+    auto set(const ChemicalState& state) -> void;
+
+    /// Set the chemical state of a cell.
+    auto set(Index icell, const ChemicalState& state) -> void;
+
+    /// Copy the chemical state of a cell into an existing ChemicalState instance.
+    /// This avoids the memory allocations of a new ChemicalState instance.
+    auto get(Index icell, ChemicalState& state) const -> void;
+
+    /// Return the chemical state of a cell as a new ChemicalState instance.
+    auto state(Index icell) const -> ChemicalState;
+
+    /// Return a view of the chemical state of a cell.
+    auto operator[](Index icell) -> ChemicalStateView { return ChemicalStateView(*this, icell); }
+
+    /// Return the temperatures of the cells (in units of K).
+    auto temperatures() -> VectorRef { return m_temperatures; }
+
+    /// Return the temperatures of the cells (in units of K).
+    auto temperatures() const -> VectorConstRef { return m_temperatures; }
+
+    /// Return the pressures of the cells (in units of Pa).
+    auto pressures() -> VectorRef { return m_pressures; }
+
+    /// Return the pressures of the cells (in units of Pa).
+    auto pressures() const -> VectorConstRef { return m_pressures; }
+
+    /// Return the molar amounts of the species with one column per cell (in units of mol).
+    auto speciesAmounts() -> MatrixRef { return m_n; }
+
+    /// Return the molar amounts of the species with one column per cell (in units of mol).
+    auto speciesAmounts() const -> MatrixConstRef { return m_n; }
+
+    /// Return the dual potentials of the elements with one column per cell (in units of J/mol).
+    auto elementDualPotentials() -> MatrixRef { return m_y; }
+
+    /// Return the dual potentials of the elements with one column per cell (in units of J/mol).
+    auto elementDualPotentials() const -> MatrixConstRef { return m_y; }
+
+    /// Return the dual potentials of the species with one column per cell (in units of J/mol).
+    auto speciesDualPotentials() -> MatrixRef { return m_z; }
+
+    /// Return the dual potentials of the species with one column per cell (in units of J/mol).
+    auto speciesDualPotentials() const -> MatrixConstRef { return m_z; }
+
+    /// Return the molar amounts of the elements with one column per cell (in units of mol).
+    auto elementAmounts() const -> Matrix;
+
+    /// Return the molar amounts of the elements in a group of species with one column per cell (in units of mol).
+    /// @param indices The indices of the species
+    auto elementAmountsInSpecies(const Indices& indices) const -> Matrix;
+
+private:
+    /// The chemical system common to all cells.
+    ChemicalSystem m_system;
+
+    /// The temperatures of the cells (in units of K).
+    Vector m_temperatures;
+
+    /// The pressures of the cells (in units of Pa).
+    Vector m_pressures;
+
+    /// The molar amounts of the species with one column per cell (in units of mol).
+    Matrix m_n;
+
+    /// The dual potentials of the elements with one column per cell (in units of J/mol).
+    Matrix m_y;
+
+    /// The dual potentials of the species with one column per cell (in units of J/mol).
+    Matrix m_z;
+};
+
+} // namespace Reaktoro
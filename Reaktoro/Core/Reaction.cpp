@@ -61,6 +61,9 @@ struct Reaction::Impl
     /// The stoichiometries of the species in the reaction
     Vector stoichiometries;
 
+    /// The indices of the species, besides those in the reaction, whose amounts affect the rate of the reaction
+    Indices rate_species;
+
     /// The function for the equilibrium constant of the reaction (in terms of natural log)
     ThermoScalarFunction lnk;
 
@@ -122,6 +125,12 @@ auto Reaction::setEquilibriumConstant(const ThermoScalarFunction& lnk) -> void
 auto Reaction::setRate(const ReactionRateFunction& function) -> void
 {
     pimpl->rate = function;
+    pimpl->rate_species.clear();
+}
+
+auto Reaction::setRateSpecies(const Indices& indices) -> void
+{
+    pimpl->rate_species = indices;
 }
 
 auto Reaction::name() const -> std::string
@@ -159,6 +168,11 @@ auto Reaction::indices() const -> const Indices&
     return pimpl->indices;
 }
 
+auto Reaction::rateSpecies() const -> const Indices&
+{
+    return pimpl->rate_species;
+}
+
 auto Reaction::stoichiometries() const -> VectorConstRef
 {
     return pimpl->stoichiometries;
@@ -197,7 +211,7 @@ auto Reaction::lnEquilibriumConstant(const ChemicalProperties& properties) const
 auto Reaction::lnReactionQuotient(const ChemicalProperties& properties) const -> ChemicalScalar
 {
     const unsigned num_species = system().numSpecies();
-    const ChemicalVector& ln_a = properties.lnActivities();
+    const auto& ln_a = properties.lnActivities();
     ChemicalScalar ln_Q(num_species);
     unsigned counter = 0;
     for(Index i : indices())
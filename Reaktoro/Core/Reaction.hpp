@@ -81,8 +81,15 @@ public:
     auto setEquilibriumConstant(const ThermoScalarFunction& lnk) -> void;
 
     /// Set the rate function of the reaction (in units of mol/s).
+    /// This clears the rate species of the reaction, so that the new rate function may depend on the amounts of all species.
     auto setRate(const ReactionRateFunction& function) -> void;
 
+    /// Set the indices of the species, besides the reacting species, whose amounts affect the rate of the reaction.
+    /// The rate of the reaction is assumed to depend only on the amounts of the species in the phases of these
+    /// species and of the reacting species (e.g., the catalysts and the mineral of a mineral reaction).
+    /// If no rate species are set, the rate of the reaction may depend on the amounts of all species.
+    auto setRateSpecies(const Indices& indices) -> void;
+
     /// Return the name of the reaction.
     auto name() const -> std::string;
 
@@ -104,6 +111,9 @@ public:
     /// Return the indices of the reacting species of the reaction
     auto indices() const -> const Indices&;
 
+    /// Return the indices of the species, besides the reacting species, whose amounts affect the rate of the reaction
+    auto rateSpecies() const -> const Indices&;
+
     /// Return the stoichiometries of the reacting species of the reaction
     auto stoichiometries() const -> VectorConstRef;
 
@@ -39,6 +39,45 @@ auto stoichiometricMatrix(const ChemicalSystem& system, const std::vector<Reacti
     return S;
 }
 
+auto rateDerivativesPattern(const ChemicalSystem& system, const std::vector<Reaction>& reactions) -> SparseMatrix
+{
+    const auto num_reactions = reactions.size();
+    const auto num_species = system.numSpecies();
+    SparseMatrix pattern(num_reactions, num_species);
+    for(unsigned i = 0; i < num_reactions; ++i)
+    {
+        // The rate of a reaction without rate species may depend on the amounts of all species
+        if(reactions[i].rateSpecies().empty())
+        {
+            pattern.startVec(i);
+            for(unsigned j = 0; j < num_species; ++j)
+                pattern.insertBack(i, j) = 0.0;
+            continue;
+        }
+
+        // The phases of the reacting species and of the other species whose amounts affect the rate of the reaction
+        std::vector<bool> inphase(system.numPhases(), false);
+        for(Index j : reactions[i].indices())
+            inphase[system.indexPhaseWithSpecies(j)] = true;
+        for(Index j : reactions[i].rateSpecies())
+            inphase[system.indexPhaseWithSpecies(j)] = true;
+
+        // The activities have block-diagonal molar derivatives, so the rate only depends on the species in these phases
+        pattern.startVec(i);
+        for(unsigned iphase = 0; iphase < system.numPhases(); ++iphase)
+        {
+            if(!inphase[iphase])
+                continue;
+            const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
+            const Index size = system.numSpeciesInPhase(iphase);
+            for(Index j = ifirst; j < ifirst + size; ++j)
+                pattern.insertBack(i, j) = 0.0;
+        }
+    }
+    pattern.finalize();
+    return pattern;
+}
+
 } // namespace
 
 struct ReactionSystem::Impl
@@ -52,6 +91,9 @@ struct ReactionSystem::Impl
     /// The stoichiometric matrix of the reactions w.r.t. to all species in the system
     Matrix stoichiometric_matrix;
 
+    /// The sparsity pattern of the molar derivatives of the rates of the reactions
+    SparseMatrix rates_pattern;
+
     /// Construct a defaut ReactionSystem::Impl instance
     Impl()
     {}
@@ -62,6 +104,9 @@ struct ReactionSystem::Impl
     {
         // Initialize the stoichiometric matrix of the reactions
         stoichiometric_matrix = Reaktoro::stoichiometricMatrix(system, reactions);
+
+        // Initialize the sparsity pattern of the molar derivatives of the rates of the reactions
+        rates_pattern = rateDerivativesPattern(system, reactions);
     }
 };
 
@@ -161,4 +206,29 @@ auto ReactionSystem::rates(const ChemicalProperties& properties) const -> Chemic
     return res;
 }
 
+auto ReactionSystem::rates(const ChemicalProperties& properties, ThermoVector& r, SparseMatrix& drdn) const -> void
+{
+    const unsigned num_reactions = numReactions();
+    const SparseMatrix& pattern = pimpl->rates_pattern;
+    r.resize(num_reactions);
+
+    // Initialize drdn with the sparsity pattern of the rate derivatives only if it does not have it yet
+    if(drdn.rows() != pattern.rows() || drdn.cols() != pattern.cols() || drdn.nonZeros() != pattern.nonZeros() || !drdn.isCompressed())
+        drdn = pattern;
+
+    // Update the stored entries of drdn in place
+    const auto* offsets = pattern.outerIndexPtr();
+    const auto* columns = pattern.innerIndexPtr();
+    double* values = drdn.valuePtr();
+    for(unsigned i = 0; i < num_reactions; ++i)
+    {
+        const ChemicalScalar ri = reaction(i).rate(properties);
+        r.val[i] = ri.val;
+        r.ddT[i] = ri.ddT;
+        r.ddP[i] = ri.ddP;
+        for(auto k = offsets[i]; k < offsets[i + 1]; ++k)
+            values[k] = ri.ddn[columns[k]];
+    }
+}
+
 } // namespace Reaktoro
@@ -24,6 +24,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/ScalarTypes.hpp>
 #include <Reaktoro/Core/Reaction.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
 
 namespace Reaktoro {
 
@@ -89,6 +90,17 @@ public:
     /// @param properties The thermodynamic properties of the system
     auto rates(const ChemicalProperties& properties) const -> ChemicalVector;
 
+    /// Calculate the kinetic rates of the reactions with sparse molar derivatives.
+    /// The rate of a reaction only depends on the amounts of the species in the phases of its reacting species
+    /// and of its rate species (see Reaction::setRateSpecies), e.g., its catalysts and mineral. The molar derivatives
+    /// of the rate of a reaction without rate species are stored for all species. The sparsity pattern
+    /// of these molar derivatives is computed once, and @p drdn is assigned to it only if it does not have it yet.
+    /// Later calls update the stored entries of @p drdn in place.
+    /// @param properties The thermodynamic properties of the system
+    /// @param[out] r The kinetic rates of the reactions and their temperature and pressure derivatives
+    /// @param[out] drdn The sparse molar derivatives of the kinetic rates of the reactions
+    auto rates(const ChemicalProperties& properties, ThermoVector& r, SparseMatrix& drdn) const -> void;
+
 private:
     struct Impl;
 
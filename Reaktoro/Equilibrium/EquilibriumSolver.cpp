@@ -81,16 +81,16 @@ struct EquilibriumSolver::Impl
     ThermoVector u0;
 
     /// The chemical potentials of the species
-    ChemicalVector u;
+    ThermoVector u;
 
     /// The chemical potentials of the equilibrium species
-    ChemicalVector ue;
+    ThermoVector ue;
 
     /// The chemical potentials of the inert species
     Vector ui;
 
     /// The mole fractions of the equilibrium species
-    ChemicalVector xe;
+    Vector xe;
 
     /// The optimisation problem
     OptimumProblem optimum_problem;
@@ -236,37 +236,43 @@ struct EquilibriumSolver::Impl
             // Update the chemical properties of the chemical system
             properties.update(n);
 
+            // The ln activities and mole fractions of the species, whose molar derivatives are block-diagonal by phase
+            const auto& lna = properties.lnActivities();
+            const auto& x = properties.moleFractions();
+
             // Set the scaled chemical potentials of the species
-            u = u0 + properties.lnActivities();
+            u.val = u0.val + lna.val;
+            u.ddT = u0.ddT + lna.ddT;
+            u.ddP = u0.ddP + lna.ddP;
 
             // Set the scaled chemical potentials of the equilibrium species
-            ue = rows(u, ies, ies);
+            ue = rows(u, ies);
 
             // Set the mole fractions of the equilibrium species
-            xe = rows(properties.moleFractions(), ies, ies);
+            xe = rows(x.val, ies);
 
             // Set the objective result
             res.val = dot(ne, ue.val);
             res.grad = ue.val;
 
-            // Set the Hessian of the objective function
+            // Set the Hessian of the objective function, assembling a dense matrix only if needed
             switch(options.hessian)
             {
             case GibbsHessian::Exact:
                 res.hessian.mode = Hessian::Dense;
-                res.hessian.dense = ue.ddn;
+                res.hessian.dense = lna.ddn.dense(ies);
                 break;
             case GibbsHessian::ExactDiagonal:
                 res.hessian.mode = Hessian::Diagonal;
-                res.hessian.diagonal = diagonal(ue.ddn);
+                res.hessian.diagonal = rows(lna.ddn.diagonal(), ies);
                 break;
             case GibbsHessian::Approximation:
                 res.hessian.mode = Hessian::Dense;
-                res.hessian.dense = diag(inv(xe.val)) * xe.ddn;
+                res.hessian.dense = diag(inv(xe)) * x.ddn.dense(ies);
                 break;
             case GibbsHessian::ApproximationDiagonal:
                 res.hessian.mode = Hessian::Diagonal;
-                res.hessian.diagonal = diagonal(xe.ddn)/xe.val;
+                res.hessian.diagonal = rows(x.ddn.diagonal(), ies)/xe;
                 break;
             }
 
@@ -559,19 +565,16 @@ struct EquilibriumSolver::Impl
         return sensitivities.dndP;
     }
 
-    /// Compute the sensitivity of the species amounts with respect to element amounts.
-    auto dndb() -> VectorConstRef
+    /// Compute the sensitivity of the equilibrium species amounts with respect to equilibrium element amounts.
+    auto dndb() -> MatrixConstRef
     {
-        const auto& ieq_species = partition.indicesEquilibriumSpecies();
-        const auto& ieq_elements = partition.indicesEquilibriumElements();
-        zerosEe = zeros(Ee);
         zerosNe = zeros(Ne);
         unitjEe = zeros(Ee);
         sensitivities.dndb = zeros(Ne, Ee);
-        for(Index j : ieq_elements)
+        for(Index j = 0; j < Ee; ++j)
         {
             unitjEe = unit(Ee, j);
-            sensitivities.dndb.col(j)(ieq_species) = solver.dxdp(zerosNe, unitjEe);
+            sensitivities.dndb.col(j) = solver.dxdp(zerosNe, unitjEe);
         }
         return sensitivities.dndb;
     }
@@ -669,7 +672,7 @@ auto EquilibriumSolver::dndP() -> VectorConstRef
     return pimpl->dndP();
 }
 
-auto EquilibriumSolver::dndb() -> VectorConstRef
+auto EquilibriumSolver::dndb() -> MatrixConstRef
 {
     return pimpl->dndb();
 }
@@ -111,8 +111,9 @@ public:
     /// Compute the sensitivity of the species amounts with respect to pressure.
     auto dndP() -> VectorConstRef;
 
-    /// Compute the sensitivity of the species amounts with respect to element amounts.
-    auto dndb() -> VectorConstRef;
+    /// Compute the sensitivity of the equilibrium species amounts with respect to equilibrium element amounts.
+    /// This is cheaper than @ref sensitivity when the derivatives with respect to temperature and pressure are not needed.
+    auto dndb() -> MatrixConstRef;
 
 private:
     struct Impl;
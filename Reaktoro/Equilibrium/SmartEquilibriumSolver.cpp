@@ -112,7 +112,7 @@ struct SmartEquilibriumSolver::Impl
         const EquilibriumSensitivity& sensitivity0 = std::get<3>(*it);
         const auto& n0 = state0.speciesAmounts();
 
-        MatrixConstRef dlnadn = properties0.lnActivities().ddn; // TODO this line is assuming all species are equilibrium specie! get the rows and columns corresponding to equilibrium species
+        const auto& dlnadn = properties0.lnActivities().ddn; // TODO this line is assuming all species are equilibrium specie! get the rows and columns corresponding to equilibrium species
         const auto& lna0 = properties0.lnActivities().val;
 
         // TODO Fixing negative amounts
@@ -135,7 +135,7 @@ struct SmartEquilibriumSolver::Impl
 
         n.noalias() = n0 + dn;
 
-        delta_lna.noalias() = dlnadn * dn;
+        delta_lna = dlnadn * dn;
 
         // The estimated ln(a[i]) of each species must not be
         // too far away from the reference value ln(aref[i])
@@ -1333,8 +1333,9 @@ auto Phreeqc::properties(ChemicalModelResult& res, double T, double P, VectorCon
         const auto np = n.segment(offset, size);
 
         // Set d(ln(a))/dn to d(ln(x))/dn, where x is mole fractions
-        res.lnActivities().ddn.block(offset, offset, size, size) = -1.0/sum(np) * ones(size, size);
-        res.lnActivities().ddn.block(offset, offset, size, size).diagonal() += 1.0/np;
+        auto dlnadn = res.lnActivities().ddn.block(offset, size);
+        dlnadn = -1.0/sum(np) * ones(size, size);
+        dlnadn.diagonal() += 1.0/np;
 
         offset += size;
     }
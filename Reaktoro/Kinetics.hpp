@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <Reaktoro/Kinetics/KineticField.hpp>
 #include <Reaktoro/Kinetics/KineticOptions.hpp>
 #include <Reaktoro/Kinetics/KineticPath.hpp>
 #include <Reaktoro/Kinetics/KineticProblem.hpp>
@@ -0,0 +1,221 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "KineticField.hpp"
+
+// C++ includes
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateBatch.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
+#include <Reaktoro/Kinetics/KineticSolver.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
+
+namespace Reaktoro {
+
+struct KineticField::Impl
+{
+    /// The kinetically-controlled chemical reactions
+    ReactionSystem reactions;
+
+    /// The chemical system instance
+    ChemicalSystem system;
+
+    /// The options of the kinetic solvers
+    KineticOptions options;
+
+    /// The partition of the species in the chemical system
+    Partition partition;
+
+    /// The kinetic solvers of the cells, kept alive between calls to reuse their allocated memory
+    std::vector<std::unique_ptr<KineticSolver>> solvers;
+
+    /// The chemical states of the cells used with contiguous arrays
+    std::vector<ChemicalState> states;
+
+    /// The accumulated statistics of the equilibrium calculations in the last call to `solve`
+    KineticResult result;
+
+    Impl()
+    {}
+
+    Impl(const ReactionSystem& reactions, Index num_cells)
+    : reactions(reactions), system(reactions.system()), partition(system)
+    {
+        solvers.resize(num_cells);
+        states.resize(num_cells, ChemicalState(system));
+    }
+
+    auto setOptions(const KineticOptions& options_) -> void
+    {
+        options = options_;
+        for(auto& solver : solvers)
+            if(solver) solver->setOptions(options);
+    }
+
+    auto setPartition(const Partition& partition_) -> void
+    {
+        partition = partition_;
+        for(auto& solver : solvers)
+            if(solver) solver->setPartition(partition);
+    }
+
+    /// Return the kinetic solver of a cell, creating it in its first use.
+    auto solver(Index icell) -> KineticSolver&
+    {
+        if(!solvers[icell])
+        {
+            solvers[icell].reset(new KineticSolver(reactions));
+            solvers[icell]->setOptions(options);
+            solvers[icell]->setPartition(partition);
+        }
+        return *solvers[icell];
+    }
+
+    /// Integrate the chemical kinetics of a cell from `t` to `t + dt`.
+    auto solve(Index icell, ChemicalState& state, double t, double dt) -> void
+    {
+        KineticSolver& cellsolver = solver(icell);
+        cellsolver.solve(state, t, dt);
+        result += cellsolver.result();
+    }
+
+    auto solve(ChemicalField& field, double t, double dt) -> void
+    {
+        const Index num_cells = solvers.size();
+
+        Assert(field.size() == num_cells,
+            "Cannot proceed with KineticField::solve.",
+            "The size of the chemical field does not match the number of cells.");
+
+        result = {};
+
+        // The cells are independent, and each one uses its own solver
+        for(Index icell = 0; icell < num_cells; ++icell)
+            solve(icell, field[icell], t, dt);
+    }
+
+    auto solve(ChemicalStateBatch& batch, double t, double dt) -> void
+    {
+        const Index num_cells = solvers.size();
+
+        Assert(batch.size() == num_cells,
+            "Cannot proceed with KineticField::solve.",
+            "The size of the batch of chemical states does not match the number of cells.");
+
+        result = {};
+
+        // The cells are independent, and each one uses its own solver and chemical state
+        for(Index icell = 0; icell < num_cells; ++icell)
+        {
+            ChemicalState& state = states[icell];
+            batch.get(icell, state);
+            solve(icell, state, t, dt);
+            batch.set(icell, state);
+        }
+    }
+
+    auto solve(VectorConstRef T, VectorConstRef P, VectorRef n, double t, double dt) -> void
+    {
+        const Index num_cells = solvers.size();
+        const Index num_species = system.numSpecies();
+
+        Assert(Index(T.size()) == num_cells && Index(P.size()) == num_cells && Index(n.size()) == num_cells * num_species,
+            "Cannot proceed with KineticField::solve.",
+            "The sizes of the temperature, pressure, and species amounts arrays do not match the number of cells.");
+
+        result = {};
+
+        // The cells are independent, and each one uses its own solver and chemical state
+        Index offset = 0;
+        for(Index icell = 0; icell < num_cells; ++icell, offset += num_species)
+        {
+            ChemicalState& state = states[icell];
+            state.setTemperature(T[icell]);
+            state.setPressure(P[icell]);
+            state.setSpeciesAmounts(n.segment(offset, num_species));
+            solve(icell, state, t, dt);
+            n.segment(offset, num_species) = state.speciesAmounts();
+        }
+    }
+};
+
+KineticField::KineticField()
+: pimpl(new Impl())
+{}
+
+KineticField::KineticField(const ReactionSystem& reactions, Index num_cells)
+: pimpl(new Impl(reactions, num_cells))
+{}
+
+KineticField::~KineticField()
+{}
+
+auto KineticField::operator=(KineticField other) -> KineticField&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto KineticField::setOptions(const KineticOptions& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto KineticField::setPartition(const Partition& partition) -> void
+{
+    pimpl->setPartition(partition);
+}
+
+auto KineticField::numCells() const -> Index
+{
+    return pimpl->solvers.size();
+}
+
+auto KineticField::solve(ChemicalField& field, double t, double dt) -> void
+{
+    pimpl->solve(field, t, dt);
+}
+
+auto KineticField::solve(ChemicalStateBatch& batch, double t, double dt) -> void
+{
+    pimpl->solve(batch, t, dt);
+}
+
+auto KineticField::solve(VectorConstRef T, VectorConstRef P, VectorRef n, double t, double dt) -> void
+{
+    pimpl->solve(T, P, n, t, dt);
+}
+
+auto KineticField::state(Index icell) const -> const ChemicalState&
+{
+    return pimpl->states[icell];
+}
+
+auto KineticField::result() const -> const KineticResult&
+{
+    return pimpl->result;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,107 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalField;
+class ChemicalState;
+class ChemicalStateBatch;
+class Partition;
+class ReactionSystem;
+struct KineticOptions;
+struct KineticResult;
+
+/// A class that integrates the chemical kinetics of many independent cells over a common time step.
+/// Each cell has its own KineticSolver instance, with its own adaptive internal time stepping, which
+/// is kept alive between calls so that the memory of the ODE integrator and the equilibrium solver,
+/// as well as the chemical state used for warm-starting the equilibrium calculations, are reused.
+/// @see KineticSolver, ChemicalField
+class KineticField
+{
+public:
+    /// Construct a default KineticField instance.
+    KineticField();
+
+    /// Construct a KineticField instance.
+    /// @param reactions The kinetically-controlled reactions common to all cells
+    /// @param num_cells The number of cells in the field
+    KineticField(const ReactionSystem& reactions, Index num_cells);
+
+    /// Construct a copy of a KineticField instance.
+    KineticField(const KineticField& other) = delete;
+
+    /// Destroy the KineticField instance.
+    virtual ~KineticField();
+
+    /// Assign a KineticField instance to this instance.
+    auto operator=(KineticField other) -> KineticField&;
+
+    /// Set the options for the chemical kinetics calculation in every cell.
+    auto setOptions(const KineticOptions& options) -> void;
+
+    /// Set the partition of the chemical system in every cell.
+    auto setPartition(const Partition& partition) -> void;
+
+    /// Return the number of cells in the field.
+    auto numCells() const -> Index;
+
+    /// Integrate the chemical kinetics of every cell from `t` to `t + dt`.
+    /// @param field The chemical states of the cells
+    /// @param t The start time of the integration (in units of s)
+    /// @param dt The time step of the integration (in units of s)
+    auto solve(ChemicalField& field, double t, double dt) -> void;
+
+    /// Integrate the chemical kinetics of every cell from `t` to `t + dt`.
+    /// @param batch The chemical states of the cells in contiguous arrays
+    /// @param t The start time of the integration (in units of s)
+    /// @param dt The time step of the integration (in units of s)
+    auto solve(ChemicalStateBatch& batch, double t, double dt) -> void;
+
+    /// Integrate the chemical kinetics of every cell from `t` to `t + dt`.
+    /// The amounts of the species are stored contiguously cell after cell, so that the amounts
+    /// in the `i`-th cell are given by the segment starting at `i*N` with length `N`, where `N`
+    /// is the number of species.
+    /// @param T The temperatures of the cells (in units of K)
+    /// @param P The pressures of the cells (in units of Pa)
+    /// @param[in,out] n The amounts of the species in the cells (in units of mol)
+    /// @param t The start time of the integration (in units of s)
+    /// @param dt The time step of the integration (in units of s)
+    auto solve(VectorConstRef T, VectorConstRef P, VectorRef n, double t, double dt) -> void;
+
+    /// Return the chemical state of a cell used in the last call to `solve` with contiguous arrays.
+    auto state(Index icell) const -> const ChemicalState&;
+
+    /// Return the accumulated statistics of the equilibrium calculations of every cell in the last call to `solve`.
+    auto result() const -> const KineticResult&;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
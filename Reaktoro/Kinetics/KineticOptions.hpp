@@ -42,6 +42,13 @@ struct KineticOptions
 
     /// The options for the output of the chemical kinetics calculation
     KineticOutputOptions output;
+
+    /// The boolean flag that indicates if smart equilibrium should be used in the right-hand side function.
+    /// If true, the equilibrium state in each evaluation of the right-hand side function is first predicted
+    /// from the last fully calculated equilibrium state and its sensitivity with respect to the element
+    /// amounts. The prediction is accepted if the estimated variations of the ln activities of the species
+    /// satisfy the tolerances in `equilibrium.smart`. Otherwise, a full equilibrium calculation is performed.
+    bool use_smart_equilibrium = false;
 };
 
 } // namespace Reaktoro
@@ -15,14 +15,17 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
-#include <Reaktoro/Kinetics/KineticResult.hpp>
+#include "KineticResult.hpp"
 
 namespace Reaktoro {
 
-KineticResult::KineticResult()
+auto KineticResult::operator+=(const KineticResult& other) -> KineticResult&
 {
-	// TODO Auto-generated constructor stub
-
+    num_function_evaluations += other.num_function_evaluations;
+    num_smart_equilibrium_accepted += other.num_smart_equilibrium_accepted;
+    num_equilibrium_calculations += other.num_equilibrium_calculations;
+    num_equilibrium_coldstarts += other.num_equilibrium_coldstarts;
+    return *this;
 }
 
 } // namespace Reaktoro
@@ -17,12 +17,31 @@
 
 #pragma once
 
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+
 namespace Reaktoro {
 
-class KineticResult
+/// A type used to describe the statistics of the equilibrium calculations in a chemical kinetics step.
+/// The right-hand side function of the kinetic problem requires the equilibrium state of the
+/// equilibrium species, which is either predicted with smart equilibrium or fully calculated.
+/// @see KineticSolver, KineticOptions
+struct KineticResult
 {
-public:
-	KineticResult();
+    /// The number of evaluations of the right-hand side function of the kinetic problem.
+    Index num_function_evaluations = 0;
+
+    /// The number of equilibrium states predicted with smart equilibrium and accepted.
+    Index num_smart_equilibrium_accepted = 0;
+
+    /// The number of full equilibrium calculations, which includes the fallbacks after rejected predictions.
+    Index num_equilibrium_calculations = 0;
+
+    /// The number of full equilibrium calculations that needed to be repeated from a cold start.
+    Index num_equilibrium_coldstarts = 0;
+
+    /// Apply an addition assignment to this instance
+    auto operator+=(const KineticResult& other) -> KineticResult&;
 };
 
 } // namespace Reaktoro
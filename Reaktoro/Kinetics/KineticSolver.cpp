@@ -21,10 +21,14 @@
 #include <functional>
 using namespace std::placeholders;
 
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/LU>
+
 // Reaktoro includes
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
@@ -38,9 +42,32 @@ using namespace std::placeholders;
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Kinetics/KineticOptions.hpp>
 #include <Reaktoro/Kinetics/KineticProblem.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The volume used to normalize the rate of a volumetric sink.
+enum class SinkVolume { Phase, Fluid, Solid };
+
+/// A sink that removes species at a rate proportional to their amounts per volume of a phase, fluid, or solid.
+struct VolumetricSink
+{
+    /// The volume used to normalize the rate of the sink
+    SinkVolume kind;
+
+    /// The index of the phase whose volume is used if `kind` is `SinkVolume::Phase`
+    Index iphase;
+
+    /// The volumetric rate of the sink (in units of m3/s)
+    double volumerate;
+
+    /// The indices of the species removed by the sink
+    Indices species;
+};
+
+} // namespace
 
 struct KineticSolver::Impl
 {
@@ -114,19 +141,50 @@ struct KineticSolver::Impl
     ChemicalProperties properties;
 
     /// The vector with the values of the reaction rates
-    ChemicalVector r;
+    ThermoVector r;
+
+    /// The sparse partial derivatives of the reaction rates `r` w.r.t. to the amounts of all species
+    SparseMatrix drdn;
+
+    /// The partial derivatives of the reaction rates `r` w.r.t. to `be`, `nk`, `and `u = [be nk]`
+    Matrix drdbe, drdnk, drdu;
+
+    /// The sensitivity of the amounts of all species w.r.t. `be`, with zero rows for the non-equilibrium species
+    Matrix dndbe;
 
-    /// The partial derivatives of the reaction rates `r` w.r.t. to `be`, `ne`, `nk`, `and `u = [be nk]`
-    Matrix drdbe, drdne, drdnk, drdu;
+    /// The position of each species in the kinetic partition, or -1 if the species is not kinetic
+    Indices ikinetic;
 
-    /// The source term
+    /// The source rates of the species assembled from the constant sources and the volumetric sinks
     ChemicalVector q;
 
     /// The partial derivatives of the source rates `q` w.r.t. to `be`, `ne`, `nk`, `and `u = [be nk]`
     Matrix dqdbe, dqdne, dqdnk, dqdu;
 
-    /// The function that calculates the source term in the problem
-    std::function<ChemicalVector(const ChemicalProperties&)> source_fn;
+    /// The sum of the constant source rates of the species (empty if no source has been added)
+    Vector source_rates;
+
+    /// The volumetric sinks of the species
+    std::vector<VolumetricSink> sinks;
+
+    /// The statistics of the equilibrium calculations in the last kinetic step
+    KineticResult result;
+
+    /// The molar abundance of the elements and the molar composition of the equilibrium and kinetic
+    /// species at the reference equilibrium state used for smart equilibrium predictions
+    Vector be0, ne0, nk0;
+
+    /// The chemical properties of the system at the reference equilibrium state
+    ChemicalProperties properties0;
+
+    /// The variation of the molar composition of the species with respect to the reference equilibrium state
+    Vector dn;
+
+    /// The estimated variation of the ln activities of the species with respect to the reference equilibrium state
+    Vector delta_lna;
+
+    /// The LU factorization of the matrix of the preconditioner used with the Krylov linear solver of the ODE
+    Eigen::PartialPivLU<Matrix> preconditioner_lu;
 
     Impl()
     {}
@@ -148,6 +206,9 @@ struct KineticSolver::Impl
         // Initialise the partition member
         partition = partition_;
 
+        // Discard the reference equilibrium state of smart equilibrium predictions
+        be0.resize(0);
+
         // Set the partition of the equilibrium solver
         equilibrium.setPartition(partition);
 
@@ -194,26 +255,25 @@ struct KineticSolver::Impl
         // Allocate memory for the partial derivatives of the reaction rates `r` w.r.t. to `u = [be nk]`
         drdu.resize(reactions.numReactions(), Ee + Nk);
 
+        // Initialise the sensitivity of the amounts of all species w.r.t. `be`
+        dndbe = zeros(system.numSpecies(), Ee);
+
+        // Initialise the position of each species in the kinetic partition
+        ikinetic.assign(system.numSpecies(), Index(-1));
+        for(Index i = 0; i < Nk; ++i)
+            ikinetic[iks[i]] = i;
+
         // Allocate memory for the partial derivatives of the source rates `q` w.r.t. to `u = [be nk]`
         dqdu.resize(system.numSpecies(), Ee + Nk);
     }
 
     auto addSource(ChemicalState state, double volumerate, std::string units) -> void
     {
-        const Index num_species = system.numSpecies();
         const double volume = units::convert(volumerate, units, "m3/s");
         state.scaleVolume(volume);
-        const Vector n = state.speciesAmounts();
-        auto old_source_fn = source_fn;
-
-        source_fn = [=](const ChemicalProperties& properties)
-        {
-            ChemicalVector q(num_species);
-            q.val = n;
-            if(old_source_fn)
-                q += old_source_fn(properties);
-            return q;
-        };
+        if(source_rates.size())
+            source_rates += state.speciesAmounts();
+        else source_rates = state.speciesAmounts();
     }
 
     auto addPhaseSink(std::string phase, double volumerate, std::string units) -> void
@@ -222,61 +282,70 @@ struct KineticSolver::Impl
         const Index iphase = system.indexPhaseWithError(phase);
         const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
         const Index size = system.numSpeciesInPhase(iphase);
-        auto old_source_fn = source_fn;
-        ChemicalScalar phasevolume;
-        ChemicalVector q(size);
-
-        source_fn = [=](const ChemicalProperties& properties) mutable
-        {
-            const auto n = properties.composition();
-            const auto np = rows(n, ifirst, size);
-            auto qp = rows(q, ifirst, size);
-            phasevolume = properties.phaseVolumes()[iphase];
-            qp = -volume*np/phasevolume;
-            if(old_source_fn)
-                q += old_source_fn(properties);
-            return q;
-        };
+        Indices species(size);
+        for(Index i = 0; i < size; ++i)
+            species[i] = ifirst + i;
+        sinks.push_back({SinkVolume::Phase, iphase, volume, species});
     }
 
     auto addFluidSink(double volumerate, std::string units) -> void
     {
         const double volume = units::convert(volumerate, units, "m3/s");
-        const Indices& isolid_species = partition.indicesSolidSpecies();
-        auto old_source_fn = source_fn;
-        ChemicalScalar fluidvolume;
-        ChemicalVector q;
-
-        source_fn = [=](const ChemicalProperties& properties) mutable
-        {
-            const auto n = properties.composition();
-            fluidvolume = properties.fluidVolume();
-            q = -volume*n/fluidvolume;
-            rows(q, isolid_species).fill(0.0);
-            if(old_source_fn)
-                q += old_source_fn(properties);
-            return q;
-        };
+        sinks.push_back({SinkVolume::Fluid, 0, volume, partition.indicesFluidSpecies()});
     }
 
     auto addSolidSink(double volumerate, std::string units) -> void
     {
         const double volume = units::convert(volumerate, units, "m3/s");
-        const Indices& ifluid_species = partition.indicesFluidSpecies();
-        auto old_source_fn = source_fn;
-        ChemicalScalar solidvolume;
-        ChemicalVector q;
+        sinks.push_back({SinkVolume::Solid, 0, volume, partition.indicesSolidSpecies()});
+    }
+
+    /// Return true if any source or sink has been added to the problem.
+    auto hasSources() const -> bool
+    {
+        return source_rates.size() || sinks.size();
+    }
+
+    /// Assemble the source rates `q` and their derivatives from the constant sources and the volumetric sinks.
+    /// A volumetric sink with rate `v` contributes `q[i] = -v*n[i]/V` for each of its species `i`,
+    /// where `V` is the volume of the phase, fluid, or solid that contains them.
+    auto sources(const ChemicalProperties& properties) -> void
+    {
+        const Index num_species = system.numSpecies();
+
+        q.resize(num_species);
+
+        if(source_rates.size())
+            q.val = source_rates;
+
+        if(sinks.empty())
+            return;
+
+        const auto n = properties.composition();
 
-        source_fn = [=](const ChemicalProperties& properties) mutable
+        ChemicalScalar V;
+
+        for(const VolumetricSink& sink : sinks)
         {
-            const auto n = properties.composition();
-            solidvolume = properties.solidVolume();
-            q = -volume*n/solidvolume;
-            rows(q, ifluid_species).fill(0.0);
-            if(old_source_fn)
-                q += old_source_fn(properties);
-            return q;
-        };
+            switch(sink.kind)
+            {
+            case SinkVolume::Phase: V = properties.phaseVolumes()[sink.iphase]; break;
+            case SinkVolume::Fluid: V = properties.fluidVolume(); break;
+            case SinkVolume::Solid: V = properties.solidVolume(); break;
+            }
+
+            const double c = sink.volumerate/V.val;
+
+            for(Index i : sink.species)
+            {
+                const double ci = c*n.val[i]/V.val;
+                q.val[i] -= c*n.val[i];
+                q.ddT[i] += ci*V.ddT;
+                q.ddP[i] += ci*V.ddP;
+                q.ddn.row(i) += ci*V.ddn;
+                q.ddn(i, i) -= c;
+            }
+        }
     }
 
     auto initialize(ChemicalState& state, double tstart) -> void
@@ -307,11 +376,25 @@ struct KineticSolver::Impl
             return jacobian(state, t, u, res);
         };
 
+        // Define the setup of the preconditioner used with the Krylov linear solver
+        ODEPreconditionerSetup ode_preconditioner_setup = [&](double t, VectorConstRef u, bool jok, bool& jcur, double gamma)
+        {
+            return preconditionerSetup(t, u, jok, jcur, gamma);
+        };
+
+        // Define the solution of the preconditioner system used with the Krylov linear solver
+        ODEPreconditionerSolve ode_preconditioner_solve = [&](double t, VectorConstRef u, VectorConstRef r, VectorRef z, double gamma)
+        {
+            return preconditionerSolve(t, u, r, z, gamma);
+        };
+
         // Initialise the ODE problem
         ODEProblem problem;
         problem.setNumEquations(Ee + Nk);
         problem.setFunction(ode_function);
         problem.setJacobian(ode_jacobian);
+        if(options.ode.linear_solver == ODELinearSolverMode::SPGMR)
+            problem.setPreconditioner(ode_preconditioner_setup, ode_preconditioner_solve);
 
         // Define the options for the ODE solver
         ODEOptions options_ode = options.ode;
@@ -323,6 +406,9 @@ struct KineticSolver::Impl
 
         // Set the options of the equilibrium solver
         equilibrium.setOptions(options.equilibrium);
+
+        // Discard the reference equilibrium state of smart equilibrium predictions
+        be0.resize(0);
     }
 
     auto step(ChemicalState& state, double t) -> double
@@ -343,6 +429,9 @@ struct KineticSolver::Impl
         benk.head(Ee) = Ae * ne;
         benk.tail(Nk) = nk;
 
+        // Reset the statistics of the equilibrium calculations
+        result = {};
+
         // Perform one ODE step integration
         ode.integrate(t, benk, tfinal);
 
@@ -364,6 +453,9 @@ struct KineticSolver::Impl
         // Initialise the chemical kinetics solver
         initialize(state, t);
 
+        // Reset the statistics of the equilibrium calculations
+        result = {};
+
         // Integrate the chemical kinetics ODE from `t` to `t + dt`
         ode.solve(t, dt, benk);
 
@@ -378,6 +470,78 @@ struct KineticSolver::Impl
         equilibrium.solve(state, T, P, be);
     }
 
+    /// Solve the equilibrium problem using the elemental molar abundance `be`.
+    auto equilibrate(ChemicalState& state) -> void
+    {
+        // Update the number of full equilibrium calculations
+        ++result.num_equilibrium_calculations;
+
+        // Solve the equilibrium problem using the elemental molar abundance `be`
+        auto res = equilibrium.solve(state, T, P, be);
+
+        // Check if the calculation failed, if so, use cold-start
+        if(!res.optimum.succeeded)
+        {
+            ++result.num_equilibrium_coldstarts;
+            state.setSpeciesAmounts(0.0);
+            res = equilibrium.solve(state, T, P, be);
+        }
+
+        // Assert the equilibrium calculation did not fail
+        Assert(res.optimum.succeeded,
+            "Could not calculate the rates of the species.",
+            "The equilibrium calculation failed.");
+
+        // Save the calculated equilibrium state as the reference state of smart equilibrium predictions
+        if(options.use_smart_equilibrium)
+        {
+            sensitivity.dndb = equilibrium.dndb();
+            properties0 = equilibrium.properties();
+            be0 = be;
+            ne0 = state.speciesAmounts()(ies);
+            nk0 = nk;
+        }
+    }
+
+    /// Predict the equilibrium state using the reference equilibrium state and its sensitivity.
+    /// @return true if the prediction was accepted, false otherwise.
+    auto estimate(ChemicalState& state) -> bool
+    {
+        // Check if there is a reference equilibrium state
+        if(be0.size() == 0)
+            return false;
+
+        // The predicted molar composition of the equilibrium species
+        ne = ne0 + sensitivity.dndb * (be - be0);
+
+        // The estimated amounts of all equilibrium species must be positive
+        if(Ne > 0 && ne.minCoeff() <= 0.0)
+            return false;
+
+        // The variation of the molar composition of all species with respect to the reference state
+        dn = zeros(system.numSpecies());
+        dn(ies) = ne - ne0;
+        dn(iks) = nk - nk0;
+
+        // The estimated variation of the ln activities of the species (using their block-diagonal molar derivatives)
+        const auto& lna0 = properties0.lnActivities();
+        delta_lna = lna0.ddn * dn;
+
+        // The estimated ln activities must not be too far away from their reference values
+        const auto reltol = options.equilibrium.smart.reltol;
+        const auto abstol = options.equilibrium.smart.abstol;
+        if(!(delta_lna.array().abs() <= abstol + reltol * lna0.val.array().abs()).all())
+            return false;
+
+        // Update the composition of the equilibrium species with the accepted prediction
+        state.setSpeciesAmounts(ne, ies);
+
+        // Update the number of accepted smart equilibrium predictions
+        ++result.num_smart_equilibrium_accepted;
+
+        return true;
+    }
+
     auto function(ChemicalState& state, double t, VectorConstRef u, VectorRef res) -> int
     {
         // Extract the `be` and `nk` entries of the vector [be, nk]
@@ -389,38 +553,30 @@ struct KineticSolver::Impl
             if(!std::isfinite(u[i]))
                 return 1; // ensure the ode solver will reduce the time step
 
+        // Update the number of evaluations of the right-hand side function
+        ++result.num_function_evaluations;
+
         // Update the composition of the kinetic species in the member `state`
         state.setSpeciesAmounts(nk, iks);
 
-        // Solve the equilibrium problem using the elemental molar abundance `be`
-        auto result = equilibrium.solve(state, T, P, be);
-
-        // Check if the calculation failed, if so, use cold-start
-        if(!result.optimum.succeeded)
-        {
-            state.setSpeciesAmounts(0.0);
-            result = equilibrium.solve(state, T, P, be);
-        }
-
-        // Assert the equilibrium calculation did not fail
-        Assert(result.optimum.succeeded,
-            "Could not calculate the rates of the species.",
-            "The equilibrium calculation failed.");
+        // Predict the equilibrium state with smart equilibrium, and fall back to a full calculation if not accepted
+        if(!options.use_smart_equilibrium || !estimate(state))
+            equilibrate(state);
 
         // Update the chemical properties of the system
         properties = state.properties();
 
         // Calculate the kinetic rates of the reactions
-        r = reactions.rates(properties);
+        reactions.rates(properties, r, drdn);
 
         // Calculate the right-hand side function of the ODE
         res = A * r.val;
 
         // Add the function contribution from the source rates
-        if(source_fn)
+        if(hasSources())
         {
-            // Evaluate the source function
-            q = source_fn(properties);
+            // Assemble the source rates
+            sources(properties);
 
             // Add the contribution of the source rates
             res += B * q.val;
@@ -429,26 +585,74 @@ struct KineticSolver::Impl
         return 0;
     }
 
-    auto jacobian(ChemicalState& state, double t, VectorConstRef u, MatrixRef res) -> int
+    /// Calculate the partial derivatives of the reaction rates `r` w.r.t. to `u = [be nk]` at the last evaluated state.
+    auto ratesDerivatives() -> void
     {
-        // Calculate the sensitivity of the equilibrium state
-        sensitivity = equilibrium.sensitivity();
+        // Calculate the sensitivity of the equilibrium state (already known at the reference state if smart equilibrium is used)
+        if(!options.use_smart_equilibrium)
+            sensitivity.dndb = equilibrium.dndb();
 
-        // Extract the columns of the kinetic rates derivatives w.r.t. the equilibrium and kinetic species
-        drdne = cols(r.ddn, ies);
-        drdnk = cols(r.ddn, iks);
+        // Calculate the derivatives of `r` w.r.t. `be` using the equilibrium sensitivity and the sparse derivatives of `r`
+        dndbe(ies, Eigen::all) = sensitivity.dndb;
+        drdbe = drdn * dndbe;
 
-        // Calculate the derivatives of `r` w.r.t. `be` using the equilibrium sensitivity
-        drdbe = drdne * sensitivity.dndb;
+        // Extract the derivatives of `r` w.r.t. the kinetic species from the nonzero entries of the sparse derivatives of `r`
+        drdnk = zeros(drdn.rows(), Nk);
+        for(Index i = 0; i < Index(drdn.outerSize()); ++i)
+            for(SparseMatrix::InnerIterator it(drdn, i); it; ++it)
+                if(ikinetic[it.col()] != Index(-1))
+                    drdnk(i, ikinetic[it.col()]) = it.value();
 
         // Assemble the partial derivatives of the reaction rates `r` w.r.t. to `u = [be nk]`
         drdu << drdbe, drdnk;
+    }
+
+    /// Prepare the preconditioner `P = I - gamma*A*drdu` of the Newton matrix `I - gamma*J`.
+    /// The preconditioner neglects the contribution of the source rates to the Jacobian `J`. Since
+    /// `A*drdu` has rank at most the number of reactions `R`, the preconditioner is factorized through
+    /// the `R`-by-`R` matrix `I - gamma*drdu*A` whenever `R` is less than the number of ODE equations.
+    auto preconditionerSetup(double t, VectorConstRef u, bool jok, bool& jcur, double gamma) -> int
+    {
+        // Recalculate the derivatives of the reaction rates only if the saved ones cannot be reused
+        jcur = !jok;
+        if(jcur)
+            ratesDerivatives();
+
+        // The number of reactions and the number of ODE equations
+        const Index R = reactions.numReactions();
+        const Index n = Ee + Nk;
+
+        // Factorize the reduced or the full matrix of the preconditioner
+        if(R < n)
+            preconditioner_lu.compute(identity(R, R) - gamma * drdu * A);
+        else
+            preconditioner_lu.compute(identity(n, n) - gamma * A * drdu);
+
+        return 0;
+    }
+
+    /// Solve the preconditioner system `P*z = r` using the Woodbury identity for the reduced case:
+    /// `inv(I - gamma*A*drdu) = I + gamma*A*inv(I - gamma*drdu*A)*drdu`.
+    auto preconditionerSolve(double t, VectorConstRef u, VectorConstRef rhs, VectorRef z, double gamma) -> int
+    {
+        if(reactions.numReactions() < Ee + Nk)
+            z = rhs + gamma * A * preconditioner_lu.solve(drdu * rhs);
+        else
+            z = preconditioner_lu.solve(rhs);
+
+        return 0;
+    }
+
+    auto jacobian(ChemicalState& state, double t, VectorConstRef u, MatrixRef res) -> int
+    {
+        // Calculate the partial derivatives of the reaction rates `r` w.r.t. to `u = [be nk]`
+        ratesDerivatives();
 
         // Calculate the Jacobian matrix of the ODE function
         res = A * drdu;
 
         // Add the Jacobian contribution from the source rates
-        if(source_fn)
+        if(hasSources())
         {
             // Extract the columns of the source rates derivatives w.r.t. the equilibrium and kinetic species
             dqdne = cols(q.ddn, ies);
@@ -535,4 +739,9 @@ auto KineticSolver::solve(ChemicalState& state, double t, double dt) -> void
     pimpl->solve(state, t, dt);
 }
 
+auto KineticSolver::result() const -> const KineticResult&
+{
+    return pimpl->result;
+}
+
 } // namespace Reaktoro
@@ -29,6 +29,7 @@ class ChemicalState;
 class Partition;
 class ReactionSystem;
 struct KineticOptions;
+struct KineticResult;
 
 /// A class that represents a solver for chemical kinetics problems.
 /// @see KineticProblem
@@ -110,6 +111,9 @@ public:
     /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
     auto solve(ChemicalState& state, double t, double dt) -> void;
 
+    /// Return the statistics of the equilibrium calculations in the last call to `step` or `solve`.
+    auto result() const -> const KineticResult&;
+
 private:
     struct Impl;
 
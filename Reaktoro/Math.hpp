@@ -18,6 +18,7 @@
 #pragma once
 
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
+#include <Reaktoro/Math/BlockDiagonalMatrix.hpp>
 #include <Reaktoro/Math/Derivatives.hpp>
 #include <Reaktoro/Math/LagrangeInterpolator.hpp>
 #include <Reaktoro/Math/LU.hpp>
@@ -25,3 +26,4 @@
 #include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Math/ODE.hpp>
 #include <Reaktoro/Math/Roots.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
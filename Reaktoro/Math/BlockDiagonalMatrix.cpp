@@ -0,0 +1,196 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "BlockDiagonalMatrix.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+BlockDiagonalMatrix::BlockDiagonalMatrix()
+: m_offsets(1, 0), m_starts(1, 0)
+{}
+
+BlockDiagonalMatrix::BlockDiagonalMatrix(const Indices& sizes)
+{
+    resize(sizes);
+}
+
+auto BlockDiagonalMatrix::resize(const Indices& sizes) -> void
+{
+    const Index nblocks = sizes.size();
+    m_sizes = sizes;
+    m_offsets.resize(nblocks + 1);
+    m_starts.resize(nblocks + 1);
+    m_offsets[0] = m_starts[0] = 0;
+    for(Index i = 0; i < nblocks; ++i)
+    {
+        m_offsets[i + 1] = m_offsets[i] + sizes[i];
+        m_starts[i + 1] = m_starts[i] + sizes[i] * sizes[i];
+    }
+    m_data = zeros(m_starts.back());
+}
+
+auto BlockDiagonalMatrix::setZero() -> void
+{
+    m_data.setZero();
+}
+
+auto BlockDiagonalMatrix::rows() const -> Index
+{
+    return m_offsets.back();
+}
+
+auto BlockDiagonalMatrix::cols() const -> Index
+{
+    return m_offsets.back();
+}
+
+auto BlockDiagonalMatrix::numBlocks() const -> Index
+{
+    return m_sizes.size();
+}
+
+auto BlockDiagonalMatrix::blockSize(Index iblock) const -> Index
+{
+    return m_sizes[iblock];
+}
+
+auto BlockDiagonalMatrix::blockOffset(Index iblock) const -> Index
+{
+    return m_offsets[iblock];
+}
+
+auto BlockDiagonalMatrix::indexBlockWithRow(Index irow) const -> Index
+{
+    return std::upper_bound(m_offsets.begin(), m_offsets.end(), irow) - m_offsets.begin() - 1;
+}
+
+auto BlockDiagonalMatrix::block(Index iblock) -> MatrixMap
+{
+    const Index size = m_sizes[iblock];
+    return MatrixMap(m_data.data() + m_starts[iblock], size, size);
+}
+
+auto BlockDiagonalMatrix::block(Index iblock) const -> MatrixConstMap
+{
+    const Index size = m_sizes[iblock];
+    return MatrixConstMap(m_data.data() + m_starts[iblock], size, size);
+}
+
+auto BlockDiagonalMatrix::block(Index irow, Index nrows) -> MatrixRef
+{
+    const Index iblock = indexBlockWithRow(irow);
+    const Index local = irow - m_offsets[iblock];
+    Assert(local + nrows <= m_sizes[iblock],
+        "Could not get the requested diagonal submatrix of the block-diagonal matrix.",
+        "The submatrix is not contained in a single diagonal block.");
+    return block(iblock).block(local, local, nrows, nrows);
+}
+
+auto BlockDiagonalMatrix::block(Index irow, Index nrows) const -> MatrixConstRef
+{
+    const Index iblock = indexBlockWithRow(irow);
+    const Index local = irow - m_offsets[iblock];
+    Assert(local + nrows <= m_sizes[iblock],
+        "Could not get the requested diagonal submatrix of the block-diagonal matrix.",
+        "The submatrix is not contained in a single diagonal block.");
+    return block(iblock).block(local, local, nrows, nrows);
+}
+
+auto BlockDiagonalMatrix::row(Index irow) const -> RowVector
+{
+    const Index iblock = indexBlockWithRow(irow);
+    const Index offset = m_offsets[iblock];
+    RowVector res = RowVector::Zero(cols());
+    res.segment(offset, m_sizes[iblock]) = block(iblock).row(irow - offset);
+    return res;
+}
+
+auto BlockDiagonalMatrix::diagonal() const -> Vector
+{
+    Vector res(rows());
+    for(Index i = 0; i < numBlocks(); ++i)
+        res.segment(m_offsets[i], m_sizes[i]) = block(i).diagonal();
+    return res;
+}
+
+auto BlockDiagonalMatrix::dense() const -> Matrix
+{
+    Matrix res = zeros(rows(), cols());
+    for(Index i = 0; i < numBlocks(); ++i)
+        res.block(m_offsets[i], m_offsets[i], m_sizes[i], m_sizes[i]) = block(i);
+    return res;
+}
+
+auto BlockDiagonalMatrix::dense(const Indices& irows) const -> Matrix
+{
+    const Index n = irows.size();
+
+    // The position of each row of the matrix in the submatrix (or n if not in it)
+    Indices pos(rows(), n);
+    for(Index k = 0; k < n; ++k)
+        pos[irows[k]] = k;
+
+    Matrix res = zeros(n, n);
+    for(Index k = 0; k < n; ++k)
+    {
+        const Index iblock = indexBlockWithRow(irows[k]);
+        const Index offset = m_offsets[iblock];
+        const auto blk = block(iblock);
+        for(Index j = 0; j < m_sizes[iblock]; ++j)
+            if(pos[offset + j] < n)
+                res(k, pos[offset + j]) = blk(irows[k] - offset, j);
+    }
+    return res;
+}
+
+BlockDiagonalMatrix::operator Matrix() const
+{
+    return dense();
+}
+
+auto BlockDiagonalMatrix::data() -> VectorRef
+{
+    return m_data;
+}
+
+auto BlockDiagonalMatrix::data() const -> VectorConstRef
+{
+    return m_data;
+}
+
+auto operator*(const BlockDiagonalMatrix& A, VectorConstRef x) -> Vector
+{
+    Assert(A.cols() == Index(x.rows()),
+        "Could not multiply the block-diagonal matrix with the vector.",
+        "The number of columns of the matrix and the number of rows of the vector do not match.");
+    Vector res(A.rows());
+    for(Index i = 0; i < A.numBlocks(); ++i)
+    {
+        const Index offset = A.blockOffset(i);
+        const Index size = A.blockSize(i);
+        res.segment(offset, size).noalias() = A.block(i) * x.segment(offset, size);
+    }
+    return res;
+}
+
+} // namespace Reaktoro
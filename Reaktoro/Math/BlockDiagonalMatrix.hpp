@@ -0,0 +1,123 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+/// A class that represents a square block-diagonal matrix.
+/// The blocks are stored contiguously in column-major order, one after the other, so that
+/// the memory required is the sum of the squares of the block sizes, instead of the square
+/// of their sum. This is the structure of the molar derivatives of species properties in a
+/// multiphase system, since the species in different phases do not interact.
+class BlockDiagonalMatrix
+{
+public:
+    /// Construct a default BlockDiagonalMatrix instance.
+    BlockDiagonalMatrix();
+
+    /// Construct a BlockDiagonalMatrix instance with given block sizes.
+    /// @param sizes The number of rows (and columns) of each diagonal block.
+    explicit BlockDiagonalMatrix(const Indices& sizes);
+
+    /// Resize this BlockDiagonalMatrix instance with given block sizes.
+    /// @param sizes The number of rows (and columns) of each diagonal block.
+    auto resize(const Indices& sizes) -> void;
+
+    /// Set all entries of the diagonal blocks to zero.
+    auto setZero() -> void;
+
+    /// Return the number of rows of the matrix.
+    auto rows() const -> Index;
+
+    /// Return the number of columns of the matrix.
+    auto cols() const -> Index;
+
+    /// Return the number of diagonal blocks of the matrix.
+    auto numBlocks() const -> Index;
+
+    /// Return the number of rows (and columns) of a diagonal block.
+    auto blockSize(Index iblock) const -> Index;
+
+    /// Return the index of the first row (and column) of a diagonal block.
+    auto blockOffset(Index iblock) const -> Index;
+
+    /// Return the index of the diagonal block that contains a row.
+    auto indexBlockWithRow(Index irow) const -> Index;
+
+    /// Return a mutable view of a diagonal block.
+    auto block(Index iblock) -> MatrixMap;
+
+    /// Return a constant view of a diagonal block.
+    auto block(Index iblock) const -> MatrixConstMap;
+
+    /// Return a mutable view of a square submatrix on the diagonal.
+    /// The submatrix must be contained in a single diagonal block.
+    /// @param irow The index of the first row (and column) of the submatrix.
+    /// @param nrows The number of rows (and columns) of the submatrix.
+    auto block(Index irow, Index nrows) -> MatrixRef;
+
+    /// Return a constant view of a square submatrix on the diagonal.
+    /// The submatrix must be contained in a single diagonal block.
+    /// @param irow The index of the first row (and column) of the submatrix.
+    /// @param nrows The number of rows (and columns) of the submatrix.
+    auto block(Index irow, Index nrows) const -> MatrixConstRef;
+
+    /// Return a row of the matrix as a dense row vector.
+    auto row(Index irow) const -> RowVector;
+
+    /// Return the diagonal entries of the matrix.
+    auto diagonal() const -> Vector;
+
+    /// Return the matrix as a dense matrix.
+    auto dense() const -> Matrix;
+
+    /// Return the dense square submatrix with given rows and columns.
+    /// @param irows The indices of the rows (and columns) of the submatrix.
+    auto dense(const Indices& irows) const -> Matrix;
+
+    /// Convert this BlockDiagonalMatrix instance into a dense matrix.
+    operator Matrix() const;
+
+    /// Return the entries of the diagonal blocks stored contiguously.
+    auto data() -> VectorRef;
+
+    /// Return the entries of the diagonal blocks stored contiguously.
+    auto data() const -> VectorConstRef;
+
+private:
+    /// The entries of the diagonal blocks stored contiguously in column-major order.
+    Vector m_data;
+
+    /// The number of rows (and columns) of each diagonal block.
+    Indices m_sizes;
+
+    /// The index of the first row (and column) of each diagonal block, with the number of rows at the end.
+    Indices m_offsets;
+
+    /// The position of the first entry of each diagonal block in the data vector.
+    Indices m_starts;
+};
+
+/// Return the product of a block-diagonal matrix and a vector.
+auto operator*(const BlockDiagonalMatrix& A, VectorConstRef x) -> Vector;
+
+} // namespace Reaktoro
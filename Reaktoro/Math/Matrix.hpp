@@ -45,6 +45,21 @@ using MatrixConstRef = Eigen::Ref<const Eigen::MatrixXd>; ///< Alias to Eigen ty
 using MatrixMap      = Eigen::Map<Eigen::MatrixXd>;       ///< Alias to Eigen type Map<MatrixXd>.
 using MatrixConstMap = Eigen::Map<const Eigen::MatrixXd>; ///< Alias to Eigen type Map<const MatrixXd>.
 
+/// Alias to an Eigen column vector type with a fixed number of rows, or with a dynamic number of rows
+/// (`Eigen::Dynamic`) stored inline up to a maximum number of rows.
+template<int Rows, int MaxRows = Rows>
+using VectorFixed = Eigen::Matrix<double, Rows, 1, Eigen::ColMajor, MaxRows, 1>;
+
+/// Alias to an Eigen row vector type with a fixed number of columns, or with a dynamic number of columns
+/// (`Eigen::Dynamic`) stored inline up to a maximum number of columns.
+template<int Cols, int MaxCols = Cols>
+using RowVectorFixed = Eigen::Matrix<double, 1, Cols, Eigen::RowMajor, 1, MaxCols>;
+
+/// Alias to an Eigen matrix type with a fixed number of rows and columns, or with a dynamic number of
+/// rows and columns (`Eigen::Dynamic`) stored inline up to a maximum number of rows and columns.
+template<int Rows, int Cols, int MaxRows = Rows, int MaxCols = Cols>
+using MatrixFixed = Eigen::Matrix<double, Rows, Cols, Eigen::ColMajor, MaxRows, MaxCols>;
+
 using Vector = Eigen::VectorXd; /// Alias to Eigen type Eigen::VectorXd.
 using VectorXd = Eigen::VectorXd; /// Alias to Eigen type Eigen::VectorXd.
 using VectorXi = Eigen::VectorXi; /// Alias to Eigen type Eigen::VectorXi.
@@ -318,6 +333,16 @@ auto inv(const Eigen::MatrixBase<Derived>& mat) -> decltype(mat.cwiseInverse());
 template<typename Derived>
 auto diag(const Eigen::MatrixBase<Derived>& vec) -> decltype(vec.asDiagonal());
 
+/// The type used to store a matrix operand inside an expression of other matrices.
+/// Plain matrices and vectors are stored by reference and matrix expressions by value, as done by Eigen.
+template<typename Type>
+using NestedType = typename Eigen::internal::ref_selector<typename std::decay<Type>::type>::type;
+
+/// The plain matrix or vector type that stores the evaluation of a matrix operand or expression.
+/// The plain type of an expression of fixed-size matrices is also a fixed-size matrix.
+template<typename Type>
+using PlainType = typename std::decay<Type>::type::PlainObject;
+
 /// Return a vector representation of the diagonal of a matrix
 template<typename Derived>
 auto diagonal(Eigen::MatrixBase<Derived>& mat) -> decltype(mat.diagonal());
@@ -400,7 +425,7 @@ auto sqrt(const Eigen::MatrixBase<Derived>& mat) -> decltype(mat.cwiseSqrt());
 
 /// Return the component-wise exponential of a matrix
 template<typename Derived>
-auto pow(const Eigen::MatrixBase<Derived>& mat, double power) -> decltype(mat.array().pow(power));
+auto pow(const Eigen::MatrixBase<Derived>& mat, double power) -> decltype(mat.array().pow(power).matrix());
 
 /// Return the component-wise natural exponential of a matrix
 template<typename Derived>
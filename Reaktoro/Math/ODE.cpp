@@ -19,7 +19,9 @@
 
 // Sundials includes
 #include <cvode/cvode.h>
+#include <cvode/cvode_band.h>
 #include <cvode/cvode_dense.h>
+#include <cvode/cvode_spgmr.h>
 #include <nvector/nvector_serial.h>
 
 // Reaktoro includes
@@ -27,8 +29,8 @@
 
 namespace Reaktoro {
 
-#define VecEntry(v, i)    NV_Ith_S(v, i)
-#define MatEntry(A, i, j) DENSE_ELEM(A, i, j)
+#define VecData(v)             NV_DATA_S(v)
+#define BandMatEntry(A, i, j)  BAND_ELEM(A, i, j)
 
 #define CheckInitialize(r) \
     Assert(r == CV_SUCCESS, \
@@ -48,20 +50,38 @@ inline int CVODEMaxStepOrder(const ODEOptions& options);
 
 int CVODEFunction(realtype t, N_Vector y, N_Vector ydot, void* user_data);
 int CVODEJacobian(long int N, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+int CVODEBandJacobian(long int N, long int mupper, long int mlower, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+int CVODEPreconditionerSetup(realtype t, N_Vector y, N_Vector fy, booleantype jok, booleantype* jcur, realtype gamma, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+int CVODEPreconditionerSolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, realtype gamma, realtype delta, int lr, void* user_data, N_Vector tmp);
 
 struct ODEData
 {
-    ODEData(const ODEProblem& problem, VectorRef y, VectorRef f, MatrixRef J)
-    : problem(problem), y(y), f(f), J(J), num_equations(problem.numEquations())
+    ODEData(const ODEProblem& problem, Matrix& J)
+    : problem(problem), J(J), num_equations(problem.numEquations())
     {}
 
+    /// The ODE problem with the right-hand side function and its Jacobian.
     const ODEProblem& problem;
-    VectorRef y;
-    VectorRef f;
-    MatrixRef J;
+
+    /// The auxiliary dense matrix for the Jacobian evaluation when using the banded linear solver.
+    Matrix& J;
+
+    /// The number of differential equations
     int num_equations;
 };
 
+/// Return true if a CVODE context created with options `l` can be reinitialized with options `r`.
+/// Note that a stop time cannot be cleared from a CVODE context once it has been set.
+inline bool CVODEReusable(const ODEOptions& l, const ODEOptions& r)
+{
+    return l.step == r.step && l.iteration == r.iteration &&
+        CVODEMaxStepOrder(l) == CVODEMaxStepOrder(r) &&
+        l.linear_solver == r.linear_solver &&
+        l.band_upper == r.band_upper && l.band_lower == r.band_lower &&
+        l.krylov_max_dimension == r.krylov_max_dimension &&
+        (l.stop_time == 0.0 || r.stop_time != 0.0);
+}
+
 struct ODEProblem::Impl
 {
     /// The number of ordinary differential equations
@@ -72,6 +92,12 @@ struct ODEProblem::Impl
 
     /// The Jacobian of the right-hand side function of the system of ordinary differential equations
     ODEJacobian ode_jacobian;
+
+    /// The function that prepares the preconditioner used with the Krylov linear solver
+    ODEPreconditionerSetup ode_preconditioner_setup;
+
+    /// The function that solves the preconditioner system used with the Krylov linear solver
+    ODEPreconditionerSolve ode_preconditioner_solve;
 };
 
 struct ODESolver::Impl
@@ -88,18 +114,28 @@ struct ODESolver::Impl
     /// The CVODE vector y
     N_Vector cvode_y;
 
-    /// The auxiliary vector y
-    Vector y;
+    /// The CVODE vector of absolute tolerances
+    N_Vector cvode_abstols;
+
+    /// The options used to create the current CVODE context
+    ODEOptions cvode_options;
+
+    /// The flag that indicates if the current CVODE context uses the Jacobian function of the ODE problem
+    bool cvode_jacobian = false;
 
-    /// The auxiliary vector f for the function evaluation
-    Vector f;
+    /// The flag that indicates if the current CVODE context uses the preconditioner of the ODE problem
+    bool cvode_preconditioner = false;
 
-    /// The auxiliary matrix J for the Jacobian evaluation
+    /// The auxiliary matrix J for the Jacobian evaluation when using the banded linear solver
     Matrix J;
 
+    /// The ODE data passed to the CVODE callback functions, kept alive with the CVODE context
+    /// since the Krylov linear solver saves its pointer when it is attached to the context
+    ODEData data;
+
     /// Construct a default ODESolver::Impl instance
     Impl()
-    : cvode_mem(0), cvode_y(0)
+    : cvode_mem(0), cvode_y(0), cvode_abstols(0), data(problem, J)
     {}
 
     ~Impl()
@@ -109,6 +145,9 @@ struct ODESolver::Impl
 
         // Free dynamic memory allocated for y
         if(cvode_y) N_VDestroy_Serial(cvode_y);
+
+        // Free dynamic memory allocated for the absolute tolerances
+        if(cvode_abstols) N_VDestroy_Serial(cvode_abstols);
     }
 
     /// Initializes the ODE solver
@@ -127,44 +166,87 @@ struct ODESolver::Impl
         // The number of differential equations
         const int num_equations = problem.numEquations();
 
-        // Allocate memory for f and J
-        f.resize(num_equations);
-        J.resize(num_equations, num_equations);
-
-        // Free any dynamic memory allocated for cvode_mem context
-        if(cvode_mem) CVodeFree(&cvode_mem);
-
-        // Free dynamic memory allocated for y
-        if(cvode_y) N_VDestroy_Serial(cvode_y);
-
-        // Initialize a new vector y
-        cvode_y = N_VNew_Serial(num_equations);
-        for(int i = 0; i < num_equations; ++i)
-            VecEntry(cvode_y, i) = y[i];
+        // Update the number of equations in the ODE data passed to the CVODE callback functions
+        data.num_equations = num_equations;
 
-        // Initialize a new cvode context
-        cvode_mem = CVodeCreate(CVODEStep(options.step), CVODEIteration(options.iteration));
+        // Check if the current cvode context can be reinitialized instead of created again
+        const bool reusable = cvode_mem && NV_LENGTH_S(cvode_y) == num_equations &&
+            cvode_jacobian == bool(problem.jacobian()) &&
+            cvode_preconditioner == bool(problem.preconditionerSolve()) &&
+            CVODEReusable(cvode_options, options);
 
-        // Set the maximum order of the Adams or BDF methods
-        CheckInitialize(CVodeSetMaxOrd(cvode_mem, CVODEMaxStepOrder(options)));
-
-        // Check if the cvode creation succeeded
-        Assert(cvode_mem != NULL,
-            "Cannot proceed with ODESolver::initialize to initialize the solver.",
-            "There was an error creating the CVODE context.");
+        if(reusable)
+        {
+            // Set the new initial values of y
+            VectorMap(VecData(cvode_y), num_equations) = y;
 
-        // Initialize the cvode context
-        CheckInitialize(CVodeInit(cvode_mem, CVODEFunction, tstart, cvode_y));
+            // Reinitialize the cvode context, keeping its allocated memory and linear solver
+            CheckInitialize(CVodeReInit(cvode_mem, tstart, cvode_y));
+        }
+        else
+        {
+            // Free any dynamic memory allocated for cvode_mem context
+            if(cvode_mem) CVodeFree(&cvode_mem);
+
+            // Free dynamic memory allocated for y and the absolute tolerances
+            if(cvode_y) N_VDestroy_Serial(cvode_y);
+            if(cvode_abstols) N_VDestroy_Serial(cvode_abstols);
+
+            // Initialize a new vector y and a new vector of absolute tolerances
+            cvode_y = N_VNew_Serial(num_equations);
+            cvode_abstols = N_VNew_Serial(num_equations);
+            VectorMap(VecData(cvode_y), num_equations) = y;
+
+            // Initialize a new cvode context
+            cvode_mem = CVodeCreate(CVODEStep(options.step), CVODEIteration(options.iteration));
+
+            // Check if the cvode creation succeeded
+            Assert(cvode_mem != NULL,
+                "Cannot proceed with ODESolver::initialize to initialize the solver.",
+                "There was an error creating the CVODE context.");
+
+            // Set the user-defined data to cvode_mem before attaching the linear solver
+            CheckInitialize(CVodeSetUserData(cvode_mem, &data));
+
+            // Set the maximum order of the Adams or BDF methods
+            CheckInitialize(CVodeSetMaxOrd(cvode_mem, CVODEMaxStepOrder(options)));
+
+            // Initialize the cvode context
+            CheckInitialize(CVodeInit(cvode_mem, CVODEFunction, tstart, cvode_y));
+
+            // Set the dense, banded, or Krylov linear solver, with the analytical Jacobian or the preconditioner if provided
+            if(options.linear_solver == ODELinearSolverMode::SPGMR)
+            {
+                J.resize(0, 0);
+                const int pretype = problem.preconditionerSolve() ? PREC_LEFT : PREC_NONE;
+                CheckInitialize(CVSpgmr(cvode_mem, pretype, int(options.krylov_max_dimension)));
+                if(problem.preconditionerSolve()) CheckInitialize(CVSpilsSetPreconditioner(cvode_mem,
+                    problem.preconditionerSetup() ? CVODEPreconditionerSetup : NULL, CVODEPreconditionerSolve));
+            }
+            else if(options.linear_solver == ODELinearSolverMode::Band)
+            {
+                J.resize(num_equations, num_equations);
+                CheckInitialize(CVBand(cvode_mem, num_equations, options.band_upper, options.band_lower));
+                if(problem.jacobian()) CheckInitialize(CVDlsSetBandJacFn(cvode_mem, CVODEBandJacobian));
+            }
+            else
+            {
+                J.resize(0, 0);
+                CheckInitialize(CVDense(cvode_mem, num_equations));
+                if(problem.jacobian()) CheckInitialize(CVDlsSetDenseJacFn(cvode_mem, CVODEJacobian));
+            }
+
+            // Save the options used to create the cvode context
+            cvode_options = options;
+            cvode_jacobian = bool(problem.jacobian());
+            cvode_preconditioner = bool(problem.preconditionerSolve());
+        }
 
         // Initialize the vector of absolute tolerances
-        N_Vector abstols = N_VNew_Serial(num_equations);
-
         if(options.abstols.size() == num_equations)
-            for(int i = 0; i < num_equations; ++i)
-                VecEntry(abstols, i) = options.abstols[i];
+            VectorMap(VecData(cvode_abstols), num_equations) = options.abstols;
         else
-            for(int i = 0; i < num_equations; ++i)
-                VecEntry(abstols, i) = options.abstol;
+            VectorMap(VecData(cvode_abstols), num_equations).fill(options.abstol);
 
         // Set the parameters for the calculation
         CheckInitialize(CVodeSetStabLimDet(cvode_mem, options.stability_limit_detection));
@@ -178,47 +260,25 @@ struct ODESolver::Impl
         CheckInitialize(CVodeSetMaxNonlinIters(cvode_mem, int(options.max_num_nonlinear_iterations)));
         CheckInitialize(CVodeSetMaxConvFails(cvode_mem, int(options.max_num_convergence_failures)));
         CheckInitialize(CVodeSetNonlinConvCoef(cvode_mem, options.nonlinear_convergence_coefficient));
-        CheckInitialize(CVodeSVtolerances(cvode_mem, options.reltol, abstols));
-
-        // Call CVDense to specify the CVDENSE dense linear solver
-        CheckInitialize(CVDense(cvode_mem, num_equations));
-
-        // Set the Jacobian function
-        CheckInitialize(CVDlsSetDenseJacFn(cvode_mem, CVODEJacobian));
-
-        // Free dynamic memory allocated for `yc`
-        N_VDestroy_Serial(abstols);
+        CheckInitialize(CVodeSVtolerances(cvode_mem, options.reltol, cvode_abstols));
     }
 
     /// Integrate the ODE performing a single step.
     auto integrate(double& t, VectorRef y) -> void
     {
-        // Initialize the ODE data
-        ODEData data(problem, y, f, J);
-
         // Define an infinite time.
         double tfinal = 10*(t + 1);
 
-        // Set the user-defined data to cvode_mem
-        CheckIntegration(CVodeSetUserData(cvode_mem, &data));
-
         // Solve the ode problem from `tstart` to `tfinal`
         CheckIntegration(CVode(cvode_mem, tfinal, cvode_y, &t, CV_ONE_STEP));
 
         // Transfer the result from cvode_y to y
-        for(int i = 0; i < data.num_equations; ++i)
-            y[i] = VecEntry(cvode_y, i);
+        y = VectorConstMap(VecData(cvode_y), data.num_equations);
     }
 
     /// Integrate the ODE performing a single step not going over a given time.
     auto integrate(double& t, VectorRef y, double tfinal) -> void
     {
-        // Initialize the ODE data
-        ODEData data(problem, y, f, J);
-
-        // Set the user-defined data to cvode_mem
-        CheckIntegration(CVodeSetUserData(cvode_mem, &data));
-
         // Solve the ode problem from `tstart` to `tfinal`
         CheckIntegration(CVode(cvode_mem, tfinal, cvode_y, &t, CV_ONE_STEP));
 
@@ -233,8 +293,7 @@ struct ODESolver::Impl
         }
 
         // Transfer the result from cvode_y to y
-        for(int i = 0; i < data.num_equations; ++i)
-            y[i] = VecEntry(this->cvode_y, i);
+        y = VectorConstMap(VecData(cvode_y), data.num_equations);
     }
 
     /// Solve the ODE equations from a given start time to a final one.
@@ -243,18 +302,11 @@ struct ODESolver::Impl
         // Initialize the cvode context
         initialize(t, y);
 
-        // Initialize the ODE data
-        ODEData data(problem, y, f, J);
-
-        // Set the user-defined data to cvode_mem
-        CheckIntegration(CVodeSetUserData(cvode_mem, &data));
-
         // Solve the ode problem from `tstart` to `tfinal`
         CheckIntegration(CVode(cvode_mem, t + dt, cvode_y, &t, CV_NORMAL));
 
         // Transfer the result from cvode_y to y
-        for(int i = 0; i < data.num_equations; ++i)
-            y[i] = VecEntry(this->cvode_y, i);
+        y = VectorConstMap(VecData(cvode_y), data.num_equations);
     }
 };
 
@@ -289,33 +341,70 @@ int CVODEFunction(realtype t, N_Vector y, N_Vector f, void* user_data)
 {
     ODEData& data = *static_cast<ODEData*>(user_data);
 
-    for(int i = 0; i < data.num_equations; ++i)
-        data.y[i] = VecEntry(y, i);
+    // Map the CVODE vectors y and f without copying their data
+    const VectorConstMap ymap(VecData(y), data.num_equations);
+    VectorMap fmap(VecData(f), data.num_equations);
+
+    return data.problem.function(t, ymap, fmap);
+}
+
+int CVODEJacobian(long int N, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    // Map the CVODE vector y and the column-major storage of the dense matrix J without copying their data
+    const VectorConstMap ymap(VecData(y), data.num_equations);
+    Eigen::Map<Matrix, 0, Eigen::OuterStride<>> Jmap(J->data, N, N, Eigen::OuterStride<>(J->ldim));
+
+    return data.problem.jacobian(t, ymap, Jmap);
+}
+
+int CVODEBandJacobian(long int N, long int mupper, long int mlower, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    // Map the CVODE vector y without copying its data
+    const VectorConstMap ymap(VecData(y), data.num_equations);
 
-    int result = data.problem.function(t, data.y, data.f);
+    // Evaluate the Jacobian in the auxiliary dense matrix
+    int result = data.problem.jacobian(t, ymap, data.J);
 
-    for(int i = 0; i < data.num_equations; ++i)
-        VecEntry(f, i) = data.f[i];
+    // Transfer only the entries within the band to the banded matrix J
+    for(long int j = 0; j < N; ++j)
+        for(long int i = std::max(0L, j - mupper); i <= std::min(N - 1, j + mlower); ++i)
+            BandMatEntry(J, i, j) = data.J(i, j);
 
     return result;
 }
 
-int CVODEJacobian(long int N, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+int CVODEPreconditionerSetup(realtype t, N_Vector y, N_Vector fy, booleantype jok, booleantype* jcur, realtype gamma, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
 {
     ODEData& data = *static_cast<ODEData*>(user_data);
 
-    for(int i = 0; i < data.num_equations; ++i)
-        data.y[i] = VecEntry(y, i);
+    // Map the CVODE vector y without copying its data
+    const VectorConstMap ymap(VecData(y), data.num_equations);
 
-    int result = data.problem.jacobian(t, data.y, data.J);
+    bool jacobian_updated = false;
 
-    for(int i = 0; i < data.num_equations; ++i)
-        for(int j = 0; j < data.num_equations; ++j)
-            MatEntry(J, i, j) = data.J(i, j);
+    int result = data.problem.preconditionerSetup()(t, ymap, jok, jacobian_updated, gamma);
+
+    *jcur = jacobian_updated;
 
     return result;
 }
 
+int CVODEPreconditionerSolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, realtype gamma, realtype delta, int lr, void* user_data, N_Vector tmp)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    // Map the CVODE vectors y, r, and z without copying their data
+    const VectorConstMap ymap(VecData(y), data.num_equations);
+    const VectorConstMap rmap(VecData(r), data.num_equations);
+    VectorMap zmap(VecData(z), data.num_equations);
+
+    return data.problem.preconditionerSolve()(t, ymap, rmap, zmap, gamma);
+}
+
 ODEProblem::ODEProblem()
 : pimpl(new Impl())
 {}
@@ -348,6 +437,12 @@ auto ODEProblem::setJacobian(const ODEJacobian& J) -> void
     pimpl->ode_jacobian = J;
 }
 
+auto ODEProblem::setPreconditioner(const ODEPreconditionerSetup& setup, const ODEPreconditionerSolve& solve) -> void
+{
+    pimpl->ode_preconditioner_setup = setup;
+    pimpl->ode_preconditioner_solve = solve;
+}
+
 auto ODEProblem::initialized() const -> bool
 {
     return numEquations() && function();
@@ -368,6 +463,16 @@ auto ODEProblem::jacobian() const -> const ODEJacobian&
     return pimpl->ode_jacobian;
 }
 
+auto ODEProblem::preconditionerSetup() const -> const ODEPreconditionerSetup&
+{
+    return pimpl->ode_preconditioner_setup;
+}
+
+auto ODEProblem::preconditionerSolve() const -> const ODEPreconditionerSolve&
+{
+    return pimpl->ode_preconditioner_solve;
+}
+
 auto ODEProblem::function(double t, VectorConstRef y, VectorRef f) const -> int
 {
     return function()(t, y, f);
@@ -32,12 +32,24 @@ using ODEFunction = std::function<int(double, VectorConstRef, VectorRef)>;
 /// The function signature of the Jacobian of the right-hand side function of a system of ordinary differential equations.
 using ODEJacobian = std::function<int(double, VectorConstRef, MatrixRef)>;
 
+/// The function signature of the setup of a preconditioner `P` for the Newton matrix `I - gamma*J` used with the Krylov linear solver.
+/// The arguments are the time `t`, the y-variables `y`, the flag `jok` indicating that saved Jacobian data can be reused,
+/// the output flag `jcur` that must be set to true if the Jacobian data was recomputed, and the scalar `gamma`.
+using ODEPreconditionerSetup = std::function<int(double, VectorConstRef, bool, bool&, double)>;
+
+/// The function signature of the solution of the preconditioner system `P*z = r` used with the Krylov linear solver.
+/// The arguments are the time `t`, the y-variables `y`, the right-hand side vector `r`, the solution vector `z`, and the scalar `gamma`.
+using ODEPreconditionerSolve = std::function<int(double, VectorConstRef, VectorConstRef, VectorRef, double)>;
+
 /// The linear multistep method to be used in ODESolver.
 enum class ODEStepMode { Adams, BDF };
 
 /// The type of nonlinear solver iteration to be used in ODESolver.
 enum class ODEIterationMode { Functional, Newton };
 
+/// The linear solver used in the Newton iterations of ODESolver.
+enum class ODELinearSolverMode { Dense, Band, SPGMR };
+
 /// A struct that defines the options for the ODESolver.
 /// @see ODESolver, ODEProblem
 struct ODEOptions
@@ -103,6 +115,22 @@ struct ODEOptions
 
     /// The vector of absolute error tolerances for each component.
     Vector abstols;
+
+    /// The linear solver used in the Newton iterations.
+    /// The banded solver should be used when the Jacobian of the ODE has a banded structure,
+    /// such as in the discretization of one-dimensional transport problems. The SPGMR solver
+    /// is a matrix-free Krylov method that uses the preconditioner of the ODE problem, if any.
+    ODELinearSolverMode linear_solver = ODELinearSolverMode::Dense;
+
+    /// The upper half-bandwidth of the Jacobian used with the banded linear solver.
+    unsigned band_upper = 0;
+
+    /// The lower half-bandwidth of the Jacobian used with the banded linear solver.
+    unsigned band_lower = 0;
+
+    /// The maximum dimension of the Krylov subspace used with the SPGMR linear solver.
+    /// The default dimension of CVODE (5) is used if its value is zero.
+    unsigned krylov_max_dimension = 0;
 };
 
 /// A class that defines a system of ordinary differential equations (ODE) problem.
@@ -131,6 +159,11 @@ public:
     /// Set the Jacobian of the right-hand side function of the system of ordinary differential equations
     auto setJacobian(const ODEJacobian& J) -> void;
 
+    /// Set the preconditioner of the Newton matrix used with the Krylov linear solver.
+    /// @param setup The function that prepares the preconditioner
+    /// @param solve The function that solves the preconditioner system
+    auto setPreconditioner(const ODEPreconditionerSetup& setup, const ODEPreconditionerSolve& solve) -> void;
+
     /// Return true if the problem has bee initialized.
     auto initialized() const -> bool;
 
@@ -143,6 +176,12 @@ public:
     /// Return the Jacobian of the right-hand side function of the system of ordinary differential equations
     auto jacobian() const -> const ODEJacobian&;
 
+    /// Return the function that prepares the preconditioner used with the Krylov linear solver
+    auto preconditionerSetup() const -> const ODEPreconditionerSetup&;
+
+    /// Return the function that solves the preconditioner system used with the Krylov linear solver
+    auto preconditionerSolve() const -> const ODEPreconditionerSolve&;
+
     /// Evaluate the right-hand side function of the system of ordinary differential equations.
     /// @param t The time variable of the function
     /// @param y The y-variables of the function
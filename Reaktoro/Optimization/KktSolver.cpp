@@ -27,6 +27,7 @@ using namespace Eigen;
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
+#include <Reaktoro/Optimization/Utils.hpp>
 
 namespace Reaktoro {
 
@@ -488,48 +489,94 @@ struct KktSolver::Impl
     KktSolverNullspace kkt_nullspace;
     KktSolverRangespaceDiagonal kkt_rangespace_diagonal;
     KktSolverRangespaceInverse kkt_rangespace_inverse;
-    KktSolverBase* base;
+    KktSolverBase* base = nullptr;
+
+    /// The copy of the last KKT matrix, whose decomposition may not be available if a stale one is reused
+    Hessian H;
+    Matrix A;
+    Vector x, z;
+    double gamma = 0.0, delta = 0.0;
+
+    /// The flag that indicates if the decomposition in `base` is of a previous KKT matrix
+    bool stale = false;
+
+    /// The right-hand side of the KKT equation with `dz` eliminated, and its residual in the iterative refinement
+    KktVector reduced, residual;
+
+    /// The correction of the solution of the KKT equation in the iterative refinement
+    KktSolution correction;
 
     auto decompose(const KktMatrix& lhs) -> void;
 
     auto solve(const KktVector& rhs, KktSolution& sol) -> void;
+
+    /// Return true if the decomposition in `base` can be reused for a new KKT matrix.
+    auto reusable(KktSolverBase* selected, const KktMatrix& lhs) const -> bool;
+
+    /// Solve the KKT equation with iterative refinement using the stale decomposition in `base`.
+    /// @return true if the refinement converged, false otherwise.
+    auto refine(const KktVector& rhs, KktSolution& sol) -> bool;
 };
 
 auto KktSolver::Impl::decompose(const KktMatrix& lhs) -> void
 {
+    KktSolverBase* selected = base;
+
     if(options.method == KktMethod::Automatic)
     {
         if(lhs.H.mode == Hessian::Dense)
-            base = &kkt_partial_lu;
+            selected = &kkt_partial_lu;
 
         if(lhs.H.mode == Hessian::Diagonal)
-            base = &kkt_rangespace_diagonal;
+            selected = &kkt_rangespace_diagonal;
 
         if(lhs.H.mode == Hessian::Inverse)
-            base = &kkt_rangespace_inverse;
+            selected = &kkt_rangespace_inverse;
     }
 
     if(options.method == KktMethod::PartialPivLU)
-        base = &kkt_partial_lu;
+        selected = &kkt_partial_lu;
 
     if(options.method == KktMethod::FullPivLU)
-        base = &kkt_full_lu;
+        selected = &kkt_full_lu;
 
     if(options.method == KktMethod::Nullspace)
-        base = &kkt_nullspace;
+        selected = &kkt_nullspace;
 
     if(options.method == KktMethod::Rangespace)
     {
         if(lhs.H.mode == Hessian::Diagonal)
-            base = &kkt_rangespace_diagonal;
+            selected = &kkt_rangespace_diagonal;
 
         if(lhs.H.mode == Hessian::Inverse)
-            base = &kkt_rangespace_inverse;
+            selected = &kkt_rangespace_inverse;
     }
 
     Time begin = time();
 
-    base->decompose(lhs);
+    result.num_decompositions = 0;
+    result.num_refinement_iterations = 0;
+
+    // Check if the decomposition of a previous KKT matrix should be reused in method solve
+    stale = reusable(selected, lhs);
+
+    if(!stale)
+    {
+        base = selected;
+        base->decompose(lhs);
+        ++result.num_decompositions;
+    }
+
+    // Keep a copy of the KKT matrix for the iterative refinement of later solutions
+    if(options.reuse_decomposition)
+    {
+        H = lhs.H;
+        A = lhs.A;
+        x = lhs.x;
+        z = lhs.z;
+        gamma = lhs.gamma;
+        delta = lhs.delta;
+    }
 
     result.succeeded = true;
     result.time_decompose = elapsed(begin);
@@ -539,12 +586,78 @@ auto KktSolver::Impl::solve(const KktVector& rhs, KktSolution& sol) -> void
 {
     Time begin = time();
 
-    base->solve(rhs, sol);
+    // Decompose the current KKT matrix if the iterative refinement with the stale decomposition fails
+    if(stale && !refine(rhs, sol))
+    {
+        base->decompose(KktMatrix(H, A, x, z, gamma, delta));
+        ++result.num_decompositions;
+        stale = false;
+    }
+
+    if(!stale)
+        base->solve(rhs, sol);
 
     result.succeeded = sol.dx.allFinite() && sol.dy.allFinite() && sol.dz.allFinite();
     result.time_solve = elapsed(begin);
 }
 
+auto KktSolver::Impl::reusable(KktSolverBase* selected, const KktMatrix& lhs) const -> bool
+{
+    // The methods whose decompositions do not depend on the KKT matrix at the time of method solve
+    const bool refinable = base == &kkt_partial_lu || base == &kkt_full_lu || base == &kkt_rangespace_diagonal;
+
+    return options.reuse_decomposition && refinable && selected == base &&
+        lhs.H.mode == H.mode && lhs.A.rows() == A.rows() && lhs.A.cols() == A.cols();
+}
+
+auto KktSolver::Impl::refine(const KktVector& rhs, KktSolution& sol) -> bool
+{
+    const Index n = A.cols();
+    const Index m = A.rows();
+
+    // Eliminate `dz` so that the stale decomposition is not used with its previous `x` and `z`
+    reduced.rx.noalias() = rhs.rx + rhs.rz/x;
+    reduced.ry.noalias() = rhs.ry;
+    residual.rz = zeros(n);
+
+    const double tolerance = options.refinement_tolerance * std::max(norminf(reduced.rx), norminf(reduced.ry));
+
+    sol.dx = zeros(n);
+    sol.dy = zeros(m);
+
+    double error_previous = infinity();
+
+    for(unsigned i = 0; i <= options.max_refinement_iterations; ++i)
+    {
+        // Compute the residual of the current KKT equation, in which `G = H + inv(X)*Z + gamma^2*I`
+        residual.rx.noalias() = reduced.rx - H*sol.dx - (z/x + gamma*gamma) % sol.dx + tr(A)*sol.dy;
+        residual.ry.noalias() = reduced.ry - A*sol.dx - delta*delta*sol.dy;
+
+        const double error = std::max(norminf(residual.rx), norminf(residual.ry));
+
+        if(error <= tolerance)
+        {
+            sol.dz.noalias() = (rhs.rz - z % sol.dx)/x;
+            return true;
+        }
+
+        // Stop if the refinement is not converging fast enough (or the error is not finite)
+        if(!(error < 0.5 * error_previous) || i == options.max_refinement_iterations)
+            return false;
+
+        error_previous = error;
+
+        // Correct the solution using the stale decomposition
+        base->solve(residual, correction);
+        sol.dx += correction.dx;
+        sol.dy += correction.dy;
+
+        ++result.num_refinement_iterations;
+    }
+
+    return false;
+}
+
 KktSolver::KktSolver()
 : pimpl(new Impl())
 {}
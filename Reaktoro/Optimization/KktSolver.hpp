@@ -37,6 +37,12 @@ struct KktResult
 
     /// The wall time spent for the solution of the KKT problem (in units of s)
     double time_solve = 0;
+
+    /// The number of decompositions of the KKT matrix since the last call to decompose
+    unsigned num_decompositions = 0;
+
+    /// The number of iterative refinement steps using a reused decomposition since the last call to decompose
+    unsigned num_refinement_iterations = 0;
 };
 
 /// An enumeration of possible methods for the solution of a KKT equation
@@ -72,6 +78,18 @@ struct KktOptions
 {
     /// The method for the solution of the KKT equations
     KktMethod method = KktMethod::Automatic;
+
+    /// The flag that indicates if the last decomposition of the KKT matrix should be reused for new KKT matrices.
+    /// The KKT equations are then solved with iterative refinement, in which the stale decomposition acts as a
+    /// preconditioner, and the KKT matrix is decomposed again only when the refinement stops converging.
+    /// This is only possible with the PartialPivLU, FullPivLU, and diagonal Rangespace methods.
+    bool reuse_decomposition = false;
+
+    /// The maximum number of iterative refinement steps when reusing a decomposition of the KKT matrix
+    unsigned max_refinement_iterations = 5;
+
+    /// The tolerance of the KKT residual, relative to the right-hand side, in the iterative refinement steps
+    double refinement_tolerance = 1e-10;
 };
 
 /// A type to represent the left-hand side matrix of a KKT equation
@@ -21,15 +21,17 @@ namespace Reaktoro {
 
 auto OptimumResult::operator+=(const OptimumResult& other) -> OptimumResult&
 {
-    succeeded              = other.succeeded;
-    iterations            += other.iterations;
-    num_objective_evals   += other.num_objective_evals;
-    convergence_rate       = other.convergence_rate;
-    error                  = other.error;
-    time                  += other.time;
-    time_objective_evals  += other.time_objective_evals;
-    time_constraint_evals += other.time_constraint_evals;
-    time_linear_systems   += other.time_linear_systems;
+    succeeded               = other.succeeded;
+    iterations             += other.iterations;
+    num_objective_evals    += other.num_objective_evals;
+    convergence_rate        = other.convergence_rate;
+    error                   = other.error;
+    time                   += other.time;
+    time_objective_evals   += other.time_objective_evals;
+    time_constraint_evals  += other.time_constraint_evals;
+    time_linear_systems    += other.time_linear_systems;
+    num_kkt_decompositions += other.num_kkt_decompositions;
+    num_kkt_refinements    += other.num_kkt_refinements;
 
     return *this;
 }
@@ -49,6 +49,12 @@ struct OptimumResult
     /// The wall time spent for all linear system solutions (in units of s)
     double time_linear_systems = 0;
 
+    /// The number of decompositions of the KKT matrix in the optimisation calculation
+    unsigned num_kkt_decompositions = 0;
+
+    /// The number of iterative refinement steps of the KKT equations using a reused decomposition
+    unsigned num_kkt_refinements = 0;
+
     /// Update this OptimumResult instance with another by addition
     auto operator+=(const OptimumResult& other) -> OptimumResult&;
 };
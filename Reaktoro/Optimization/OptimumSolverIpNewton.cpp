@@ -250,6 +250,10 @@ struct OptimumSolverIpNewton::Impl
             result.time_linear_systems += kkt.result().time_solve;
             result.time_linear_systems += kkt.result().time_decompose;
 
+            // Update the number of decompositions of the KKT matrix and of iterative refinement steps
+            result.num_kkt_decompositions += kkt.result().num_decompositions;
+            result.num_kkt_refinements += kkt.result().num_refinement_iterations;
+
             // Perform emergency Newton step calculation as long as steps contains NaN or INF values
             while(!kkt.result().succeeded)
             {
@@ -271,6 +275,8 @@ struct OptimumSolverIpNewton::Impl
                 // Update the time spent in linear systems
                 result.time_linear_systems += kkt.result().time_solve;
                 result.time_linear_systems += kkt.result().time_decompose;
+                result.num_kkt_decompositions += kkt.result().num_decompositions;
+                result.num_kkt_refinements += kkt.result().num_refinement_iterations;
             }
 
             // Return true if he calculation succeeded
@@ -16,10 +16,13 @@
 # along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 from reaktoro import (
+    ChemicalEditor,
+    ChemicalSystem,
     Database,
     Element,
 )
 
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 import locale
 import os
@@ -129,6 +132,60 @@ def test_elements_molar_mass(guard_locale):
     check_molar_mass({element.name(): element.molarMass() for element in database.elements()})
 
 
+def test_database_lazy_decoding_independent_of_locale(guard_locale):
+    """
+    Test that the species decoded on first request after the database was
+    loaded are the same regardless of the decimal separator of the locale.
+    """
+    reference = Database("supcrt07.xml")
+    expected = {s.name(): (s.charge(), s.molarMass()) for s in reference.aqueousSpecies()}
+
+    database = Database("supcrt07.xml")
+
+    if not any(try_set_locale(loc) and locale_has_comma_for_decimal_separator() for loc in get_locales()):
+        pytest.skip("Couldn't find any locale with comma for decimal separator")
+
+    comma_locale = locale.setlocale(locale.LC_NUMERIC)
+
+    assert {s.name(): (s.charge(), s.molarMass()) for s in database.aqueousSpecies()} == expected
+    assert database.mineralSpecies("Calcite").molarMass() == pytest.approx(0.1000869)
+    assert locale.setlocale(locale.LC_NUMERIC) == comma_locale
+
+    def chemical_system(db):
+        editor = ChemicalEditor(db)
+        editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCO3")
+        editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+        editor.addMineralPhase("Calcite")
+        return ChemicalSystem(editor)
+
+    properties = chemical_system(database).properties(298.15, 1e5)
+    reference_properties = chemical_system(reference).properties(298.15, 1e5)
+
+    assert list(properties.standardPartialMolarGibbsEnergies().val) == list(reference_properties.standardPartialMolarGibbsEnergies().val)
+
+
+def test_database_concurrent_first_access():
+    """
+    Test that species requested for the first time from several threads at
+    once are decoded once and equal to the species decoded sequentially.
+    """
+    reference = Database("supcrt98.xml")
+    names = [s.name() for s in reference.aqueousSpecies()]
+    expected = [(reference.aqueousSpecies(name).charge(), reference.aqueousSpecies(name).molarMass()) for name in names]
+
+    database = Database("supcrt98.xml")
+
+    def lookup(offset):
+        rotated = names[offset:] + names[:offset]
+        return {name: (database.aqueousSpecies(name).charge(), database.aqueousSpecies(name).molarMass()) for name in rotated}
+
+    with ThreadPoolExecutor(max_workers=8) as executor:
+        results = list(executor.map(lookup, range(0, 8 * 50, 50)))
+
+    for result in results:
+        assert [result[name] for name in names] == expected
+
+
 def test_invariant_database():
     database = Database("supcrt07.xml")
 
@@ -242,3 +299,108 @@ def test_database_looking_for_species_with_element():
     assert liquid_species_with_H_or_Fe[0].name() == "H2S(liq)"
     assert mineral_species_with_H_or_Fe[0].name() == "Pyrrhotite"
 
+
+def names_of_species_with_elements(species, elements):
+    """Return the names of the species whose elements, except charge, are all in a list of elements."""
+    return [s.name() for s in species if all(e.name() == "Z" or e.name() in elements for e in s.elements())]
+
+
+@pytest.mark.parametrize(
+    "elements",
+    [
+        [],
+        ["Z"],
+        ["H", "O"],
+        ["H", "O", "C", "Ca", "Cl", "Na"],
+        ["Fe", "S", "Xx"],
+        ["O", "U", "Zr"],
+        None,
+    ],
+    ids=["none", "charge only", "H O", "H O C Ca Cl Na", "Fe S and unknown", "O U Zr", "all"],
+)
+def test_database_species_with_elements_as_element_names(elements, tmpdir):
+    """Test that the species with elements match a filter by the element names of all species, as before the element masks."""
+    xml = Database("supcrt98.xml")
+
+    filename = str(tmpdir.join("supcrt98.rdb"))
+    xml.save(filename)
+    binary = Database(filename)
+
+    for database in [xml, binary]:
+        # The supcrt98 database has more than 64 elements, which makes the element masks span several words
+        if elements is None:
+            elements = [element.name() for element in database.elements()]
+
+        assert [s.name() for s in database.aqueousSpeciesWithElements(elements)] == \
+            names_of_species_with_elements(database.aqueousSpecies(), elements)
+        assert [s.name() for s in database.gaseousSpeciesWithElements(elements)] == \
+            names_of_species_with_elements(database.gaseousSpecies(), elements)
+        assert [s.name() for s in database.liquidSpeciesWithElements(elements)] == \
+            names_of_species_with_elements(database.liquidSpecies(), elements)
+        assert [s.name() for s in database.mineralSpeciesWithElements(elements)] == \
+            names_of_species_with_elements(database.mineralSpecies(), elements)
+
+
+
+def test_database_save_and_load_binary(tmpdir):
+    database = Database("supcrt98.xml")
+
+    filename = str(tmpdir.join("supcrt98.rdb"))
+    database.save(filename)
+
+    binary = Database(filename)
+
+    assert [e.name() for e in binary.elements()] == [e.name() for e in database.elements()]
+    assert [e.molarMass() for e in binary.elements()] == [e.molarMass() for e in database.elements()]
+    assert [s.name() for s in binary.aqueousSpecies()] == [s.name() for s in database.aqueousSpecies()]
+    assert [s.name() for s in binary.gaseousSpecies()] == [s.name() for s in database.gaseousSpecies()]
+    assert [s.name() for s in binary.liquidSpecies()] == [s.name() for s in database.liquidSpecies()]
+    assert [s.name() for s in binary.mineralSpecies()] == [s.name() for s in database.mineralSpecies()]
+
+    calcite = binary.mineralSpecies("Calcite")
+    assert calcite.molarMass() == database.mineralSpecies("Calcite").molarMass()
+    assert binary.aqueousSpecies("HCO3-").charge() == -1
+
+
+def test_database_binary_round_trip(tmpdir):
+    """
+    Test that a database saved in binary format and read back gives the same
+    species and standard thermodynamic properties as the XML database.
+    """
+    database = Database("supcrt98.xml")
+
+    filename = str(tmpdir.join("supcrt98.rdb"))
+    database.save(filename)
+
+    binary = Database(filename)
+
+    for species in database.aqueousSpecies():
+        other = binary.aqueousSpecies(species.name())
+        assert other.formula() == species.formula()
+        assert other.charge() == species.charge()
+        assert other.molarMass() == species.molarMass()
+
+    for species in database.mineralSpecies():
+        other = binary.mineralSpecies(species.name())
+        assert other.formula() == species.formula()
+        assert other.molarMass() == species.molarMass()
+
+    def chemical_system(db):
+        editor = ChemicalEditor(db)
+        editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCO3 MgCl2 CO2 SiO2")
+        editor.addGaseousPhase(["H2O(g)", "CO2(g)", "CH4(g)"])
+        editor.addMineralPhase("Calcite")
+        editor.addMineralPhase("Quartz")
+        editor.addMineralPhase("Dolomite")
+        return ChemicalSystem(editor)
+
+    system = chemical_system(database)
+    binary_system = chemical_system(binary)
+
+    assert [s.name() for s in binary_system.species()] == [s.name() for s in system.species()]
+
+    for T, P in [(298.15, 1e5), (373.15, 1e5), (473.15, 100e5)]:
+        properties = system.properties(T, P)
+        binary_properties = binary_system.properties(T, P)
+        assert list(binary_properties.standardPartialMolarGibbsEnergies().val) == list(properties.standardPartialMolarGibbsEnergies().val)
+        assert list(binary_properties.standardPartialMolarVolumes().val) == list(properties.standardPartialMolarVolumes().val)
@@ -19,16 +19,31 @@
 
 // C++ includes
 #include <clocale>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <locale>
 #include <map>
+#include <mutex>
 #include <set>
+#include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+// POSIX includes
+#if !_WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/GlobalOptions.hpp>
-#include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/Element.hpp>
@@ -52,12 +67,70 @@ using namespace pugi;
 namespace Reaktoro {
 namespace {
 
+/// A set of elements as a bitmask, in which the bit of each element is given by its interned index in the database
+using ElementMask = std::vector<std::uint64_t>;
+
+/// Return true if all elements in a mask are also in another mask.
+auto subset(const ElementMask& mask, const ElementMask& other) -> bool
+{
+    for(std::size_t i = 0; i < mask.size(); ++i)
+        if(mask[i] & ~(i < other.size() ? other[i] : 0))
+            return false;
+    return true;
+}
+
+/// Return the names of the elements in a species.
+auto elementNames(const Species& species) -> std::vector<std::string>
+{
+    std::vector<std::string> names;
+    for(const auto& pair : species.elements())
+        names.push_back(pair.first.name());
+    return names;
+}
+
+/// A species in the database, whose thermodynamic data is decoded only when the species is first requested.
+template<typename SpeciesType>
+class SpeciesEntry
+{
+public:
+    /// Construct a SpeciesEntry instance with a species that is already decoded.
+    SpeciesEntry(const ElementMask& mask, const SpeciesType& species)
+    : mask(mask), species(species)
+    {
+        std::call_once(once, []() {});
+    }
+
+    /// Construct a SpeciesEntry instance with a function that decodes the species on first request.
+    SpeciesEntry(const ElementMask& mask, const std::function<SpeciesType()>& decode)
+    : mask(mask), decode(decode)
+    {}
+
+    /// Return the species, decoding it once in a thread-safe way if needed.
+    auto get() const -> const SpeciesType&
+    {
+        std::call_once(once, [&]() { species = decode(); decode = nullptr; });
+        return species;
+    }
+
+    /// The elements in the species (except charge), which are known without decoding the species
+    const ElementMask mask;
+
+private:
+    mutable std::once_flag once;
+    mutable std::function<SpeciesType()> decode;
+    mutable SpeciesType species;
+};
+
+/// Auxiliary types for a map of species entries indexed by name
+template<typename SpeciesType>
+using SpeciesEntryMap = std::map<std::string, std::shared_ptr<SpeciesEntry<SpeciesType>>>;
+
 /// Auxiliary types for a map of aqueous, fluid, and mineral species
 using ElementMap        = std::map<std::string, Element>;
-using AqueousSpeciesMap = std::map<std::string, AqueousSpecies>;
-using GaseousSpeciesMap = std::map<std::string, GaseousSpecies>;
-using LiquidSpeciesMap  = std::map<std::string, LiquidSpecies>;
-using MineralSpeciesMap = std::map<std::string, MineralSpecies>;
+using AqueousSpeciesMap = SpeciesEntryMap<AqueousSpecies>;
+using GaseousSpeciesMap = SpeciesEntryMap<GaseousSpecies>;
+using LiquidSpeciesMap  = SpeciesEntryMap<LiquidSpecies>;
+using MineralSpeciesMap = SpeciesEntryMap<MineralSpecies>;
 
 auto errorNonExistentSpecies(std::string type, std::string name) -> void
 {
@@ -67,6 +140,25 @@ auto errorNonExistentSpecies(std::string type, std::string name) -> void
     RaiseError(exception);
 }
 
+/// Convert a string into a floating point number in the classic locale, regardless of the global locale.
+auto todouble(const char* str) -> double
+{
+    std::istringstream stream(str);
+    stream.imbue(std::locale::classic());
+    double value = 0.0;
+    stream >> value;
+    return value;
+}
+
+/// Convert a space-separated string into a list of floating point numbers in the classic locale.
+auto todoubles(const std::string& str) -> std::vector<double>
+{
+    std::vector<double> values;
+    for(const std::string& word : split(str, " "))
+        values.push_back(todouble(word.c_str()));
+    return values;
+}
+
 auto parseDissociation(std::string dissociation) -> std::map<std::string, double>
 {
     std::map<std::string, double> equation;
@@ -74,7 +166,7 @@ auto parseDissociation(std::string dissociation) -> std::map<std::string, double
     for(const auto& word : words)
     {
         auto pair = split(word, ":");
-        equation.emplace(pair[1], tofloat(pair[0]));
+        equation.emplace(pair[1], todouble(pair[0].c_str()));
     }
     return equation;
 }
@@ -82,19 +174,19 @@ auto parseDissociation(std::string dissociation) -> std::map<std::string, double
 auto parseReactionInterpolatedThermoProperties(const xml_node& node) -> ReactionThermoInterpolatedProperties
 {
     // Get the data values of the children nodes
-    std::vector<double> temperatures     = tofloats(node.child("Temperatures").text().get());
-    std::vector<double> pressures        = tofloats(node.child("Pressures").text().get());
-    std::vector<double> pk               = tofloats(node.child("pk").text().get());
-    std::vector<double> lnk              = tofloats(node.child("lnk").text().get());
-    std::vector<double> logk             = tofloats(node.child("logk").text().get());
-    std::vector<double> gibbs_energy     = tofloats(node.child("G").text().get());
-    std::vector<double> helmholtz_energy = tofloats(node.child("A").text().get());
-    std::vector<double> internal_energy  = tofloats(node.child("U").text().get());
-    std::vector<double> enthalpy         = tofloats(node.child("H").text().get());
-    std::vector<double> entropy          = tofloats(node.child("S").text().get());
-    std::vector<double> volume           = tofloats(node.child("V").text().get());
-    std::vector<double> heat_capacity_cp = tofloats(node.child("Cp").text().get());
-    std::vector<double> heat_capacity_cv = tofloats(node.child("Cv").text().get());
+    std::vector<double> temperatures     = todoubles(node.child("Temperatures").text().get());
+    std::vector<double> pressures        = todoubles(node.child("Pressures").text().get());
+    std::vector<double> pk               = todoubles(node.child("pk").text().get());
+    std::vector<double> lnk              = todoubles(node.child("lnk").text().get());
+    std::vector<double> logk             = todoubles(node.child("logk").text().get());
+    std::vector<double> gibbs_energy     = todoubles(node.child("G").text().get());
+    std::vector<double> helmholtz_energy = todoubles(node.child("A").text().get());
+    std::vector<double> internal_energy  = todoubles(node.child("U").text().get());
+    std::vector<double> enthalpy         = todoubles(node.child("H").text().get());
+    std::vector<double> entropy          = todoubles(node.child("S").text().get());
+    std::vector<double> volume           = todoubles(node.child("V").text().get());
+    std::vector<double> heat_capacity_cp = todoubles(node.child("Cp").text().get());
+    std::vector<double> heat_capacity_cv = todoubles(node.child("Cv").text().get());
 
     // Convert `pk` to `lnk`, where `pk = -log(k) = -ln(k)/ln(10)`
     const double ln_10 = std::log(10.0);
@@ -133,8 +225,10 @@ auto parseReactionInterpolatedThermoProperties(const xml_node& node) -> Reaction
     if(punits.empty()) punits = "bar";
 
     // Convert temperatures and pressures to standard units (kelvin and pascal respectively)
-    for(auto& x : temperatures) x = units::convert(x, tunits, "kelvin");
-    for(auto& x : pressures)    x = units::convert(x, punits, "pascal");
+    const auto tconverter = units::converter(tunits, "kelvin");
+    const auto pconverter = units::converter(punits, "pascal");
+    for(auto& x : temperatures) x = tconverter(x);
+    for(auto& x : pressures)    x = pconverter(x);
 
     // Define a lambda function to generate a bilinear interpolator from a vector
     auto bilinear_interpolator = [&](const std::vector<double>& data) -> BilinearInterpolator
@@ -170,16 +264,16 @@ auto parseReactionInterpolatedThermoProperties(const xml_node& node) -> Reaction
 auto parseSpeciesInterpolatedThermoProperties(const xml_node& node) -> SpeciesThermoInterpolatedProperties
 {
     // Get the data values of the children nodes
-    std::vector<double> temperatures     = tofloats(node.child("Temperatures").text().get());
-    std::vector<double> pressures        = tofloats(node.child("Pressures").text().get());
-    std::vector<double> gibbs_energy     = tofloats(node.child("G").text().get());
-    std::vector<double> helmholtz_energy = tofloats(node.child("A").text().get());
-    std::vector<double> internal_energy  = tofloats(node.child("U").text().get());
-    std::vector<double> enthalpy         = tofloats(node.child("H").text().get());
-    std::vector<double> entropy          = tofloats(node.child("S").text().get());
-    std::vector<double> volume           = tofloats(node.child("V").text().get());
-    std::vector<double> heat_capacity_cp = tofloats(node.child("Cp").text().get());
-    std::vector<double> heat_capacity_cv = tofloats(node.child("Cv").text().get());
+    std::vector<double> temperatures     = todoubles(node.child("Temperatures").text().get());
+    std::vector<double> pressures        = todoubles(node.child("Pressures").text().get());
+    std::vector<double> gibbs_energy     = todoubles(node.child("G").text().get());
+    std::vector<double> helmholtz_energy = todoubles(node.child("A").text().get());
+    std::vector<double> internal_energy  = todoubles(node.child("U").text().get());
+    std::vector<double> enthalpy         = todoubles(node.child("H").text().get());
+    std::vector<double> entropy          = todoubles(node.child("S").text().get());
+    std::vector<double> volume           = todoubles(node.child("V").text().get());
+    std::vector<double> heat_capacity_cp = todoubles(node.child("Cp").text().get());
+    std::vector<double> heat_capacity_cv = todoubles(node.child("Cv").text().get());
 
     // Get the temperature and pressure units
     std::string tunits = node.child("Temperatures").attribute("units").as_string();
@@ -198,8 +292,10 @@ auto parseSpeciesInterpolatedThermoProperties(const xml_node& node) -> SpeciesTh
     if(punits.empty()) punits = "bar";
 
     // Convert temperatures and pressures to standard units
-    for(auto& x : temperatures) x = units::convert(x, tunits, "kelvin");
-    for(auto& x : pressures)    x = units::convert(x, punits, "pascal");
+    const auto tconverter = units::converter(tunits, "kelvin");
+    const auto pconverter = units::converter(punits, "pascal");
+    for(auto& x : temperatures) x = tconverter(x);
+    for(auto& x : pressures)    x = pconverter(x);
 
     // Define a lambda function to generate a bilinear interpolator from a vector
     auto bilinear_interpolator = [&](const std::vector<double>& data) -> BilinearInterpolator
@@ -233,7 +329,7 @@ auto as_double(const xml_node& node, const char* childname, double if_empty=std:
 {
     if(node.child(childname).text().empty())
         return if_empty;
-    return node.child(childname).text().as_double();
+    return todouble(node.child(childname).text().get());
 }
 
 auto parseAqueousSpeciesThermoParamsHKF(const xml_node& node) -> std::optional<AqueousSpeciesThermoParamsHKF>
@@ -357,30 +453,430 @@ auto parseMineralSpeciesThermoData(const xml_node& node) -> MineralSpeciesThermo
     return thermo;
 }
 
-template<typename SpeciesType, typename SpeciesFunction>
-auto collectSpecies(const std::map<std::string, SpeciesType>& map, const SpeciesFunction& fn) -> std::vector<SpeciesType>
+template<typename SpeciesType>
+auto speciesWithElements(const ElementMask& elements, const SpeciesEntryMap<SpeciesType>& map) -> std::vector<SpeciesType>
 {
-    std::set<SpeciesType> species;
-    for(const auto& entry : map)
-        if(fn(entry.second))
-            species.insert(entry.second);
-    return std::vector<SpeciesType>(species.begin(), species.end());
+    // Collect the species whose elements are all in the given elements, which are ordered by name as in the map
+    std::vector<SpeciesType> species;
+    for(const auto& pair : map)
+        if(subset(pair.second->mask, elements))
+            species.push_back(pair.second->get());
+    return species;
 }
 
-template<typename SpeciesType>
-auto speciesWithElements(const std::vector<std::string>& elements, const std::map<std::string, SpeciesType>& map) -> std::vector<SpeciesType>
+/// The signature at the beginning of a binary database file
+const char binary_signature[8] = {'R', 'K', 'T', 'D', 'B', 'B', 'I', 'N'};
+
+/// The version of the binary database format, which must be increased whenever the format changes
+const std::uint32_t binary_version = 2;
+
+/// A read-only view of the contents of a file, which is memory mapped where supported.
+class MappedFile
 {
-    auto f = [&](const SpeciesType& species)
+public:
+    explicit MappedFile(const std::string& filename)
     {
-        // Check if the given species has all chemical elements in the list of elements (ignore charge Z)
-        for(auto pair : species.elements())
-            if(pair.first.name() != "Z" && !contained(pair.first.name(), elements))
-                return false;
-        return true;
-    };
+#if _WIN32
+        std::ifstream file(filename, std::ios::binary);
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        begin = buffer.data();
+        length = buffer.size();
+#else
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if(fd < 0) return;
+        struct stat info;
+        if(::fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+            void* addr = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(addr != MAP_FAILED)
+            {
+                begin = static_cast<const char*>(addr);
+                length = info.st_size;
+            }
+        }
+        ::close(fd);
+#endif
+    }
 
-    return collectSpecies(map, f);
-}
+    MappedFile(const MappedFile&) = delete;
+
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+    ~MappedFile()
+    {
+#if !_WIN32
+        if(begin) ::munmap(const_cast<char*>(begin), length);
+#endif
+    }
+
+    auto data() const -> const char* { return begin; }
+
+    auto size() const -> std::size_t { return length; }
+
+    /// Return true if the file starts with the signature of a binary database.
+    auto binary() const -> bool
+    {
+        return length >= sizeof(binary_signature) &&
+            std::memcmp(begin, binary_signature, sizeof(binary_signature)) == 0;
+    }
+
+private:
+    const char* begin = nullptr;
+    std::size_t length = 0;
+#if _WIN32
+    std::vector<char> buffer;
+#endif
+};
+
+/// Writes values into a binary database buffer.
+class BinaryWriter
+{
+public:
+    template<typename T>
+    auto write(const T& value) -> void
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written directly.");
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    auto write(const std::string& str) -> void
+    {
+        write<std::uint32_t>(str.size());
+        buffer.insert(buffer.end(), str.begin(), str.end());
+    }
+
+    auto write(const std::vector<double>& values) -> void
+    {
+        write<std::uint32_t>(values.size());
+        const char* bytes = reinterpret_cast<const char*>(values.data());
+        buffer.insert(buffer.end(), bytes, bytes + values.size() * sizeof(double));
+    }
+
+    auto write(const std::map<std::string, double>& pairs) -> void
+    {
+        write<std::uint32_t>(pairs.size());
+        for(const auto& pair : pairs)
+        {
+            write(pair.first);
+            write(pair.second);
+        }
+    }
+
+    auto write(const BilinearInterpolator& interpolator) -> void
+    {
+        write(interpolator.xCoordinates());
+        write(interpolator.yCoordinates());
+        write(interpolator.data());
+    }
+
+    auto write(const SpeciesThermoInterpolatedProperties& properties) -> void
+    {
+        write(properties.gibbs_energy);
+        write(properties.helmholtz_energy);
+        write(properties.internal_energy);
+        write(properties.enthalpy);
+        write(properties.entropy);
+        write(properties.volume);
+        write(properties.heat_capacity_cp);
+        write(properties.heat_capacity_cv);
+    }
+
+    auto write(const SpeciesThermoData& thermo) -> void
+    {
+        write<std::uint8_t>(thermo.properties.has_value());
+        if(thermo.properties)
+            write(thermo.properties.value());
+
+        write<std::uint8_t>(thermo.reaction.has_value());
+        if(thermo.reaction)
+        {
+            write(static_cast<const SpeciesThermoInterpolatedProperties&>(thermo.reaction.value()));
+            write(std::string(thermo.reaction->equation));
+            write(thermo.reaction->lnk);
+        }
+
+        write<std::uint8_t>(thermo.phreeqc.has_value());
+        if(thermo.phreeqc)
+        {
+            write(std::string(thermo.phreeqc->reaction.equation));
+            write(thermo.phreeqc->reaction.log_k);
+            write(thermo.phreeqc->reaction.delta_h);
+            write(thermo.phreeqc->reaction.analytic);
+        }
+    }
+
+    auto write(const MineralSpeciesThermoParamsHKF& hkf) -> void
+    {
+        for(double value : {hkf.Gf, hkf.Hf, hkf.Sr, hkf.Vr})
+            write(value);
+        write<std::int32_t>(hkf.nptrans);
+        for(const auto* values : {&hkf.a, &hkf.b, &hkf.c, &hkf.Ttr, &hkf.Htr, &hkf.Vtr, &hkf.dPdTtr})
+            write(*values);
+        write(hkf.Tmax);
+    }
+
+    auto write(const Species& species) -> void
+    {
+        write(species.name());
+        write(species.formula());
+        write<std::uint32_t>(species.elements().size());
+        for(const auto& pair : species.elements())
+        {
+            write(pair.first.name());
+            write(pair.second);
+        }
+    }
+
+    auto write(const AqueousSpecies& species) -> void
+    {
+        write(static_cast<const Species&>(species));
+        write(species.charge());
+        write(species.dissociation());
+        write(static_cast<const SpeciesThermoData&>(species.thermoData()));
+        write<std::uint8_t>(species.thermoData().hkf.has_value());
+        if(species.thermoData().hkf)
+            write(species.thermoData().hkf.value());
+    }
+
+    auto write(const FluidSpecies& species) -> void
+    {
+        write(static_cast<const Species&>(species));
+        write(species.criticalTemperature());
+        write(species.criticalPressure());
+        write(species.acentricFactor());
+        write(static_cast<const SpeciesThermoData&>(species.thermoData()));
+        write<std::uint8_t>(species.thermoData().hkf.has_value());
+        if(species.thermoData().hkf)
+            write(species.thermoData().hkf.value());
+    }
+
+    auto write(const MineralSpecies& species) -> void
+    {
+        write(static_cast<const Species&>(species));
+        write(static_cast<const SpeciesThermoData&>(species.thermoData()));
+        write<std::uint8_t>(species.thermoData().hkf.has_value());
+        if(species.thermoData().hkf)
+            write(species.thermoData().hkf.value());
+    }
+
+    template<typename SpeciesType>
+    auto write(const SpeciesEntryMap<SpeciesType>& map) -> void
+    {
+        write<std::uint32_t>(map.size());
+        for(const auto& pair : map)
+        {
+            // Write the species as a record prefixed with its size, so that it can be skipped when indexing
+            const auto start = buffer.size();
+            write<std::uint32_t>(0);
+            write(pair.second->get());
+            const std::uint32_t size = buffer.size() - start - sizeof(std::uint32_t);
+            std::memcpy(buffer.data() + start, &size, sizeof(size));
+        }
+    }
+
+    /// The bytes written so far
+    std::vector<char> buffer;
+};
+
+/// Reads values from a binary database buffer without any text parsing or unit conversion.
+class BinaryReader
+{
+public:
+    BinaryReader(const char* begin, const char* end, const ElementMap& elements)
+    : pos(begin), end(end), elements(elements)
+    {}
+
+    template<typename T>
+    auto read() -> T
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read directly.");
+        T value;
+        std::memcpy(&value, advance(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    auto readString() -> std::string
+    {
+        const auto size = read<std::uint32_t>();
+        return std::string(advance(size), size);
+    }
+
+    auto readVector() -> std::vector<double>
+    {
+        const auto size = read<std::uint32_t>();
+        std::vector<double> values(size);
+        std::memcpy(values.data(), advance(size * sizeof(double)), size * sizeof(double));
+        return values;
+    }
+
+    auto readMap() -> std::map<std::string, double>
+    {
+        std::map<std::string, double> pairs;
+        const auto size = read<std::uint32_t>();
+        for(unsigned i = 0; i < size; ++i)
+        {
+            std::string key = readString();
+            pairs[key] = read<double>();
+        }
+        return pairs;
+    }
+
+    auto readInterpolator() -> BilinearInterpolator
+    {
+        std::vector<double> x = readVector();
+        std::vector<double> y = readVector();
+        std::vector<double> data = readVector();
+        if(data.empty()) return BilinearInterpolator();
+        return BilinearInterpolator(x, y, data);
+    }
+
+    auto readInterpolatedProperties(SpeciesThermoInterpolatedProperties& properties) -> void
+    {
+        properties.gibbs_energy     = readInterpolator();
+        properties.helmholtz_energy = readInterpolator();
+        properties.internal_energy  = readInterpolator();
+        properties.enthalpy         = readInterpolator();
+        properties.entropy          = readInterpolator();
+        properties.volume           = readInterpolator();
+        properties.heat_capacity_cp = readInterpolator();
+        properties.heat_capacity_cv = readInterpolator();
+    }
+
+    auto readThermoData(SpeciesThermoData& thermo) -> void
+    {
+        if(read<std::uint8_t>())
+        {
+            thermo.properties = SpeciesThermoInterpolatedProperties();
+            readInterpolatedProperties(thermo.properties.value());
+        }
+
+        if(read<std::uint8_t>())
+        {
+            thermo.reaction = ReactionThermoInterpolatedProperties();
+            readInterpolatedProperties(thermo.reaction.value());
+            thermo.reaction->equation = readString();
+            thermo.reaction->lnk = readInterpolator();
+        }
+
+        if(read<std::uint8_t>())
+        {
+            thermo.phreeqc = SpeciesThermoParamsPhreeqc();
+            thermo.phreeqc->reaction.equation = readString();
+            thermo.phreeqc->reaction.log_k = read<double>();
+            thermo.phreeqc->reaction.delta_h = read<double>();
+            thermo.phreeqc->reaction.analytic = readVector();
+        }
+    }
+
+    auto readMineralThermoParamsHKF() -> MineralSpeciesThermoParamsHKF
+    {
+        MineralSpeciesThermoParamsHKF hkf;
+        for(double* value : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.Vr})
+            *value = read<double>();
+        hkf.nptrans = read<std::int32_t>();
+        for(auto* values : {&hkf.a, &hkf.b, &hkf.c, &hkf.Ttr, &hkf.Htr, &hkf.Vtr, &hkf.dPdTtr})
+            *values = readVector();
+        hkf.Tmax = read<double>();
+        return hkf;
+    }
+
+    /// Return the beginning and end of the next species record, without decoding it.
+    auto readRecord() -> std::pair<const char*, const char*>
+    {
+        const auto size = read<std::uint32_t>();
+        const char* begin = advance(size);
+        return {begin, begin + size};
+    }
+
+    /// Read the name of a species and the names of its elements at the beginning of a species record.
+    auto readSpeciesIndex(std::string& name, std::vector<std::string>& names) -> void
+    {
+        name = readString();
+        readString();
+        const auto size = read<std::uint32_t>();
+        for(unsigned i = 0; i < size; ++i)
+        {
+            names.push_back(readString());
+            read<double>();
+        }
+    }
+
+    auto readSpecies(Species& species) -> void
+    {
+        species.setName(readString());
+        species.setFormula(readString());
+        std::map<Element, double> coefficients;
+        const auto size = read<std::uint32_t>();
+        for(unsigned i = 0; i < size; ++i)
+        {
+            const std::string name = readString();
+            Assert(elements.count(name), "Cannot read the species `" + species.name() + "` from the binary database.",
+                "The element `" + name + "` is not in the database.");
+            coefficients.emplace(elements.at(name), read<double>());
+        }
+        species.setElements(coefficients);
+    }
+
+    auto readAqueousSpecies() -> AqueousSpecies
+    {
+        AqueousSpecies species;
+        readSpecies(species);
+        species.setCharge(read<double>());
+        species.setDissociation(readMap());
+        AqueousSpeciesThermoData thermo;
+        readThermoData(thermo);
+        if(read<std::uint8_t>())
+            thermo.hkf = read<AqueousSpeciesThermoParamsHKF>();
+        species.setThermoData(thermo);
+        return species;
+    }
+
+    auto readFluidSpecies() -> FluidSpecies
+    {
+        FluidSpecies species;
+        readSpecies(species);
+        // Unknown critical properties are stored as zero, which cannot be set in a FluidSpecies instance
+        const double Tc = read<double>();
+        const double Pc = read<double>();
+        if(Tc > 0.0) species.setCriticalTemperature(Tc);
+        if(Pc > 0.0) species.setCriticalPressure(Pc);
+        species.setAcentricFactor(read<double>());
+        FluidSpeciesThermoData thermo;
+        readThermoData(thermo);
+        if(read<std::uint8_t>())
+            thermo.hkf = read<FluidSpeciesThermoParamsHKF>();
+        species.setThermoData(thermo);
+        return species;
+    }
+
+    auto readMineralSpecies() -> MineralSpecies
+    {
+        MineralSpecies species;
+        readSpecies(species);
+        MineralSpeciesThermoData thermo;
+        readThermoData(thermo);
+        if(read<std::uint8_t>())
+            thermo.hkf = readMineralThermoParamsHKF();
+        species.setThermoData(thermo);
+        return species;
+    }
+
+private:
+    /// Return the current position in the buffer and advance it by a number of bytes
+    auto advance(std::size_t bytes) -> const char*
+    {
+        Assert(bytes <= std::size_t(end - pos), "Cannot read the binary database.",
+            "The binary database file is truncated or corrupted.");
+        const char* current = pos;
+        pos += bytes;
+        return current;
+    }
+
+    const char* pos;
+    const char* end;
+    const ElementMap& elements;
+};
 
 } // namespace
 
@@ -423,14 +919,28 @@ struct Database::Impl
     /// ThermoFun database
     ThermoFun::Database fundb;
 
+    /// The indices of the element names interned for the element masks of the species
+    std::map<std::string, std::size_t> element_indices;
+
+    /// The xml document of the database, whose species nodes are parsed on first request
+    xml_document doc;
+
+    /// The mutex that serializes the access to the xml document when parsing species nodes
+    std::mutex doc_mutex;
+
     Impl() = default;
 
     Impl(std::string filename)
     {
-        const auto guard = ChangeLocale("C");
+        // Load the database directly if the file is a binary database
+        auto file = std::make_shared<MappedFile>(filename);
+        if(file->binary())
+        {
+            readBinary(file, filename);
+            return;
+        }
 
-        // Create the XML document
-        xml_document doc;
+        const auto guard = ChangeLocale("C");
 
         // Load the xml database file
         auto result = doc.load_file(filename.c_str());
@@ -455,7 +965,7 @@ struct Database::Impl
                 "built-in database files in Reaktoro. The built-in databases are: " + names + ".");
         }
 
-        // Parse the xml document
+        // Index the species in the xml document
         parse(doc, filename);
     }
 
@@ -473,17 +983,17 @@ struct Database::Impl
             {
                 AqueousSpecies species = getAqueousSpecies(substance);
                 if(valid(species))
-                    aqueous_species_map[species.name()] = species;
+                    aqueous_species_map[species.name()] = entry(species);
             } else if(type == ThermoFun::AggregateState::type::GAS)
             {
                 GaseousSpecies species = getGaseousSpecies(substance);
                 if(valid(species))
-                    gaseous_species_map[species.name()] = species;
+                    gaseous_species_map[species.name()] = entry(species);
             } else if(type == ThermoFun::AggregateState::type::CRYSTAL)
             {
                 MineralSpecies species = getMineralSpecies(substance);
                 if(valid(species))
-                    mineral_species_map[species.name()] = species;
+                    mineral_species_map[species.name()] = entry(species);
 
             } else RuntimeError("Could not parse the species `" + name + " in the database.",
                 "The type of the species is unknown.");
@@ -570,13 +1080,48 @@ struct Database::Impl
     }
 // ThermoFun Integration END
 
-    template<typename Key, typename Value>
-    auto collectValues(const std::map<Key, Value>& map) -> std::vector<Value>
+    /// Return the mask of a set of elements, interning the names of new elements.
+    auto elementMask(const std::vector<std::string>& names) -> ElementMask
     {
-        std::vector<Value> species;
+        ElementMask mask;
+        for(const auto& name : names)
+        {
+            // Ignore the charge element, which is not used in queries of species with elements
+            if(name == "Z") continue;
+            const auto index = element_indices.emplace(name, element_indices.size()).first->second;
+            if(mask.size() <= index/64) mask.resize(index/64 + 1);
+            mask[index/64] |= std::uint64_t(1) << (index % 64);
+        }
+        return mask;
+    }
+
+    /// Return the mask of a set of elements, ignoring the elements not in any species.
+    auto elementMask(const std::vector<std::string>& names) const -> ElementMask
+    {
+        ElementMask mask(element_indices.size()/64 + 1);
+        for(const auto& name : names)
+        {
+            const auto iter = element_indices.find(name);
+            if(iter != element_indices.end())
+                mask[iter->second/64] |= std::uint64_t(1) << (iter->second % 64);
+        }
+        return mask;
+    }
+
+    /// Return a shared pointer to a species entry with an already decoded species.
+    template<typename SpeciesType>
+    auto entry(const SpeciesType& species) -> std::shared_ptr<SpeciesEntry<SpeciesType>>
+    {
+        return std::make_shared<SpeciesEntry<SpeciesType>>(elementMask(elementNames(species)), species);
+    }
+
+    template<typename SpeciesType>
+    auto collectValues(const SpeciesEntryMap<SpeciesType>& map) -> std::vector<SpeciesType>
+    {
+        std::vector<SpeciesType> species;
         species.reserve(map.size());
         for(const auto& pair : map)
-            species.push_back(pair.second);
+            species.push_back(pair.second->get());
         return species;
     }
 
@@ -587,22 +1132,22 @@ struct Database::Impl
 
     auto addAqueousSpecies(const AqueousSpecies& species) -> void
     {
-        aqueous_species_map.insert({species.name(), species});
+        aqueous_species_map.insert({species.name(), entry(species)});
     }
 
     auto addGaseousSpecies(const GaseousSpecies& species) -> void
     {
-        gaseous_species_map.insert({ species.name(), species });
+        gaseous_species_map.insert({species.name(), entry(species)});
     }
 
     auto addLiquidSpecies(const LiquidSpecies& species) -> void
     {
-        liquid_species_map.insert({ species.name(), species });
+        liquid_species_map.insert({species.name(), entry(species)});
     }
 
     auto addMineralSpecies(const MineralSpecies& species) -> void
     {
-        mineral_species_map.insert({species.name(), species});
+        mineral_species_map.insert({species.name(), entry(species)});
     }
 
     auto elements() const-> std::vector<Element>
@@ -629,7 +1174,7 @@ struct Database::Impl
         if(aqueous_species_map.count(name) == 0)
             errorNonExistentSpecies("aqueous", name);
 
-        return aqueous_species_map.find(name)->second;
+        return aqueous_species_map.find(name)->second->get();
     }
 
     auto gaseousSpecies() -> std::vector<GaseousSpecies>
@@ -642,7 +1187,7 @@ struct Database::Impl
         if(gaseous_species_map.count(name) == 0)
             errorNonExistentSpecies("gaseous", name);
 
-        return gaseous_species_map.find(name)->second;
+        return gaseous_species_map.find(name)->second->get();
     }
 
     auto liquidSpecies() -> std::vector<LiquidSpecies>
@@ -655,7 +1200,7 @@ struct Database::Impl
         if(liquid_species_map.count(name) == 0)
             errorNonExistentSpecies("liquid", name);
 
-        return liquid_species_map.find(name)->second;
+        return liquid_species_map.find(name)->second->get();
     }
 
     auto mineralSpecies() -> std::vector<MineralSpecies>
@@ -668,7 +1213,7 @@ struct Database::Impl
         if(mineral_species_map.count(name) == 0)
             errorNonExistentSpecies("mineral", name);
 
-        return mineral_species_map.find(name)->second;
+        return mineral_species_map.find(name)->second->get();
     }
 
     auto containsAqueousSpecies(std::string species) const -> bool
@@ -693,22 +1238,95 @@ struct Database::Impl
 
     auto aqueousSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<AqueousSpecies>
     {
-        return speciesWithElements(elements, aqueous_species_map);
+        return speciesWithElements(elementMask(elements), aqueous_species_map);
     }
 
     auto gaseousSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<GaseousSpecies>
     {
-        return speciesWithElements(elements, gaseous_species_map);
+        return speciesWithElements(elementMask(elements), gaseous_species_map);
     }
 
     auto liquidSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<LiquidSpecies>
     {
-        return speciesWithElements(elements, liquid_species_map);
+        return speciesWithElements(elementMask(elements), liquid_species_map);
     }
 
     auto mineralSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<MineralSpecies>
     {
-        return speciesWithElements(elements, mineral_species_map);
+        return speciesWithElements(elementMask(elements), mineral_species_map);
+    }
+
+    auto save(std::string filename) const -> void
+    {
+        BinaryWriter writer;
+        writer.buffer.insert(writer.buffer.end(), std::begin(binary_signature), std::end(binary_signature));
+        writer.write(binary_version);
+
+        writer.write<std::uint32_t>(element_map.size());
+        for(const auto& pair : element_map)
+        {
+            writer.write(pair.second.name());
+            writer.write(pair.second.molarMass());
+        }
+
+        writer.write(aqueous_species_map);
+        writer.write(gaseous_species_map);
+        writer.write(liquid_species_map);
+        writer.write(mineral_species_map);
+
+        std::ofstream file(filename, std::ios::binary);
+        Assert(file.is_open(), "Could not save the database in the file `" + filename + "`.",
+            "The file could not be opened for writing.");
+        file.write(writer.buffer.data(), writer.buffer.size());
+    }
+
+    auto readBinary(const std::shared_ptr<MappedFile>& file, std::string filename) -> void
+    {
+        BinaryReader reader(file->data() + sizeof(binary_signature), file->data() + file->size(), element_map);
+
+        const auto version = reader.read<std::uint32_t>();
+        Assert(version == binary_version, "Could not load the binary database `" + filename + "`.",
+            "The file has format version " + std::to_string(version) + ", but version " +
+            std::to_string(binary_version) + " is expected. Compile it again with Database::save.");
+
+        const auto num_elements = reader.read<std::uint32_t>();
+        for(unsigned i = 0; i < num_elements; ++i)
+        {
+            Element element;
+            element.setName(reader.readString());
+            element.setMolarMass(reader.read<double>());
+            element_map[element.name()] = element;
+        }
+
+        readBinaryIndex(reader, file, aqueous_species_map, &BinaryReader::readAqueousSpecies);
+        readBinaryIndex(reader, file, gaseous_species_map, &BinaryReader::readFluidSpecies);
+        readBinaryIndex(reader, file, liquid_species_map, &BinaryReader::readFluidSpecies);
+        readBinaryIndex(reader, file, mineral_species_map, &BinaryReader::readMineralSpecies);
+    }
+
+    /// Index the species records of a binary database, whose data is decoded on first request.
+    template<typename SpeciesType>
+    auto readBinaryIndex(BinaryReader& reader, const std::shared_ptr<MappedFile>& file,
+        SpeciesEntryMap<SpeciesType>& map, SpeciesType(BinaryReader::*decode)()) -> void
+    {
+        const auto num_species = reader.read<std::uint32_t>();
+        for(unsigned i = 0; i < num_species; ++i)
+        {
+            const auto record = reader.readRecord();
+
+            std::string name;
+            std::vector<std::string> elements;
+            BinaryReader(record.first, record.second, element_map).readSpeciesIndex(name, elements);
+
+            // The decoding function keeps the file mapped until the species is first requested
+            auto fn = [this, file, record, decode]()
+            {
+                BinaryReader species_reader(record.first, record.second, element_map);
+                return (species_reader.*decode)();
+            };
+
+            map.emplace_hint(map.end(), name, std::make_shared<SpeciesEntry<SpeciesType>>(elementMask(elements), fn));
+        }
     }
 
     auto parse(const xml_document& doc, std::string databasename) -> void
@@ -727,48 +1345,64 @@ struct Database::Impl
         element_map["Z"] = Element();
         element_map["Z"].setName("Z");
 
-        // Read all species in the database
+        // Index all species in the database, whose thermodynamic data are parsed on first request
         for(xml_node node : database.children("Species"))
         {
             std::string type = node.child("Type").text().get();
             std::string name = node.child("Name").text().get();
 
+            if(type != "Aqueous" && type != "Gaseous" && type != "Mineral")
+                RuntimeError("Could not parse the species `" +
+                    name + "` with type `" + type + "` in the database `" +
+                    databasename + "`.", "The type of the species is unknown.");
+
+            // Parse only the name, formula and elements of the species for its validation and indexing
+            Species species = parseSpecies(node);
+            if(!valid(species, node.child("Thermo").child("HKF")))
+                continue;
+
+            const auto mask = elementMask(elementNames(species));
+
             if(type == "Aqueous")
             {
-                AqueousSpecies species = parseAqueousSpecies(node);
-                if(valid(species))
-                    aqueous_species_map[species.name()] = species;
+                auto fn = [=]() { return parseSpeciesNode(node, &Impl::parseAqueousSpecies); };
+                aqueous_species_map[name] = std::make_shared<SpeciesEntry<AqueousSpecies>>(mask, fn);
             }
             else if(type == "Gaseous")
             {
-                GaseousSpecies gaseous_species = parseFluidSpecies(node);
-                gaseous_species.setName(name);
-                LiquidSpecies liquid_species = parseFluidSpecies(node);
                 const auto gas_species_suffix_size = 3;
-                liquid_species.setName(name.substr(0, name.size() - gas_species_suffix_size) + "(liq)");
-                if(valid(gaseous_species))
+                const auto liquid_name = name.substr(0, name.size() - gas_species_suffix_size) + "(liq)";
+                auto gaseous_fn = [=]() { return parseSpeciesNode(node, &Impl::parseFluidSpecies); };
+                auto liquid_fn = [=]()
                 {
-                    gaseous_species_map[gaseous_species.name()] = gaseous_species;
-                    liquid_species_map[liquid_species.name()] = liquid_species;
-                }
+                    LiquidSpecies liquid_species = parseSpeciesNode(node, &Impl::parseFluidSpecies);
+                    liquid_species.setName(liquid_name);
+                    return liquid_species;
+                };
+                gaseous_species_map[name] = std::make_shared<SpeciesEntry<GaseousSpecies>>(mask, gaseous_fn);
+                liquid_species_map[liquid_name] = std::make_shared<SpeciesEntry<LiquidSpecies>>(mask, liquid_fn);
             }
-            else if(type == "Mineral")
+            else
             {
-                MineralSpecies species = parseMineralSpecies(node);
-                if(valid(species))
-                    mineral_species_map[species.name()] = species;
+                auto fn = [=]() { return parseSpeciesNode(node, &Impl::parseMineralSpecies); };
+                mineral_species_map[name] = std::make_shared<SpeciesEntry<MineralSpecies>>(mask, fn);
             }
-            else RuntimeError("Could not parse the species `" +
-                name + "` with type `" + type + "` in the database `" +
-                databasename + "`.", "The type of the species is unknown.");
         }
     }
 
+    /// Parse a species node of the xml document, which can happen concurrently for different species.
+    template<typename SpeciesType>
+    auto parseSpeciesNode(const xml_node& node, SpeciesType(Impl::*parse)(const xml_node&)) -> SpeciesType
+    {
+        std::lock_guard<std::mutex> lock(doc_mutex);
+        return (this->*parse)(node);
+    }
+
     auto parseElement(const xml_node& node) -> Element
     {
         Element element;
         element.setName(node.child("Name").text().get());
-        element.setMolarMass(node.child("MolarMass").text().as_double() * 1e-3); // convert from g/mol to kg/mol
+        element.setMolarMass(todouble(node.child("MolarMass").text().get()) * 1e-3); // convert from g/mol to kg/mol
         return element;
     }
 
@@ -782,11 +1416,11 @@ struct Database::Impl
             Assert(element_map.count(words[i]),
                 "Cannot parse the elemental formula `" + formula + "`.",
                 "The element `" + words[i] + "` is not in the database.");
-            elements.emplace(element_map.at(words[i]), tofloat(words[i + 1]));
+            elements.emplace(element_map.at(words[i]), todouble(words[i + 1].c_str()));
         }
         if(!node.child("Charge").empty())
         {
-            double charge = node.child("Charge").text().as_double();
+            double charge = todouble(node.child("Charge").text().get());
             elements.emplace(element_map.at("Z"), charge);
         }
         return elements;
@@ -815,7 +1449,7 @@ struct Database::Impl
         AqueousSpecies species = parseSpecies(node);
 
         // Set the elemental charge of the species
-        species.setCharge(node.child("Charge").text().as_double());
+        species.setCharge(todouble(node.child("Charge").text().get()));
 
         // Parse the complex formula of the aqueous species (if any)
         species.setDissociation(parseDissociation(node.child("Dissociation").text().get()));
@@ -833,15 +1467,15 @@ struct Database::Impl
 
         // Set the critical temperature of the fluid (gaseous or liquid) species (in units of K)
         if(!node.child("CriticalTemperature").empty())
-            species.setCriticalTemperature(node.child("CriticalTemperature").text().as_double());
+            species.setCriticalTemperature(todouble(node.child("CriticalTemperature").text().get()));
 
         // Set the critical pressure of the fluid (gaseous or liquid) species (in units of Pa)
         if(!node.child("CriticalPressure").empty())
-            species.setCriticalPressure(node.child("CriticalPressure").text().as_double() * 1e5); // convert from bar to Pa
+            species.setCriticalPressure(todouble(node.child("CriticalPressure").text().get()) * 1e5); // convert from bar to Pa
 
         // Set the acentric factor of the fluid (gaseous or liquid) species
         if(!node.child("AcentricFactor").empty())
-            species.setAcentricFactor(node.child("AcentricFactor").text().as_double());
+            species.setAcentricFactor(todouble(node.child("AcentricFactor").text().get()));
 
         // Parse the thermodynamic data of the fluid (gaseous or liquid) species
         species.setThermoData(parseFluidSpeciesThermoData(node.child("Thermo")));
@@ -860,6 +1494,21 @@ struct Database::Impl
         return species;
     }
 
+    /// Return true if the name, formula and elements of a species are correct and complete
+    auto validSpecies(const Species& species) const -> bool
+    {
+        if(species.name().empty())
+            return false;
+        if(species.elements().empty())
+            return false;
+        if(species.molarMass() <= 0.0 || !std::isfinite(species.molarMass()))
+            return false;
+        if(species.formula().empty())
+            return false;
+
+        return true;
+    }
+
     /// Return true if a species instance has correct and complete data
     template<typename SpeciesType>
     auto valid(const SpeciesType& species) const -> bool
@@ -869,13 +1518,7 @@ struct Database::Impl
             return true;
 
         // Check if species data is available
-        if(species.name().empty())
-            return false;
-        if(species.elements().empty())
-            return false;
-        if(species.molarMass() <= 0.0 || !std::isfinite(species.molarMass()))
-            return false;
-        if(species.formula().empty())
+        if(!validSpecies(species))
             return false;
 
         // Check if HKF parameters exist, but they are incomplete
@@ -887,6 +1530,26 @@ struct Database::Impl
 
         return true;
     }
+
+    /// Return true if a species has correct and complete data, without parsing its thermodynamic data
+    auto valid(const Species& species, const xml_node& hkf) const -> bool
+    {
+        // Skip validation if even species with missing data should be considered
+        if(!global::options.database.exclude_species_with_missing_data)
+            return true;
+
+        // Check if species data is available
+        if(!validSpecies(species))
+            return false;
+
+        // Check if HKF parameters exist, but they are incomplete
+        if(!hkf.empty() && !std::isfinite(as_double(hkf, "Gf")))
+            return false;
+        if(!hkf.empty() && !std::isfinite(as_double(hkf, "Hf")))
+            return false;
+
+        return true;
+    }
 };
 
 Database::Database()
@@ -901,6 +1564,11 @@ Database::Database(const ThermoFun::Database& fundatabase)
 : pimpl(new Impl(fundatabase))
 {}
 
+auto Database::save(std::string filename) const -> void
+{
+    pimpl->save(filename);
+}
+
 auto Database::addElement(const Element& element) -> void
 {
     pimpl->addElement(element);
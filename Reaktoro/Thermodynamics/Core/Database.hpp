@@ -48,6 +48,10 @@ class MineralSpecies;
 /// one can, for example, retrieve thermodynamic information of an aqueous species that will be
 /// used to calculate its standard chemical potential.
 ///
+/// The species in the database are indexed by name and elements when the database is loaded,
+/// but their thermodynamic data are only decoded when they are first requested. The cost of
+/// using a large database then scales with the number of species actually used.
+///
 /// **Usage**
 ///
 /// In the example below, a Database instance is initialized and
@@ -85,12 +89,22 @@ public:
     /// database file is not found, then a default built-in database
     /// with the same name will be tried. If no default built-in database
     /// exists with a given name, an exception will be thrown.
+    /// If `filename` is a binary database file created with method @ref save,
+    /// then it is loaded directly instead.
     /// @param filename The name of the database file
     explicit Database(std::string filename);
 
     /// Construct a Database instance with a given ThermoFun database.
     explicit Database(const ThermoFun::Database& fundatabase);
 
+    /// Save the database in a compact binary file.
+    /// The binary file is a one-time compilation of the database, from any of its sources, that can
+    /// later be given to the Database constructor, which then memory maps it and reads its data
+    /// without any xml parsing or unit conversion. The binary file depends on the byte order of
+    /// the machine and on the version of the binary format, and must be compiled again if these change.
+    /// @param filename The name of the binary database file
+    auto save(std::string filename) const -> void;
+
     /// Add an Element instance in the database.
     auto addElement(const Element& element) -> void;
 
@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <algorithm>
+#include <limits>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
@@ -154,6 +155,67 @@ auto Psi(CubicEOS::Model type) -> double
     }
 }
 
+/// The matrix of a temperature-dependent mixing parameter and its partial derivatives with respect to temperature and pressure.
+struct MixingMatrix
+{
+    /// The values of the mixing parameter for each pair of species
+    Matrix val;
+
+    /// The partial temperature derivatives of the mixing parameter for each pair of species
+    Matrix ddT;
+
+    /// The partial pressure derivatives of the mixing parameter for each pair of species
+    Matrix ddP;
+
+    /// Resize the matrices of the mixing parameter.
+    auto resize(Index nspecies) -> void
+    {
+        val.resize(nspecies, nspecies);
+        ddT.resize(nspecies, nspecies);
+        ddP.resize(nspecies, nspecies);
+    }
+
+    /// Set the mixing parameter of the pair of species i and j.
+    auto set(Index i, Index j, const ThermoScalar& aij) -> void
+    {
+        val(i, j) = aij.val;
+        ddT(i, j) = aij.ddT;
+        ddP(i, j) = aij.ddP;
+    }
+};
+
+/// Calculate the mixing parameter of the phase using the quadratic mixing rule `amix = sum(x[i]*x[j]*aij)`.
+/// @param aij The matrix of the mixing parameter
+/// @param x The mole fractions of the species
+/// @param Ax The auxiliary vector `(aij + tr(aij))*x` (output)
+/// @param amix The mixing parameter of the phase (output)
+auto mixingRule(const MixingMatrix& aij, const ChemicalVector& x, Vector& Ax, ChemicalScalar& amix) -> void
+{
+    Ax.noalias() = aij.val * x.val;
+    Ax.noalias() += tr(aij.val) * x.val;
+    amix.val = 0.5 * x.val.dot(Ax);
+    amix.ddT = Ax.dot(x.ddT) + x.val.dot(aij.ddT * x.val);
+    amix.ddP = Ax.dot(x.ddP) + x.val.dot(aij.ddP * x.val);
+    amix.ddn.noalias() = tr(Ax) * x.ddn;
+}
+
+/// Calculate the partial molar mixing parameters of the species `abar[i] = 2*sum(x[j]*aij) - amix`.
+/// @param aij The matrix of the mixing parameter
+/// @param x The mole fractions of the species
+/// @param amix The mixing parameter of the phase
+/// @param abar The partial molar mixing parameters of the species (output)
+auto partialMixingRule(const MixingMatrix& aij, const ChemicalVector& x, const ChemicalScalar& amix, ChemicalVector& abar) -> void
+{
+    abar.val.noalias() = 2.0 * aij.val * x.val;
+    abar.val.array() -= amix.val;
+    abar.ddT.noalias() = 2.0 * (aij.val * x.ddT + aij.ddT * x.val);
+    abar.ddT.array() -= amix.ddT;
+    abar.ddP.noalias() = 2.0 * (aij.val * x.ddP + aij.ddP * x.val);
+    abar.ddP.array() -= amix.ddP;
+    abar.ddn.noalias() = 2.0 * aij.val * x.ddn;
+    abar.ddn.rowwise() -= amix.ddn;
+}
+
 } // namespace internal
 
 struct CubicEOS::Impl
@@ -185,6 +247,26 @@ struct CubicEOS::Impl
     /// The result with thermodynamic properties calculated from the cubic equation of state
     Result result;
 
+    /// The temperature at which the temperature-dependent parameters were last calculated.
+    /// A NaN value indicates that these parameters need to be calculated.
+    ThermoScalar Tcache = ThermoScalar(std::numeric_limits<double>::quiet_NaN());
+
+    /// The parameters `a` of the cubic equation of state for each species and their temperature derivatives.
+    ThermoVector a, aT, aTT;
+
+    /// The parameters `b` of the cubic equation of state for each species.
+    Vector b;
+
+    /// The mixing parameters `aij` and their first and second temperature derivatives.
+    internal::MixingMatrix aij, aijT, aijTT;
+
+    /// The auxiliary vector used in the evaluation of the mixing rules.
+    Vector Ax;
+
+    /// The auxiliary chemical scalars and vectors used in the evaluation of the equation of state.
+    ChemicalScalar amix, amixT, amixTT, bmix, Z, ai, aiT, qi, qiT, Bi, Ci, Zi, Ii;
+    ChemicalVector abar, abarT;
+
     /// Construct a CubicEOS::Impl instance.
     Impl(unsigned nspecies)
     : nspecies(nspecies)
@@ -203,26 +285,34 @@ struct CubicEOS::Impl
         result.residual_partial_molar_enthalpies = vec;
         result.residual_partial_molar_gibbs_energies = vec;
         result.ln_fugacity_coefficients = vec;
+
+        // Initialize the dimension of the auxiliary quantities
+        amix = amixT = amixTT = bmix = Z = ai = aiT = qi = qiT = Bi = Ci = Zi = Ii = sca;
+        abar = abarT = vec;
     }
 
-    auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
+    /// Reset the cached temperature-dependent parameters so that they are recalculated in the next evaluation.
+    auto resetCache() -> void
     {
-        // Check if the mole fractions are zero or non-initialized
-        if(x.val.size() == 0 || min(x.val) <= 0.0)
-            return Result(nspecies); // result with zero values
+        Tcache = ThermoScalar(std::numeric_limits<double>::quiet_NaN());
+    }
+
+    /// Update the parameters `a` and `b` of the species and the mixing parameters `aij`, if temperature has changed.
+    auto updateTemperatureDependentParams(const ThermoScalar& T) -> void
+    {
+        if(T.val == Tcache.val && T.ddT == Tcache.ddT && T.ddP == Tcache.ddP)
+            return;
 
         // Auxiliary variables
         const double R = universalGasConstant;
         const double Psi = internal::Psi(model);
         const double Omega = internal::Omega(model);
-        const double epsilon = internal::epsilon(model);
-        const double sigma = internal::sigma(model);
         const auto alpha = internal::alpha(model);
 
         // Calculate the parameters `a` of the cubic equation of state for each species
-        ThermoVector a(nspecies);
-        ThermoVector aT(nspecies);
-        ThermoVector aTT(nspecies);
+        a.resize(nspecies);
+        aT.resize(nspecies);
+        aTT.resize(nspecies);
         for(unsigned i = 0; i < nspecies; ++i)
         {
             const double Tc = critical_temperatures[i];
@@ -238,7 +328,7 @@ struct CubicEOS::Impl
         };
 
         // Calculate the parameters `b` of the cubic equation of state for each species
-        Vector b(nspecies);
+        b.resize(nspecies);
         for(unsigned i = 0; i < nspecies; ++i)
         {
             const double Tci = critical_temperatures[i];
@@ -252,12 +342,11 @@ struct CubicEOS::Impl
 
         if(calculate_interaction_params)
             kres = calculate_interaction_params(kargs);
-        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
-        ChemicalScalar amix(nspecies);
-        ChemicalScalar amixT(nspecies);
-        ChemicalScalar amixTT(nspecies);
-        ChemicalVector abar(nspecies);
-        ChemicalVector abarT(nspecies);
+
+        // Calculate the mixing parameters `aij` and their temperature derivatives
+        aij.resize(nspecies);
+        aijT.resize(nspecies);
+        aijTT.resize(nspecies);
         for(unsigned i = 0; i < nspecies; ++i)
         {
             for(unsigned j = 0; j < nspecies; ++j)
@@ -270,36 +359,49 @@ struct CubicEOS::Impl
                 const ThermoScalar sT = 0.5*s/(a[i]*a[j]) * (aT[i]*a[j] + a[i]*aT[j]);
                 const ThermoScalar sTT = 0.5*s/(a[i]*a[j]) * (aTT[i]*a[j] + 2*aT[i]*aT[j] + a[i]*aTT[j]) - sT*sT/s;
 
-                const ThermoScalar aij = r*s;
-                const ThermoScalar aijT = rT*s + r*sT;
-                const ThermoScalar aijTT = rTT*s + 2.0*rT*sT + r*sTT;
-
-                amix += x[i] * x[j] * aij;
-                amixT += x[i] * x[j] * aijT;
-                amixTT += x[i] * x[j] * aijTT;
-
-                abar[i] += 2 * x[j] * aij;
-                abarT[i] += 2 * x[j] * aijT;
+                aij.set(i, j, r*s);
+                aijT.set(i, j, rT*s + r*sT);
+                aijTT.set(i, j, rTT*s + 2.0*rT*sT + r*sTT);
             }
         }
 
-        // Finalize the calculation of `abar` and `abarT`
-        for(unsigned i = 0; i < nspecies; ++i)
+        Tcache = T;
+    }
+
+    auto operator()(Result& res, const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> void
+    {
+        // Check if the mole fractions are zero or non-initialized
+        if(x.val.size() == 0 || min(x.val) <= 0.0)
         {
-            abar[i] -= amix;
-            abarT[i] -= amixT;
+            res = Result(nspecies); // result with zero values
+            return;
         }
 
+        // Ensure the result has the dimension of the number of species
+        if(res.ln_fugacity_coefficients.val.size() != nspecies)
+            res = Result(nspecies);
+
+        // Auxiliary variables
+        const double R = universalGasConstant;
+        const double epsilon = internal::epsilon(model);
+        const double sigma = internal::sigma(model);
+
+        // Update the parameters `a`, `b` and `aij`, which depend only on temperature
+        updateTemperatureDependentParams(T);
+
+        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
+        internal::mixingRule(aij, x, Ax, amix);
+        internal::mixingRule(aijT, x, Ax, amixT);
+        internal::mixingRule(aijTT, x, Ax, amixTT);
+        internal::partialMixingRule(aij, x, amix, abar);
+        internal::partialMixingRule(aijT, x, amixT, abarT);
+
         // Calculate the parameter `bmix` of the cubic equation of state
-        ChemicalScalar bmix(nspecies);
-        Vector bbar(nspecies);
-        for(unsigned i = 0; i < nspecies; ++i)
-        {
-            const double Tci = critical_temperatures[i];
-            const double Pci = critical_pressures[i];
-            bbar[i] = Omega*R*Tci/Pci;
-            bmix += x[i] * bbar[i];
-        }
+        const Vector& bbar = b;
+        bmix.val = b.dot(x.val);
+        bmix.ddT = b.dot(x.ddT);
+        bmix.ddP = b.dot(x.ddP);
+        bmix.ddn.noalias() = tr(b) * x.ddn;
 
         // Calculate the temperature derivative of `bmix`
         const double bmixT = 0.0; // no temperature dependence
@@ -359,7 +461,7 @@ struct CubicEOS::Impl
         }
 
         // Selecting compressibility factor - Z_liq < Z_gas
-        ChemicalScalar Z(nspecies);
+        Z = 0.0;
         if (isvapor)
             Z.val = *std::max_element(cubicEOS_roots.begin(), cubicEOS_roots.end());
         else
@@ -396,27 +498,27 @@ struct CubicEOS::Impl
             // Since the phase is identified as different than the expect input phase type, it is
             // deemed inappropriate. Artificially high values are configured for fugacities, so that
             // this condition is "removed" by the optimizer.
-            result.molar_volume = 0.0;
-            result.residual_molar_gibbs_energy = 0.0;
-            result.residual_molar_enthalpy = 0.0;
-            result.residual_molar_heat_capacity_cp = 0.0;
-            result.residual_molar_heat_capacity_cv = 0.0;
-            result.partial_molar_volumes.fill(0.0);
-            result.residual_partial_molar_gibbs_energies.fill(0.0);
-            result.residual_partial_molar_enthalpies.fill(0.0);
-            result.ln_fugacity_coefficients.fill(100.0);
-            return result;
+            res.molar_volume = 0.0;
+            res.residual_molar_gibbs_energy = 0.0;
+            res.residual_molar_enthalpy = 0.0;
+            res.residual_molar_heat_capacity_cp = 0.0;
+            res.residual_molar_heat_capacity_cv = 0.0;
+            res.partial_molar_volumes.fill(0.0);
+            res.residual_partial_molar_gibbs_energies.fill(0.0);
+            res.residual_partial_molar_enthalpies.fill(0.0);
+            res.ln_fugacity_coefficients.fill(100.0);
+            return;
         }
 
-        ChemicalScalar& V = result.molar_volume;
-        ChemicalScalar& G_res = result.residual_molar_gibbs_energy;
-        ChemicalScalar& H_res = result.residual_molar_enthalpy;
-        ChemicalScalar& Cp_res = result.residual_molar_heat_capacity_cp;
-        ChemicalScalar& Cv_res = result.residual_molar_heat_capacity_cv;
-        ChemicalVector& Vi = result.partial_molar_volumes;
-        ChemicalVector& Gi_res = result.residual_partial_molar_gibbs_energies;
-        ChemicalVector& Hi_res = result.residual_partial_molar_enthalpies;
-        ChemicalVector& ln_phi = result.ln_fugacity_coefficients;
+        ChemicalScalar& V = res.molar_volume;
+        ChemicalScalar& G_res = res.residual_molar_gibbs_energy;
+        ChemicalScalar& H_res = res.residual_molar_enthalpy;
+        ChemicalScalar& Cp_res = res.residual_molar_heat_capacity_cp;
+        ChemicalScalar& Cv_res = res.residual_molar_heat_capacity_cv;
+        ChemicalVector& Vi = res.partial_molar_volumes;
+        ChemicalVector& Gi_res = res.residual_partial_molar_gibbs_energies;
+        ChemicalVector& Hi_res = res.residual_partial_molar_enthalpies;
+        ChemicalVector& ln_phi = res.ln_fugacity_coefficients;
 
         // Calculate the partial derivatives of Z (dZdT, dZdP, dZdn)
         const double factor = -1.0/(3*Z.val*Z.val + 2*A.val*Z.val + B.val);
@@ -455,16 +557,15 @@ struct CubicEOS::Impl
         {
             const double bi = bbar[i];
             const ThermoScalar betai = P*bi/(R*T);
-            const ChemicalScalar ai = abar[i];
-            const ChemicalScalar aiT = abarT[i];
-            const ChemicalScalar qi = q*(1 + ai/amix - bi/bmix);
-            const ChemicalScalar qiT = qi*qT/q + q*(aiT - ai*amixT/amix)/amix;
+            ai = abar[i];
+            aiT = abarT[i];
+            qi = q*(1 + ai/amix - bi/bmix);
+            qiT = qi*qT/q + q*(aiT - ai*amixT/amix)/amix;
             const ThermoScalar Ai = (epsilon + sigma - 1.0)*betai - 1.0;
-            const ChemicalScalar Bi = (epsilon*sigma - epsilon - sigma)*(2*beta*betai - beta*beta) - (epsilon + sigma - q)*(betai - beta) - (epsilon + sigma - qi)*beta;
-            const ChemicalScalar Ci = -3*sigma*epsilon*beta*beta*betai + 2*epsilon*sigma*beta*beta*beta - (epsilon*sigma + qi)*beta*beta - 2*(epsilon*sigma + q)*(beta*betai - beta*beta);
-            const ChemicalScalar Zi = -(Ai*Z*Z + (Bi + B)*Z + Ci + 2*C)/(3*Z*Z + 2*A*Z + B);
+            Bi = (epsilon*sigma - epsilon - sigma)*(2*beta*betai - beta*beta) - (epsilon + sigma - q)*(betai - beta) - (epsilon + sigma - qi)*beta;
+            Ci = -3*sigma*epsilon*beta*beta*betai + 2*epsilon*sigma*beta*beta*beta - (epsilon*sigma + qi)*beta*beta - 2*(epsilon*sigma + q)*(beta*betai - beta*beta);
+            Zi = -(Ai*Z*Z + (Bi + B)*Z + Ci + 2*C)/(3*Z*Z + 2*A*Z + B);
 
-            ChemicalScalar Ii;
             if(epsilon != sigma) Ii = I + ((Zi + sigma*betai)/(Z + sigma*beta) - (Zi + epsilon*betai)/(Z + epsilon*beta))/(sigma - epsilon);
                             else Ii = I * (1 + betai/beta - (Zi + epsilon*betai)/(Z + epsilon*beta));
 
@@ -474,7 +575,6 @@ struct CubicEOS::Impl
             ln_phi[i] = Gi_res[i]/(R*T);
         }
 
-        return result;
     }
 };
 
@@ -521,6 +621,7 @@ auto CubicEOS::numSpecies() const -> unsigned
 auto CubicEOS::setModel(Model model) -> void
 {
     pimpl->model = model;
+    pimpl->resetCache();
 }
 
 auto CubicEOS::setPhaseAsLiquid() -> void
@@ -545,6 +646,7 @@ auto CubicEOS::setCriticalTemperatures(const std::vector<double>& values) -> voi
         "temperatures of the gases.");
 
     pimpl->critical_temperatures = values;
+    pimpl->resetCache();
 }
 
 auto CubicEOS::setCriticalPressures(const std::vector<double>& values) -> void
@@ -559,6 +661,7 @@ auto CubicEOS::setCriticalPressures(const std::vector<double>& values) -> void
         "pressures of the gases.");
 
     pimpl->critical_pressures = values;
+    pimpl->resetCache();
 }
 
 auto CubicEOS::setAcentricFactors(const std::vector<double>& values) -> void
@@ -569,16 +672,31 @@ auto CubicEOS::setAcentricFactors(const std::vector<double>& values) -> void
         std::to_string(values.size()) + " values were given.");
 
     pimpl->acentric_factors = values;
+    pimpl->resetCache();
 }
 
 auto CubicEOS::setInteractionParamsFunction(const InteractionParamsFunction& func) -> void
 {
     pimpl->calculate_interaction_params = func;
+    pimpl->resetCache();
 }
 
 auto CubicEOS::operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
 {
-    return pimpl->operator()(T, P, x);
+    pimpl->operator()(pimpl->result, T, P, x);
+    return pimpl->result;
+}
+
+auto CubicEOS::operator()(Result& res, const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> void
+{
+    pimpl->operator()(res, T, P, x);
+}
+
+auto CubicEOS::operator()(std::vector<Result>& res, const ThermoScalar& T, const ThermoScalar& P, const std::vector<ChemicalVector>& x) -> void
+{
+    res.resize(x.size());
+    for(Index i = 0; i < x.size(); ++i)
+        pimpl->operator()(res[i], T, P, x[i]);
 }
 
 } // namespace Reaktoro
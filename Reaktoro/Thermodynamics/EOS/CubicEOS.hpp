@@ -163,6 +163,23 @@ public:
     /// @param x The mole fractions of the species in the phase (in units of mol/mol)
     auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result;
 
+    /// Calculate the thermodynamic properties of the phase without allocating a new result.
+    /// The parameters of the equation of state that depend only on temperature, including the
+    /// binary interaction parameters, are reused from the previous evaluation if temperature
+    /// has not changed.
+    /// @param[out] res The thermodynamic properties of the phase
+    /// @param T The temperature of the phase (in units of K)
+    /// @param P The pressure of the phase (in units of Pa)
+    /// @param x The mole fractions of the species in the phase (in units of mol/mol)
+    auto operator()(Result& res, const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> void;
+
+    /// Calculate the thermodynamic properties of the phase for many compositions at the same temperature and pressure.
+    /// @param[out] res The thermodynamic properties of the phase for each composition
+    /// @param T The temperature of the phase (in units of K)
+    /// @param P The pressure of the phase (in units of Pa)
+    /// @param x The mole fractions of the species in the phase for each composition (in units of mol/mol)
+    auto operator()(std::vector<Result>& res, const ThermoScalar& T, const ThermoScalar& P, const std::vector<ChemicalVector>& x) -> void;
+
 private:
     struct Impl;
 
@@ -62,34 +62,42 @@ auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeH
     const Vector charges = mixture.chargesChargedSpecies();
 
     // The Debye-Huckel parameters a and b of the charged species
-    std::vector<double> aions, bions;
+    Vector aions(num_charged_species), bions(num_charged_species);
 
     // The Debye-Huckel parameter b of the neutral species
-    std::vector<double> bneutral;
+    Vector bneutral(num_neutral_species);
 
     // Collect the Debye-Huckel parameters a and b of the charged species
-    for(Index i : icharged_species)
+    for(Index i = 0; i < num_charged_species; ++i)
     {
-        const AqueousSpecies& species = mixture.species(i);
-        aions.push_back(params.aion(species.name()));
-        bions.push_back(params.bion(species.name()));
+        const AqueousSpecies& species = mixture.species(icharged_species[i]);
+        aions[i] = params.aion(species.name());
+        bions[i] = params.bion(species.name());
     }
 
     // Collect the Debye-Huckel parameter b of the neutral species
-    for(Index i : ineutral_species)
+    for(Index i = 0; i < num_neutral_species; ++i)
     {
-        const AqueousSpecies& species = mixture.species(i);
-        bneutral.push_back(params.bneutral(species.name()));
+        const AqueousSpecies& species = mixture.species(ineutral_species[i]);
+        bneutral[i] = params.bneutral(species.name());
     }
 
+    // The squares of the electrical charges of the charged species
+    const Vector z2 = charges.array().square();
+
+    // The sum of the ratios b/z^2 of the charged species used in the activity of water
+    const double sum_bions_z2 = (bions.array()/z2.array()).sum();
+
     // The state of the aqueous mixture
     AqueousMixtureState state;
 
     // Auxiliary variables
-    ChemicalScalar xw, ln_xw, I2, sqrtI, mSigma, sigma(num_species), sigmacoeff, Lambda;
-    ChemicalVector ln_m;
+    ChemicalScalar xw, ln_xw, mSigma, Sigma(num_species), mlng(num_species), W;
     ThermoScalar A, B, sqrt_rho, T_epsilon, sqrt_T_epsilon;
 
+    // The ln activity coefficients of the charged species
+    ChemicalVector lng(num_charged_species, num_species);
+
     // Define the intermediate chemical model function of the aqueous mixture
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
@@ -108,68 +116,76 @@ auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeH
         auto& ln_a = res.ln_activities;
 
         // Update auxiliary variables
-		ln_m = log(m);
-		xw = x[iwater];
-		ln_xw = log(xw);
-		mSigma = nwo * (1 - xw)/xw;
-		I2 = I*I;
-		sqrtI = sqrt(I);
-		sqrt_rho = sqrt(rho);
-		T_epsilon = T * epsilon;
-		sqrt_T_epsilon = sqrt(T_epsilon);
-		A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
-		B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
-		sigmacoeff = (2.0/3.0)*A*I*sqrtI;
-
-        // Set the first contribution to the activity of water
-        ln_a[iwater] = mSigma;
-
-        // Loop over all charged species in the mixture
+        xw = x[iwater];
+        ln_xw = log(xw);
+        mSigma = nwo * (1 - xw)/xw;
+        sqrt_rho = sqrt(rho);
+        T_epsilon = T * epsilon;
+        sqrt_T_epsilon = sqrt(T_epsilon);
+        A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
+        B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
+
+        // Evaluate the ln activity coefficients of all charged species and the sum of their sigma parameters
+        aqueousChemicalModelDebyeHuckelIons(I, A, B, z2, aions, bions, lng, Sigma);
+
+        // The sum of the products of molalities and ln activity coefficients of all charged species
+        mlng = 0.0;
+
+        // Set the ln activity coefficients of all charged species
         for(Index i = 0; i < num_charged_species; ++i)
         {
             // The index of the current charged species
             const Index ispecies = icharged_species[i];
 
-            // The molality of the charged species and its molar derivatives
-            const auto mi = m[ispecies];
-
-            // The electrical charge of the charged species
-            const auto z = charges[i];
-
-            // Update the Lambda parameter of the Debye-Huckel activity coefficient model
-            Lambda = 1.0 + aions[i]*B*sqrtI;
+            // The molality of the charged species
+            const double mi = m.val[ispecies];
 
-			// Update the sigma parameter of the current ion
-            if(aions[i] != 0.0) sigma = 3.0*pow(Lambda - 1, -3) * ((Lambda - 1)*(Lambda - 3) + 2*log(Lambda));
-            else                sigma = 2.0;
+            // Set the ln activity coefficient of the current charged species
+            ln_g.val[ispecies] = lng.val[i];
+            ln_g.ddT[ispecies] = lng.ddT[i];
+            ln_g.ddP[ispecies] = lng.ddP[i];
+            ln_g.ddn.row(ispecies).noalias() = lng.ddn.row(i);
 
-            // Calculate the ln activity coefficient of the current charged species
-            ln_g[ispecies] = ln10 * (-A*z*z*sqrtI/Lambda + bions[i]*I);
+            // Update the contribution of the current charged species to the sum of molalities times ln activity coefficients
+            mlng.val += mi*lng.val[i];
+            mlng.ddT += m.ddT[ispecies]*lng.val[i] + mi*ln_g.ddT[ispecies];
+            mlng.ddP += m.ddP[ispecies]*lng.val[i] + mi*ln_g.ddP[ispecies];
+            mlng.ddn += lng.val[i]*m.ddn.row(ispecies) + mi*ln_g.ddn.row(ispecies);
+        }
 
-            // Calculate the ln activity of the current charged species
-            ln_a[ispecies] = ln_g[ispecies] + ln_m[ispecies];
+        // Set the ln activity coefficients of all neutral species
+        for(Index i = 0; i < num_neutral_species; ++i)
+        {
+            // The index of the current neutral species
+            const Index ispecies = ineutral_species[i];
 
-            // Calculate the contribution of current ion to the ln activity of water
-			ln_a[iwater] += mi*ln_g[ispecies] + sigmacoeff*sigma*ln10 - I2*bions[i]/(z*z)*ln10;
+            // Calculate the ln activity coefficient of the current neutral species
+            ln_g[ispecies] = ln10 * bneutral[i] * I;
         }
 
+        // Calculate the contribution of the charged species to the activity of water
+        W = mSigma;
+        if(num_charged_species)
+            W += mlng + (2.0/3.0)*ln10*A*I*sqrt(I)*Sigma - ln10*sum_bions_z2*I*I;
+
         // Finalize the computation of the activity of water (in mole fraction scale)
-        ln_a[iwater] *= -1.0/nwo;
+        ln_a[iwater] = -1.0/nwo * W;
 
         // Set the activity coefficient of water (mole fraction scale)
         ln_g[iwater] = ln_a[iwater] - ln_xw;
 
-        // Loop over all neutral species in the mixture
-        for(Index i = 0; i < num_neutral_species; ++i)
+        // Set the ln activities of the solutes using the diagonal structure of the molar derivatives of ln molalities
+        for(Index ispecies = 0; ispecies < num_species; ++ispecies)
         {
-            // The index of the current neutral species
-            const Index ispecies = ineutral_species[i];
+            if(ispecies == iwater)
+                continue;
 
-            // Calculate the ln activity coefficient of the current neutral species
-            ln_g[ispecies] = ln10 * bneutral[i] * I;
+            const double mi = m.val[ispecies];
 
-            // Calculate the ln activity coefficient of the current neutral species
-            ln_a[ispecies] = ln_g[ispecies] + ln_m[ispecies];
+            ln_a.val[ispecies] = ln_g.val[ispecies] + std::log(mi);
+            ln_a.ddT[ispecies] = ln_g.ddT[ispecies] + m.ddT[ispecies]/mi;
+            ln_a.ddP[ispecies] = ln_g.ddP[ispecies] + m.ddP[ispecies]/mi;
+            ln_a.ddn.row(ispecies).noalias() = ln_g.ddn.row(ispecies) + m.ddn.row(ispecies)/mi;
         }
     };
 
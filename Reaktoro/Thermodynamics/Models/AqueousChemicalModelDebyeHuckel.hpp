@@ -18,10 +18,14 @@
 #pragma once
 
 // C++ includes
+#include <cmath>
 #include <map>
 #include <memory>
 
 // Reaktoro includes
+#include <Reaktoro/Common/ChemicalScalar.hpp>
+#include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Common/ThermoScalar.hpp>
 #include <Reaktoro/Thermodynamics/Models/PhaseChemicalModel.hpp>
 
 namespace Reaktoro {
@@ -37,6 +41,61 @@ class DebyeHuckelParams;
 /// @see AqueousMixture, DebyeHuckelParams, PhaseChemicalModel
 auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> PhaseChemicalModel;
 
+/// Calculate the ln activity coefficients of the ionic species with the modified Debye--Hückel equation.
+/// This kernel of the Debye--Hückel activity model is a template on the vector types of its arguments.
+/// With fixed-size types, such as VectorFixed, ChemicalScalarFixed and ChemicalVectorFixed, its
+/// evaluation needs no memory allocation.
+/// @param I The ionic strength of the aqueous mixture (in units of molal)
+/// @param A The Debye--Hückel parameter *A* (in units of (mol/kg)^(-1/2))
+/// @param B The Debye--Hückel parameter *B* (in units of (mol/kg)^(-1/2)/Å)
+/// @param z2 The squares of the electrical charges of the ionic species
+/// @param aions The ion-size parameters of the ionic species (in units of Å)
+/// @param bions The Debye--Hückel parameters *b* of the ionic species
+/// @param[out] lng The ln activity coefficients of the ionic species
+/// @param[out] Sigma The sum of the parameters @eq{\sigma(\Lambda_{i})} of the ionic species
+/// @see DebyeHuckelParams
+template<typename IV, typename IN, typename Vec, typename V, typename T, typename P, typename N, typename SN>
+auto aqueousChemicalModelDebyeHuckelIons(const ChemicalScalarBase<IV,IN>& I, const ThermoScalar& A, const ThermoScalar& B,
+    const Vec& z2, const Vec& aions, const Vec& bions, ChemicalVectorBase<V,T,P,N>& lng, ChemicalScalarBase<double,SN>& Sigma) -> void
+{
+    // The natural log of 10
+    const double ln10 = std::log(10);
+
+    // The ionic strength and its square root
+    const double Ival = I.val;
+    const double sqrtI = std::sqrt(Ival);
+
+    // Evaluate the Lambda parameter of all ionic species and its partial derivatives with respect to I and B
+    const PlainType<Vec> Lambda = (1.0 + aions.array()*B.val*sqrtI).matrix();
+    const auto Lambda_I = aions.array()*B.val*0.5/sqrtI;
+    const auto Lambda_B = aions.array()*sqrtI;
+
+    // Evaluate the partial derivatives of the ln activity coefficients with respect to I, A and B
+    const PlainType<Vec> lng_I = (ln10 * (-A.val*z2.array()*(0.5/sqrtI - sqrtI*Lambda_I/Lambda.array())/Lambda.array() + bions.array())).matrix();
+    const auto lng_A = (ln10 * (-z2.array()*sqrtI/Lambda.array())).matrix();
+    const auto lng_B = (ln10 * (A.val*z2.array()*sqrtI*Lambda_B/Lambda.array().square())).matrix();
+
+    // Set the ln activity coefficients, whose molar derivatives are the rank-one product of those of I
+    lng.val = ln10 * (-A.val*z2.array()*sqrtI/Lambda.array() + bions.array()*Ival);
+    lng.ddT = lng_I*I.ddT + lng_A*A.ddT + lng_B*B.ddT;
+    lng.ddP = lng_I*I.ddP + lng_A*A.ddP + lng_B*B.ddP;
+    lng.ddn.noalias() = lng_I*I.ddn;
+
+    // Evaluate the sigma parameter of all ionic species and its partial derivatives with respect to I and B
+    const auto nonzero_aions = aions.array() != 0.0;
+    const auto u = Lambda.array() - 1.0;
+    const PlainType<Vec> sigma = nonzero_aions.select(3.0/u.cube() * (u*(u - 2.0) + 2.0*Lambda.array().log()), 2.0).matrix();
+    const auto sigma_I = nonzero_aions.select(-3.0*sigma.array()/u + 6.0/(u*Lambda.array()), 0.0);
+
+    // The sum of sigma parameters of all ionic species and its partial derivatives
+    const double sum_sigma_I = (sigma_I * Lambda_I).sum();
+    const double sum_sigma_B = (sigma_I * Lambda_B).sum();
+    Sigma.val = sigma.sum();
+    Sigma.ddT = sum_sigma_I*I.ddT + sum_sigma_B*B.ddT;
+    Sigma.ddP = sum_sigma_I*I.ddP + sum_sigma_B*B.ddP;
+    Sigma.ddn = sum_sigma_I*I.ddn;
+}
+
 /**
 A class used to define the parameters in the Debye--Hückel activity model for aqueous mixtures.
 
@@ -301,10 +301,10 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
     const Index iwater = mixture.indexWater();
 
     // The effective electrostatic radii of the charged species
-    std::vector<double> effective_radii;
+    Vector effective_radii(num_charged_species);
 
     // The electrical charges of the charged species only
-    std::vector<double> charges;
+    Vector charges(num_charged_species);
 
     // The Born coefficient of the ion H+
     const double omegaH = 0.5387e+05;
@@ -319,13 +319,36 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
     AqueousMixtureState state;
 
     // Collect the effective radii of the ions
-    for(Index idx_ion : icharged_species)
+    for(Index i = 0; i < num_charged_species; ++i)
     {
-        const AqueousSpecies& species = mixture.species(idx_ion);
-        effective_radii.push_back(effectiveIonicRadius(species));
-        charges.push_back(species.charge());
+        const AqueousSpecies& species = mixture.species(icharged_species[i]);
+        effective_radii[i] = effectiveIonicRadius(species);
+        charges[i] = species.charge();
     }
 
+    // The squares and absolute values of the electrical charges of the charged species
+    const Vector z2 = charges.array().square();
+    const Vector zabs = charges.array().abs();
+
+    // The absolute Born coefficients of the charged species
+    const Vector omega_abs = eta*z2.array()/effective_radii.array();
+
+    // The Born coefficients of the charged species
+    const Vector omega = omega_abs.array() - charges.array()*omegaH;
+
+    // The Debye-Huckel ion size parameters of the charged species as computed by Reed (1982) and also in TOUGHREACT
+    const Vector a = (charges.array() < 0.0).select(
+        2.0*(effective_radii.array() + 1.91*zabs.array())/(zabs.array() + 1.0),
+        2.0*(effective_radii.array() + 1.81*zabs.array())/(zabs.array() + 1.0));
+
+    // The auxiliary arrays for the charged species: the Lambda and sigma parameters, the log10 of the activity
+    // coefficients and the psi contributions to the osmotic coefficient, as well as their partial derivatives
+    // with respect to ionic strength
+    Vector lambda, lambda_I, sigma, sigma_I, log10_g, log10_g_I, psi, psi_I;
+
+    // The osmotic coefficient of the aqueous phase
+    ChemicalScalar phi(num_species);
+
     // Define the chemical model function of the aqueous phase
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
@@ -337,8 +360,13 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
         const auto& x = state.x;
         const auto& m = state.m;
 
-        // The square root of the ionic strength
-        const auto sqrtI = sqrt(I);
+        // Auxiliary references
+        auto& ln_g = res.ln_activity_coefficients;
+        auto& ln_a = res.ln_activities;
+
+        // The ionic strength and its square root
+        const double Ival = I.val;
+        const double sqrtI = std::sqrt(Ival);
 
         // The mole fraction of the water species and its molar derivatives
         const auto xw = x[iwater];
@@ -356,78 +384,81 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
         const double bNaCl = solventParamNaCl(T.val, P.val);
         const double bNapClm = shortRangeInteractionParamNaCl(T.val, P.val);
 
-        // The osmotic coefficient of the aqueous phase
-        ChemicalScalar phi(num_species);
+        // Evaluate the \Lambda parameter of all charged species and its partial derivatives with respect to I
+        lambda = 1.0 + a.array()*B*sqrtI;
+        lambda_I = a.array()*B*0.5/sqrtI;
+
+        // Evaluate the log10 of the activity coefficients of all charged species (in mole fraction scale), except
+        // the log10_xw contribution, and its partial derivatives with respect to I. This is the equation (298)
+        // in Helgeson et a. (1981) paper, page 230.
+        log10_g = -A*z2.array()*sqrtI/lambda.array() + (omega_abs.array()*bNaCl + bNapClm - 0.19*(zabs.array() - 1.0)) * Ival;
+        log10_g_I = -A*z2.array()*(0.5/sqrtI - sqrtI*lambda_I.array()/lambda.array())/lambda.array() + omega_abs.array()*bNaCl + bNapClm - 0.19*(zabs.array() - 1.0);
+
+        // Evaluate the sigma parameter of all charged species and its partial derivatives with respect to I
+        const auto u = (lambda.array() - 1.0).eval();
+        sigma = 3.0/u.cube() * (lambda.array() - 1.0/lambda.array() - 2.0*lambda.array().log());
+        sigma_I = (-3.0*sigma.array()/u + 3.0/(u*lambda.array().square())) * lambda_I.array();
+
+        // Evaluate the psi contributions of all charged species, except the alpha contribution, and its partial derivatives with respect to I
+        psi = A*z2.array()*sqrtI*sigma.array()/3.0 - 0.5*(omega.array()*bNaCl + bNapClm - 0.19*(zabs.array() - 1.0)) * Ival;
+        psi_I = A*z2.array()*(0.5/sqrtI*sigma.array() + sqrtI*sigma_I.array())/3.0 - 0.5*(omega.array()*bNaCl + bNapClm - 0.19*(zabs.array() - 1.0));
 
         // Set the activity coefficients of the neutral species to
         // water mole fraction to convert it to molality scale
-        res.ln_activity_coefficients = 0.0;
-//        res.ln_activity_coefficients = ln_xw;
+        ln_g = 0.0;
+//        ln_g = ln_xw;
+
+        // Initialize the osmotic coefficient of the aqueous phase
+        phi = 0.0;
 
         // Loop over all charged species in the mixture
-        for(unsigned i = 0; i < num_charged_species; ++i)
+        for(Index i = 0; i < num_charged_species; ++i)
         {
             // The index of the charged species in the mixture
             const Index ispecies = icharged_species[i];
 
-            // The molality of the charged species and its molar derivatives
-            const auto mi = m[ispecies];
+            // The molality of the charged species
+            const double mi = m.val[ispecies];
 
             // Check if the molality of the charged species is zero
-            if(mi.val == 0.0)
+            if(mi == 0.0)
                 continue;
 
-            // The electrical charge of the charged species
-            const double z = charges[i];
-            const double z2 = z*z;
-
-            // The effective radius of the charged species
-            const double eff_radius = effective_radii[i];
+            // Set the activity coefficient of the current charged species using the rank-one
+            // structure of its derivatives, a multiple of those of ionic strength plus those of log10_xw
+            ln_g.val[ispecies] = ln10 * (log10_g[i] + log10_xw.val);
+            ln_g.ddT[ispecies] = ln10 * (log10_g_I[i]*I.ddT + log10_xw.ddT);
+            ln_g.ddP[ispecies] = ln10 * (log10_g_I[i]*I.ddP + log10_xw.ddP);
+            ln_g.ddn.row(ispecies).noalias() = ln10 * (log10_g_I[i]*I.ddn + log10_xw.ddn);
 
-            // The Born coefficient of the current charged species
-            const double omega = eta*z2/eff_radius - z*omegaH;
-
-            // The absolute Born coefficient of the current charged species
-            const double omega_abs = eta*z2/eff_radius;
-
-            // The Debye-Huckel ion size parameter of the current ion as computed by Reed (1982) and also in TOUGHREACT
-            const double a = (z < 0) ?
-                2.0*(eff_radius + 1.91*std::abs(z))/(std::abs(z) + 1.0) :
-                2.0*(eff_radius + 1.81*std::abs(z))/(std::abs(z) + 1.0);
-
-            // The \Lamba parameter of the HKF activity coefficient model and its molar derivatives
-            const ChemicalScalar lambda = 1.0 + a*B*sqrtI;
-
-            // The log10 of the activity coefficient of the charged species (in mole fraction scale) and its molar derivatives
-            // This is the equation (298) in Helgeson et a. (1981) paper, page 230.
-            const ChemicalScalar log10_gi = -(A*z2*sqrtI)/lambda + log10_xw + (omega_abs * bNaCl + bNapClm - 0.19*(std::abs(z) - 1.0)) * I;
-
-            // Set the activity coefficient of the current charged species
-            res.ln_activity_coefficients[ispecies] = log10_gi * ln10;
-
-            // Check if the mole fraction of water is one
+            // Update the osmotic coefficient with the contribution of the current charged species
             if(xw != 1.0)
             {
-                // The sigma parameter of the current ion and its molar derivatives
-                const auto sigma = 3.0/pow(a*B*sqrtI, 3) * (lambda - 1.0/lambda - 2.0*log(lambda));
-
-                // The psi contribution of the current ion and its molar derivatives
-                const auto psi = A*z2*sqrtI*sigma/3.0 + alpha - 0.5*(omega*bNaCl + bNapClm - 0.19*(std::abs(z) - 1.0)) * I;
-
-                // Update the osmotic coefficient with the contribution of the current charged species
-                phi += mi * psi;
+                const double psii = psi[i] + alpha.val;
+                phi.val += mi * psii;
+                phi.ddT += m.ddT[ispecies]*psii + mi*(psi_I[i]*I.ddT + alpha.ddT);
+                phi.ddP += m.ddP[ispecies]*psii + mi*(psi_I[i]*I.ddP + alpha.ddP);
+                phi.ddn += psii*m.ddn.row(ispecies) + mi*(psi_I[i]*I.ddn + alpha.ddn);
             }
         }
 
-        // Set the activities of the solutes (molality scale)
-        res.ln_activities = res.ln_activity_coefficients + log(m);
+        // Set the activities of the solutes (molality scale) using the diagonal structure of the molar derivatives of ln molalities
+        for(Index ispecies = 0; ispecies < num_species; ++ispecies)
+        {
+            const double mi = m.val[ispecies];
+
+            ln_a.val[ispecies] = ln_g.val[ispecies] + std::log(mi);
+            ln_a.ddT[ispecies] = ln_g.ddT[ispecies] + m.ddT[ispecies]/mi;
+            ln_a.ddP[ispecies] = ln_g.ddP[ispecies] + m.ddP[ispecies]/mi;
+            ln_a.ddn.row(ispecies).noalias() = ln_g.ddn.row(ispecies) + m.ddn.row(ispecies)/mi;
+        }
 
         // Set the activity of water (in mole fraction scale)
-        if(xw != 1.0) res.ln_activities[iwater] = ln10 * Mw * phi;
-                 else res.ln_activities[iwater] = ln_xw;
+        if(xw != 1.0) ln_a[iwater] = ln10 * Mw * phi;
+                 else ln_a[iwater] = ln_xw;
 
         // Set the activity coefficient of water (mole fraction scale)
-        res.ln_activity_coefficients[iwater] = res.ln_activities[iwater] - ln_xw;
+        ln_g[iwater] = ln_a[iwater] - ln_xw;
     };
 
     return model;
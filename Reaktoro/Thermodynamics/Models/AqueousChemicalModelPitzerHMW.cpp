@@ -36,28 +36,6 @@
 namespace Reaktoro {
 namespace Pitzer {
 
-template<typename T> using Table1D = std::vector<T>;
-template<typename T> using Table2D = std::vector<std::vector<T>>;
-template<typename T> using Table3D = std::vector<std::vector<std::vector<T>>>;
-
-template<typename T>
-auto initTable1D(unsigned dim1) -> Table1D<T>
-{
-    return Table1D<T>(dim1);
-}
-
-template<typename T>
-auto initTable2D(unsigned dim1, unsigned dim2) -> Table2D<T>
-{
-    return Table2D<T>(dim1, initTable1D<T>(dim2));
-}
-
-template<typename T>
-auto initTable3D(unsigned dim1, unsigned dim2, unsigned dim3) -> Table3D<T>
-{
-    return Table3D<T>(dim1, initTable2D<T>(dim2, dim3));
-}
-
 const std::vector<std::string> beta0_data =
 {
     "Ba++       Br-           0.31455   -3.3825e-4",
@@ -473,13 +451,35 @@ const std::vector<double> Aphi_data =
     0.31695465, 0.32925197, 0.34262585, 0.35747187, 0.37383264, 0.39162945, 0.41072659, 0.43094633, 0.45206745, 0.47381721, 0.49585921, 0.51777702, 0.53905156, 0.55902802, 0.57686399
 };
 
-/// Creates a function of temperature (in units of K) that computes a single-salt interaction parameter.
+/// The reference temperature of the temperature-dependent single-salt parameters (in units of K)
+const double Tr = 298.15;
+
+/// The number of terms in the temperature dependence of the single-salt parameters.
+/// All single-salt parameters are stored in the form
+/// \f[
+///      p(T) = c_0 + c_1\left(\frac{1}{T}-\frac{1}{T_r}\right) + c_2\ln\frac{T}{T_r} + c_3(T-T_r) + c_4(T^2-T_r^2),
+/// \f]
+/// so that the parameters of all cation-anion pairs can be evaluated with a single matrix-vector product.
+const Index num_temperature_terms = 5;
+
+/// Return the temperature terms of the single-salt parameters.
+/// @param T The temperature (in units of K)
+auto temperatureTerms(double T) -> Vector
+{
+    Vector terms(num_temperature_terms);
+    terms << 1.0, 1/T - 1/Tr, std::log(T/Tr), T - Tr, T*T - Tr*Tr;
+    return terms;
+}
+
+/// Return the coefficients of the temperature terms of a single-salt interaction parameter.
 /// @param cation The name of the cation
 /// @param anion The name of the anion
-/// @param data The data from which the function will be created (beta0data, beta1data, beta2data, cphidata)
-/// @return The function of temperature that computes the interaction parameter
-auto createSingleSaltParamFunction(std::string cation, std::string anion, const std::vector<std::string>& data) -> std::function<double(double)>
+/// @param data The data from which the coefficients will be parsed (beta0data, beta1data, beta2data, cphidata)
+/// @return The coefficients of the interaction parameter (all zero if the pair cation and anion does not have Pitzer data)
+auto singleSaltParamCoeffs(std::string cation, std::string anion, const std::vector<std::string>& data) -> Vector
 {
+    Vector coeffs = zeros(num_temperature_terms);
+
     // Iterate over all lines of data and find the one with the pair cation and anion
     for(const auto& line : data)
     {
@@ -487,60 +487,37 @@ auto createSingleSaltParamFunction(std::string cation, std::string anion, const
 
         if(cation == words[0] && anion == words[1])
         {
-            const double Tr = 298.15;
-
             std::vector<double> c(words.size() - 2);
 
             for(unsigned i = 0; i < c.size(); ++i)
                 c[i] = tofloat(words[i + 2]);
 
             if(c.size() == 1)
-                return [=](double T) { return c[0]; };
+            {
+                coeffs[0] = c[0];
+                return coeffs;
+            }
 
             if(c.size() == 2)
-                return [=](double T) { return c[0] + c[1]*(T - Tr); };
+            {
+                coeffs[0] = c[0];
+                coeffs[3] = c[1];
+                return coeffs;
+            }
 
             if(c.size() == 5)
-                return [=](double T) { return c[0] + c[1]*(1/T - 1/Tr) + c[2]*std::log(T/Tr) + c[3]*(T - Tr) + c[4]*(T*T - Tr*Tr); };
+            {
+                for(unsigned i = 0; i < c.size(); ++i)
+                    coeffs[i] = c[i];
+                return coeffs;
+            }
 
             RuntimeError("Cannot create the single salt parameter function of Pitzer model.",
                 "The number of coefficients for the equation is not supported");
         }
     }
 
-    // Return a zero function in case the pair cation and anion does not have Pitzer data
-    return [=](double T) { return 0.0; };
-}
-
-auto createSingleSaltParamTable(const std::vector<std::string>& cations, const std::vector<std::string>& anions, const std::vector<std::string>& data) -> Table2D<std::function<double(double)>>
-{
-    Table2D<std::function<double(double)>> table = initTable2D<std::function<double(double)>>(cations.size(), anions.size());
-
-    for(unsigned i = 0; i < cations.size(); ++i)
-        for(unsigned j = 0; j < anions.size(); ++j)
-            table[i][j] = createSingleSaltParamFunction(cations[i], anions[j], data);
-
-    return table;
-}
-
-auto createBeta0Table(const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table2D<std::function<double(double)>>
-{
-    return createSingleSaltParamTable(cations, anions, beta0_data);
-}
-
-auto createBeta1Table(const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table2D<std::function<double(double)>>
-{
-    return createSingleSaltParamTable(cations, anions, beta1_data);
-}
-
-auto createBeta2Table(const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table2D<std::function<double(double)>>
-{
-    return createSingleSaltParamTable(cations, anions, beta2_data);
-}
-
-auto createCphiTable(const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table2D<std::function<double(double)>>
-{
-    return createSingleSaltParamTable(cations, anions, Cphi_data);
+    return coeffs;
 }
 
 auto theta(std::string ion1, std::string ion2) -> double
@@ -609,50 +586,114 @@ auto zeta(std::string neutral, std::string cation, std::string anion) -> double
     return 0.0;
 }
 
-auto createThetaTable(const std::vector<std::string>& ions1, const std::vector<std::string>& ions2) -> Table2D<double>
+/// A cation-anion pair with non-zero single-salt interaction parameters.
+struct SaltPair
 {
-    Table2D<double> table = initTable2D<double>(ions1.size(), ions2.size());
+    /// The local index of the cation among all cations in the mixture
+    Index c;
 
-    for(unsigned i = 0; i < ions1.size(); ++i)
-        for(unsigned j = 0; j < ions2.size(); ++j)
-            table[i][j] = theta(ions1[i], ions2[j]);
+    /// The local index of the anion among all anions in the mixture
+    Index a;
 
-    return table;
+    /// The flag that indicates if both cation and anion are divalent (2-2 electrolyte)
+    bool divalent;
+};
+
+/// A non-zero interaction parameter between two species (e.g., θ and λ).
+struct BinaryParam
+{
+    /// The local index of the first species in its group (cations, anions or neutrals)
+    Index i;
+
+    /// The local index of the second species in its group (cations, anions or neutrals)
+    Index j;
+
+    /// The value of the interaction parameter
+    double value;
+};
+
+/// A non-zero interaction parameter among three species (e.g., ψ and ζ).
+struct TernaryParam
+{
+    /// The local index of the first species in its group (cations, anions or neutrals)
+    Index i;
+
+    /// The local index of the second species in its group (cations, anions or neutrals)
+    Index j;
+
+    /// The local index of the third species in its group (cations, anions or neutrals)
+    Index k;
+
+    /// The value of the interaction parameter
+    double value;
+};
+
+/// Return the pairs of distinct ions, with the same charge sign, that have non-zero mixing terms.
+/// A pair is kept if it has a non-zero θ parameter or if its ions have different charges
+/// (in which case the electrostatic mixing term is non-zero).
+auto createThetaPairs(const std::vector<std::string>& ions, VectorConstRef z) -> std::vector<BinaryParam>
+{
+    std::vector<BinaryParam> pairs;
+
+    for(Index i = 0; i < ions.size(); ++i)
+        for(Index j = i + 1; j < ions.size(); ++j)
+        {
+            const double value = theta(ions[i], ions[j]);
+            if(value != 0.0 || z[i] != z[j])
+                pairs.push_back({i, j, value});
+        }
+
+    return pairs;
 }
 
-auto createPsiTable(const std::vector<std::string>& ions1, const std::vector<std::string>& ions2, const std::vector<std::string>& ions3) -> Table3D<double>
+/// Return the non-zero ψ parameters among two distinct ions of same charge sign and an ion of opposite charge sign.
+auto createPsiTriplets(const std::vector<std::string>& ions1, const std::vector<std::string>& ions2) -> std::vector<TernaryParam>
 {
-    Table3D<double> table = initTable3D<double>(ions1.size(), ions2.size(), ions3.size());
+    std::vector<TernaryParam> triplets;
 
-    for(unsigned i = 0; i < ions1.size(); ++i)
-        for(unsigned j = 0; j < ions2.size(); ++j)
-            for(unsigned k = 0; k < ions3.size(); ++k)
-                table[i][j][k] = psi(ions1[i], ions2[j], ions3[k]);
+    for(Index i = 0; i < ions1.size(); ++i)
+        for(Index j = i + 1; j < ions1.size(); ++j)
+            for(Index k = 0; k < ions2.size(); ++k)
+            {
+                const double value = psi(ions1[i], ions1[j], ions2[k]);
+                if(value != 0.0)
+                    triplets.push_back({i, j, k, value});
+            }
 
-    return table;
+    return triplets;
 }
 
-auto createLambdaTable(const std::vector<std::string>& neutrals, const std::vector<std::string>& ions) -> Table2D<double>
+/// Return the non-zero λ parameters between neutral species and ions.
+auto createLambdaPairs(const std::vector<std::string>& neutrals, const std::vector<std::string>& ions) -> std::vector<BinaryParam>
 {
-    Table2D<double> table = initTable2D<double>(neutrals.size(), ions.size());
+    std::vector<BinaryParam> pairs;
 
-    for(unsigned i = 0; i < neutrals.size(); ++i)
-        for(unsigned j = 0; j < ions.size(); ++j)
-            table[i][j] = lambda(neutrals[i], ions[j]);
+    for(Index i = 0; i < neutrals.size(); ++i)
+        for(Index j = 0; j < ions.size(); ++j)
+        {
+            const double value = lambda(neutrals[i], ions[j]);
+            if(value != 0.0)
+                pairs.push_back({i, j, value});
+        }
 
-    return table;
+    return pairs;
 }
 
-auto createZetaTable(const std::vector<std::string>& neutrals, const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table3D<double>
+/// Return the non-zero ζ parameters among neutral species, cations and anions.
+auto createZetaTriplets(const std::vector<std::string>& neutrals, const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> std::vector<TernaryParam>
 {
-    Table3D<double> table = initTable3D<double>(neutrals.size(), cations.size(), anions.size());
+    std::vector<TernaryParam> triplets;
 
-    for(unsigned i = 0; i < neutrals.size(); ++i)
-        for(unsigned j = 0; j < cations.size(); ++j)
-            for(unsigned k = 0; k < anions.size(); ++k)
-                table[i][j][k] = zeta(neutrals[i], cations[j], anions[k]);
+    for(Index i = 0; i < neutrals.size(); ++i)
+        for(Index j = 0; j < cations.size(); ++j)
+            for(Index k = 0; k < anions.size(); ++k)
+            {
+                const double value = zeta(neutrals[i], cations[j], anions[k]);
+                if(value != 0.0)
+                    triplets.push_back({i, j, k, value});
+            }
 
-    return table;
+    return triplets;
 }
 
 auto interpolate(double x, double x0, double x1, const std::vector<double>& ypoints) -> double
@@ -702,6 +743,9 @@ struct PitzerParams
 
     explicit PitzerParams(const AqueousMixture& mixture);
 
+    /// Update the temperature and pressure dependent parameters, if T or P have changed.
+    auto update(double T, double P) -> void;
+
     Indices idx_neutrals;
 
     Indices idx_charged;
@@ -716,29 +760,60 @@ struct PitzerParams
 
     Vector z_anions;
 
-    Table2D<std::function<double(double)>> beta0;
+    /// The cation-anion pairs with non-zero single-salt parameters
+    std::vector<SaltPair> salts;
+
+    /// The coefficients of the temperature terms of β0 for each salt pair (one row per pair)
+    Matrix beta0_coeffs;
+
+    /// The coefficients of the temperature terms of β1 for each salt pair (one row per pair)
+    Matrix beta1_coeffs;
+
+    /// The coefficients of the temperature terms of β2 for each salt pair (one row per pair)
+    Matrix beta2_coeffs;
+
+    /// The coefficients of the temperature terms of Cφ for each salt pair (one row per pair)
+    Matrix Cphi_coeffs;
+
+    /// The factors 1/(2√|zc·za|) that convert Cφ into C for each salt pair
+    Vector Cphi_factors;
+
+    std::vector<BinaryParam> theta_cc;
+
+    std::vector<BinaryParam> theta_aa;
 
-    Table2D<std::function<double(double)>> beta1;
+    std::vector<TernaryParam> psi_cca;
 
-    Table2D<std::function<double(double)>> beta2;
+    std::vector<TernaryParam> psi_aac;
 
-    Table2D<std::function<double(double)>> Cphi;
+    std::vector<BinaryParam> lambda_nc;
 
-    Table2D<double> theta_cc;
+    std::vector<BinaryParam> lambda_na;
 
-    Table2D<double> theta_aa;
+    std::vector<TernaryParam> zeta;
 
-    Table3D<double> psi_cca;
+    BilinearInterpolator Aphi_interpolator;
 
-    Table3D<double> psi_aac;
+    /// The temperature (in units of K) at which the single-salt parameters were last evaluated
+    double T = 0.0;
 
-    Table2D<double> lambda_nc;
+    /// The pressure (in units of Pa) at which Aphi was last evaluated
+    double P = 0.0;
 
-    Table2D<double> lambda_na;
+    /// The values of β0 for each salt pair at the current temperature
+    Vector beta0;
 
-    Table3D<double> zeta;
+    /// The values of β1 for each salt pair at the current temperature
+    Vector beta1;
 
-    BilinearInterpolator Aphi;
+    /// The values of β2 for each salt pair at the current temperature
+    Vector beta2;
+
+    /// The values of C for each salt pair at the current temperature
+    Vector C;
+
+    /// The Debye-Huckel coefficient Aphi at the current temperature and pressure
+    double Aphi = 0.0;
 };
 
 PitzerParams::PitzerParams()
@@ -773,23 +848,60 @@ PitzerParams::PitzerParams(const AqueousMixture& mixture)
     for(std::string& anion : anions)
         anion = conventionalChargedSpeciesName(anion);
 
-    // Create the interpolation interaction parameter tables using the
-    // converted neutral and ion names to Reaktoro's naming convention
-    beta0 = createBeta0Table(cations, anions);
-    beta1 = createBeta1Table(cations, anions);
-    beta2 = createBeta2Table(cations, anions);
-    Cphi  = createCphiTable(cations, anions);
+    // Collect the cation-anion pairs with non-zero single-salt parameters and their coefficients
+    std::vector<Vector> beta0_rows, beta1_rows, beta2_rows, Cphi_rows;
+
+    for(Index c = 0; c < cations.size(); ++c)
+    {
+        for(Index a = 0; a < anions.size(); ++a)
+        {
+            Vector beta0_row = singleSaltParamCoeffs(cations[c], anions[a], beta0_data);
+            Vector beta1_row = singleSaltParamCoeffs(cations[c], anions[a], beta1_data);
+            Vector beta2_row = singleSaltParamCoeffs(cations[c], anions[a], beta2_data);
+            Vector Cphi_row  = singleSaltParamCoeffs(cations[c], anions[a], Cphi_data);
+
+            if(beta0_row.isZero() && beta1_row.isZero() && beta2_row.isZero() && Cphi_row.isZero())
+                continue;
+
+            const bool divalent = std::abs(z_cations[c]) == 2 && std::abs(z_anions[a]) == 2;
+
+            salts.push_back({c, a, divalent});
+            beta0_rows.push_back(beta0_row);
+            beta1_rows.push_back(beta1_row);
+            beta2_rows.push_back(beta2_row);
+            Cphi_rows.push_back(Cphi_row);
+        }
+    }
+
+    const Index num_salts = salts.size();
+
+    beta0_coeffs.resize(num_salts, num_temperature_terms);
+    beta1_coeffs.resize(num_salts, num_temperature_terms);
+    beta2_coeffs.resize(num_salts, num_temperature_terms);
+    Cphi_coeffs.resize(num_salts, num_temperature_terms);
+    Cphi_factors.resize(num_salts);
+
+    for(Index p = 0; p < num_salts; ++p)
+    {
+        beta0_coeffs.row(p) = beta0_rows[p];
+        beta1_coeffs.row(p) = beta1_rows[p];
+        beta2_coeffs.row(p) = beta2_rows[p];
+        Cphi_coeffs.row(p)  = Cphi_rows[p];
+        Cphi_factors[p] = 0.5/std::sqrt(std::abs(z_cations[salts[p].c] * z_anions[salts[p].a]));
+    }
 
-    theta_cc = createThetaTable(cations, cations);
-    theta_aa = createThetaTable(anions, anions);
+    // Create the sparse lists of non-zero mixing parameters using the
+    // converted neutral and ion names to Reaktoro's naming convention
+    theta_cc = createThetaPairs(cations, z_cations);
+    theta_aa = createThetaPairs(anions, z_anions);
 
-    psi_cca = createPsiTable(cations, cations, anions);
-    psi_aac = createPsiTable(anions, anions, cations);
+    psi_cca = createPsiTriplets(cations, anions);
+    psi_aac = createPsiTriplets(anions, cations);
 
-    lambda_nc = createLambdaTable(neutrals, cations);
-    lambda_na = createLambdaTable(neutrals, anions);
+    lambda_nc = createLambdaPairs(neutrals, cations);
+    lambda_na = createLambdaPairs(neutrals, anions);
 
-    zeta = createZetaTable(neutrals, cations, anions);
+    zeta = createZetaTriplets(neutrals, cations, anions);
 
     std::vector<double> temperatures = Aphi_temperatures;
     std::vector<double> pressures = Aphi_pressures;
@@ -797,7 +909,28 @@ PitzerParams::PitzerParams(const AqueousMixture& mixture)
     for(auto& x : temperatures) x = convertCelsiusToKelvin(x);
     for(auto& x : pressures) x = convertBarToPascal(x);
 
-    Aphi = BilinearInterpolator(temperatures, pressures, Aphi_data);
+    Aphi_interpolator = BilinearInterpolator(temperatures, pressures, Aphi_data);
+}
+
+auto PitzerParams::update(double Tnew, double Pnew) -> void
+{
+    if(Tnew == T && Pnew == P)
+        return;
+
+    // Evaluate the single-salt parameters of all salt pairs at once
+    if(Tnew != T)
+    {
+        const Vector terms = temperatureTerms(Tnew);
+        beta0 = beta0_coeffs * terms;
+        beta1 = beta1_coeffs * terms;
+        beta2 = beta2_coeffs * terms;
+        C = (Cphi_coeffs * terms).cwiseProduct(Cphi_factors);
+    }
+
+    Aphi = Aphi_interpolator(Tnew, Pnew);
+
+    T = Tnew;
+    P = Pnew;
 }
 
 auto thetaE(const AqueousMixtureState& state, const PitzerParams& pitzer, double zi, double zj) -> double
@@ -805,10 +938,8 @@ auto thetaE(const AqueousMixtureState& state, const PitzerParams& pitzer, double
     if(zi == zj) return 0.0;
 
     const double I     = state.Ie.val;
-    const double T     = state.T.val;
-    const double P     = state.P.val;
     const double sqrtI = std::sqrt(I);
-    const double Aphi  = pitzer.Aphi(T, P);
+    const double Aphi  = pitzer.Aphi;
     const double xij   = 6.0*zi*zj*Aphi*sqrtI;
     const double xii   = 6.0*zi*zi*Aphi*sqrtI;
     const double xjj   = 6.0*zj*zj*Aphi*sqrtI;
@@ -824,10 +955,8 @@ auto thetaE_prime(const AqueousMixtureState& state, const PitzerParams& pitzer,
     if(zi == zj) return 0.0;
 
     const double I     = state.Ie.val;
-    const double T     = state.T.val;
-    const double P     = state.P.val;
     const double sqrtI = std::sqrt(I);
-    const double Aphi  = pitzer.Aphi(T, P);
+    const double Aphi  = pitzer.Aphi;
     const double xij   = 6.0*zi*zj*Aphi*sqrtI;
     const double xii   = 6.0*zi*zi*Aphi*sqrtI;
     const double xjj   = 6.0*zj*zj*Aphi*sqrtI;
@@ -838,70 +967,6 @@ auto thetaE_prime(const AqueousMixtureState& state, const PitzerParams& pitzer,
     return zi*zj/(8*I*I) * (J1ij - 0.5*J1ii - 0.5*J1jj) - thetaE(state, pitzer, zi, zj)/I;
 }
 
-auto thetaE_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    const double zi = pitzer.z_cations[i];
-    const double zj = pitzer.z_cations[j];
-    return thetaE(state, pitzer, zi, zj);
-}
-
-auto thetaE_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    const double zi = pitzer.z_anions[i];
-    const double zj = pitzer.z_anions[j];
-    return thetaE(state, pitzer, zi, zj);
-}
-
-auto thetaE_prime_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    const double zi = pitzer.z_cations[i];
-    const double zj = pitzer.z_cations[j];
-    return thetaE_prime(state, pitzer, zi, zj);
-}
-
-auto thetaE_prime_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    const double zi = pitzer.z_anions[i];
-    const double zj = pitzer.z_anions[j];
-    return thetaE_prime(state, pitzer, zi, zj);
-}
-
-auto Phi_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    const double thetaij = pitzer.theta_cc[i][j];
-    return thetaij + thetaE_cc(state, pitzer, i, j);
-}
-
-auto Phi_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    const double thetaij = pitzer.theta_aa[i][j];
-    return thetaij + thetaE_aa(state, pitzer, i, j);
-}
-
-auto Phi_phi_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    const double I = state.Ie.val;
-    const double thetaij = pitzer.theta_cc[i][j];
-    return thetaij + thetaE_cc(state, pitzer, i, j) + I * thetaE_prime_cc(state, pitzer, i, j);
-}
-
-auto Phi_phi_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    const double I = state.Ie.val;
-    const double thetaij = pitzer.theta_aa[i][j];
-    return thetaij + thetaE_aa(state, pitzer, i, j) + I * thetaE_prime_aa(state, pitzer, i, j);
-}
-
-auto Phi_prime_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    return thetaE_prime_cc(state, pitzer, i, j);
-}
-
-auto Phi_prime_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> double
-{
-    return thetaE_prime_aa(state, pitzer, i, j);
-}
-
 auto g(double x) -> double
 {
     return 2.0*(1 - (1 + x)*std::exp(-x))/(x*x);
@@ -916,325 +981,269 @@ const double alpha  =  2.0;
 const double alpha1 =  1.4;
 const double alpha2 = 12.0;
 
-auto B_phi(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> double
-{
-    const double I     = state.Ie.val;
-    const double T     = state.T.val;
-    const double sqrtI = std::sqrt(I);
-    const double zc    = pitzer.z_cations[c];
-    const double za    = pitzer.z_anions[a];
-    const double beta0 = pitzer.beta0[c][a](T);
-    const double beta1 = pitzer.beta1[c][a](T);
-    const double beta2 = pitzer.beta2[c][a](T);
-
-    if(std::abs(zc) == 2 && std::abs(za) == 2)
-        return beta0 + beta1 * std::exp(-alpha1*sqrtI) + beta2 * std::exp(-alpha2*sqrtI);
-    else
-        return beta0 + beta1 * std::exp(-alpha*sqrtI);
-}
-
-auto B(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> double
-{
-    const double I     = state.Ie.val;
-    const double T     = state.T.val;
-    const double sqrtI = std::sqrt(I);
-    const double zc    = pitzer.z_cations[c];
-    const double za    = pitzer.z_anions[a];
-    const double beta0 = pitzer.beta0[c][a](T);
-    const double beta1 = pitzer.beta1[c][a](T);
-    const double beta2 = pitzer.beta2[c][a](T);
-
-    if(std::abs(zc) == 2 && std::abs(za) == 2)
-        return beta0 + beta1 * g(alpha1*sqrtI) + beta2 * g(alpha2*sqrtI);
-    else
-        return beta0 + beta1 * g(alpha*sqrtI);
-}
-
-auto B_prime(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> double
+/// The intermediate quantities of the Harvie-Moller-Weare Pitzer's model that are shared by all species.
+/// These quantities are computed once per evaluation of the model, with a single pass over the non-zero
+/// interaction parameters. The natural log of the activity coefficients of all species and their partial
+/// derivatives with respect to molalities are then assembled from them.
+struct PitzerState
 {
-    const double I     = state.Ie.val;
-    const double T     = state.T.val;
-    const double sqrtI = std::sqrt(I);
-    const double zc    = pitzer.z_cations[c];
-    const double za    = pitzer.z_anions[a];
-    const double beta1 = pitzer.beta1[c][a](T);
-    const double beta2 = pitzer.beta2[c][a](T);
-
-    if(std::abs(zc) == 2 && std::abs(za) == 2)
-        return beta1 * g_prime(alpha1*sqrtI)/I + beta2 * g_prime(alpha2*sqrtI)/I;
-    else
-        return beta1 * g_prime(alpha*sqrtI)/I;
-}
-
-auto C(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> double
-{
-    const double T     = state.T.val;
-    const double Cphi = pitzer.Cphi[c][a](T);
-    const double zc   = pitzer.z_cations[c];
-    const double za   = pitzer.z_anions[a];
-    return 0.5 * Cphi/std::sqrt(std::abs(zc*za));
-}
+    /// The term F of the Harvie-Moller-Weare Pitzer's model
+    double F = 0.0;
 
-auto computeF(const AqueousMixtureState& state, const PitzerParams& pitzer) -> double
-{
-    // The indices of the cations and anions
-    const auto& idx_cations = pitzer.idx_cations;
-    const auto& idx_anions  = pitzer.idx_anions;
+    /// The term Z of the Harvie-Moller-Weare Pitzer's model
+    double Z = 0.0;
 
-    // The number of the cations and anions
-    const auto num_cations = idx_cations.size();
-    const auto num_anions  = idx_anions.size();
+    /// The values of B, B<sup>φ</sup> and B' for each salt pair
+    Vector B, B_phi, B_prime;
 
-    // THe temperature and pressure in units of K and Pa respectively
-    const auto& T = state.T;
-    const auto& P = state.P;
+    /// The values of Φ, Φ<sup>φ</sup> and Φ' for each pair of distinct cations
+    Vector Phi_cc, Phi_phi_cc, Phi_prime_cc;
 
-    // The molalities of all aqueous species
-    VectorConstRef m = state.m.val;
+    /// The values of Φ, Φ<sup>φ</sup> and Φ' for each pair of distinct anions
+    Vector Phi_aa, Phi_phi_aa, Phi_prime_aa;
 
-    // The ionic strength of the aqueous mixture and its square root
-    const double I = state.Ie.val;
-    const double sqrtI = std::sqrt(I);
+    /// The natural log of the activity coefficients of all species (the entry of water is not computed)
+    Vector ln_gamma;
 
-    // The Debye-Huckel coefficient Aphi
-    const double Aphi = pitzer.Aphi(T.val, P.val);
+    /// The partial derivatives of `ln_gamma` with respect to the molalities of all species
+    Matrix ln_gamma_dm;
 
-    // The b parameter of the Harvie-Moller-Weare Pitzer's model
-    const double b = 1.2;
+    /// The interaction terms in the osmotic coefficient (the sums over pairs and triplets of species)
+    double osmotic = 0.0;
 
-    // Calculate the term F of the Harvie-Moller-Weare Pitzer's model
-    double F = -Aphi * (sqrtI/(1 + b*sqrtI) + 2.0/b * std::log(1 + b*sqrtI));
-
-    // Iterate over all pairs of cations and anions
-    for(unsigned c = 0; c < num_cations; ++c) for(unsigned a = 0; a < num_anions; ++a)
-        F += m[idx_cations[c]] * m[idx_anions[a]] * B_prime(state, pitzer, c, a);
-
-    // Iterate over all pairs of distinct cations
-    for(unsigned i = 0; i < num_cations - 1; ++i) for(unsigned j = i + 1; j < num_cations; ++j)
-        F += m[idx_cations[i]] * m[idx_cations[j]] * Phi_prime_cc(state, pitzer, i, j);
-
-    // Iterate over all pairs of distinct anions
-    for(unsigned i = 0; i < num_anions - 1; ++i) for(unsigned j = i + 1; j < num_anions; ++j)
-        F += m[idx_anions[i]] * m[idx_anions[j]] * Phi_prime_aa(state, pitzer, i, j);
-
-    return F;
-}
-
-auto computeZ(const AqueousMixtureState& state, const PitzerParams& pitzer) -> double
-{
-    const Vector mi = rows(state.m.val, pitzer.idx_charged);
-    const Vector zi = pitzer.z_charged.array().abs();
-    return mi.dot(zi);
-}
+    /// The partial derivatives of `osmotic` with respect to the molalities of all species
+    Vector osmotic_dm;
+};
 
-/// Return the Pitzer activity coefficient of a cation (in natural log scale).
+/// Update the intermediate quantities of the Harvie-Moller-Weare Pitzer's model.
+/// @param ps The intermediate quantities to be updated
 /// @param state The state of the aqueous mixture
 /// @param pitzer The Pitzer parameters
-/// @param M The local index of the cation among all cations in the mixture
-auto lnActivityCoefficientCation(const AqueousMixtureState& state, const PitzerParams& pitzer, Index M) -> ChemicalScalar
+auto update(PitzerState& ps, const AqueousMixtureState& state, const PitzerParams& pitzer) -> void
 {
-    // The indices of the neutral species, cations and anions
+    // The indices of the neutral species, charged species, cations and anions
     const auto& idx_neutrals = pitzer.idx_neutrals;
+    const auto& idx_charged  = pitzer.idx_charged;
     const auto& idx_cations  = pitzer.idx_cations;
     const auto& idx_anions   = pitzer.idx_anions;
 
-    // The number of neutrals, cations and anions
-    const auto num_neutrals = idx_neutrals.size();
-    const auto num_cations  = idx_cations.size();
-    const auto num_anions   = idx_anions.size();
-
-    // The vector of molalities of all aqueous species
-    const ChemicalVector& m = state.m;
+    // The molalities of all aqueous species
+    VectorConstRef m = state.m.val;
 
     // The number of species in the mixture
-    const unsigned nspecies = m.val.size();
+    const Index nspecies = m.size();
 
-    // The electrical charge of the M-th cation
-    const double zM = pitzer.z_cations[M];
+    // The number of salt pairs and pairs of distinct cations and anions
+    const Index num_salts = pitzer.salts.size();
+    const Index num_cc = pitzer.theta_cc.size();
+    const Index num_aa = pitzer.theta_aa.size();
 
-    // The terms F and Z of the Harvie-Moller-Weare Pitzer's model
-    const double F = computeF(state, pitzer);
-    const double Z = computeZ(state, pitzer);
+    // The ionic strength of the aqueous mixture and its square root
+    const double I = state.Ie.val;
+    const double sqrtI = std::sqrt(I);
 
-    // The log of the activity coefficient of the M-th cation
-    ChemicalScalar ln_gammaM(nspecies);
+    // The Debye-Huckel coefficient Aphi
+    const double Aphi = pitzer.Aphi;
 
-    // Iterate over all anions
-    for(unsigned a = 0; a < num_anions; ++a)
-    {
-        const ChemicalScalar ma = m[idx_anions[a]];
-        const double BMa = B(state, pitzer, M, a);
-        const double CMa = C(state, pitzer, M, a);
+    // The b parameter of the Harvie-Moller-Weare Pitzer's model
+    const double b = 1.2;
 
-        ln_gammaM += ma * (2*BMa + Z*CMa);
-    }
+    // The functions of ionic strength shared by all salt pairs
+    const double g0 = g(alpha*sqrtI),  g1 = g(alpha1*sqrtI),  g2 = g(alpha2*sqrtI);
+    const double gp0 = g_prime(alpha*sqrtI), gp1 = g_prime(alpha1*sqrtI), gp2 = g_prime(alpha2*sqrtI);
+    const double e0 = std::exp(-alpha*sqrtI), e1 = std::exp(-alpha1*sqrtI), e2 = std::exp(-alpha2*sqrtI);
 
-    // Iterate over all cations
-    for(unsigned c = 0; c < num_cations; ++c)
+    // Calculate the parameters B, B^phi and B' of all salt pairs
+    ps.B.resize(num_salts);
+    ps.B_phi.resize(num_salts);
+    ps.B_prime.resize(num_salts);
+    for(Index p = 0; p < num_salts; ++p)
     {
-        const ChemicalScalar mc = m[idx_cations[c]];
-        const double PhiMc = Phi_cc(state, pitzer, M, c);
+        const double beta0 = pitzer.beta0[p];
+        const double beta1 = pitzer.beta1[p];
+        const double beta2 = pitzer.beta2[p];
 
-        ChemicalScalar aux(nspecies);
-        aux.val = 2*PhiMc;
-
-        // Iterate over all anions
-        for(unsigned a = 0; a < num_anions; ++a)
+        if(pitzer.salts[p].divalent)
         {
-            const ChemicalScalar ma = m[idx_anions[a]];
-            const double psiMca = pitzer.psi_cca[M][c][a];
-
-            aux += ma * psiMca;
+            ps.B[p]       = beta0 + beta1*g1 + beta2*g2;
+            ps.B_phi[p]   = beta0 + beta1*e1 + beta2*e2;
+            ps.B_prime[p] = beta1*gp1/I + beta2*gp2/I;
+        }
+        else
+        {
+            ps.B[p]       = beta0 + beta1*g0;
+            ps.B_phi[p]   = beta0 + beta1*e0;
+            ps.B_prime[p] = beta1*gp0/I;
         }
-
-        ln_gammaM += mc * aux;
-    }
-
-    // Iterate over all pairs of distinct anions
-    for(unsigned i = 0; i < num_anions - 1; ++i) for(unsigned j = i + 1; j < num_anions; ++j)
-    {
-        const ChemicalScalar mi = m[idx_anions[i]];
-        const ChemicalScalar mj = m[idx_anions[j]];
-        const double psi_ijM = pitzer.psi_aac[i][j][M];
-
-        ln_gammaM += mi * mj * psi_ijM;
     }
 
-    // Iterate over all pairs of cations and anions
-    for(unsigned c = 0; c < num_cations; ++c) for(unsigned a = 0; a < num_anions; ++a)
+    // Calculate the mixing terms of all pairs of distinct ions of same charge sign
+    auto mixing = [&](const std::vector<BinaryParam>& pairs, VectorConstRef z, Vector& Phi, Vector& Phi_phi, Vector& Phi_prime)
     {
-        const ChemicalScalar mc = m[idx_cations[c]];
-        const ChemicalScalar ma = m[idx_anions[a]];
-        const double Cca = C(state, pitzer, c, a);
-
-        ln_gammaM += std::abs(zM) * mc * ma * Cca;
-    }
-
-    // Iterate over all pairs of neutral species
-    for(unsigned n = 0; n < num_neutrals; ++n)
-        ln_gammaM += 2.0 * m[idx_neutrals[n]] * pitzer.lambda_nc[n][M];
-
-    // Finalize the calculation
-    ln_gammaM += zM*zM*F;
-
-    return ln_gammaM;
-}
+        const Index npairs = pairs.size();
+        Phi.resize(npairs);
+        Phi_phi.resize(npairs);
+        Phi_prime.resize(npairs);
+        for(Index k = 0; k < npairs; ++k)
+        {
+            const auto& pair = pairs[k];
+            const double E  = thetaE(state, pitzer, z[pair.i], z[pair.j]);
+            const double Ep = thetaE_prime(state, pitzer, z[pair.i], z[pair.j]);
+            Phi[k]       = pair.value + E;
+            Phi_phi[k]   = pair.value + E + I*Ep;
+            Phi_prime[k] = Ep;
+        }
+    };
 
-/// Return the Pitzer activity coefficient of an anion (in natural log scale).
-/// @param state The state of the aqueous mixture
-/// @param pitzer The Pitzer parameters
-/// @param X The local index of the anion among all anions in the mixture
-auto lnActivityCoefficientAnion(const AqueousMixtureState& state, const PitzerParams& pitzer, Index X) -> ChemicalScalar
-{
-    // The indices of the neutral species, cations and anions
-    const auto& idx_neutrals = pitzer.idx_neutrals;
-    const auto& idx_cations  = pitzer.idx_cations;
-    const auto& idx_anions   = pitzer.idx_anions;
+    mixing(pitzer.theta_cc, pitzer.z_cations, ps.Phi_cc, ps.Phi_phi_cc, ps.Phi_prime_cc);
+    mixing(pitzer.theta_aa, pitzer.z_anions, ps.Phi_aa, ps.Phi_phi_aa, ps.Phi_prime_aa);
 
-    // The number of neutrals, cations and anions
-    const auto num_neutrals = idx_neutrals.size();
-    const auto num_cations  = idx_cations.size();
-    const auto num_anions   = idx_anions.size();
+    // Calculate the term F of the Harvie-Moller-Weare Pitzer's model
+    ps.F = -Aphi * (sqrtI/(1 + b*sqrtI) + 2.0/b * std::log(1 + b*sqrtI));
 
-    // The molalities of all aqueous species
-    const ChemicalVector& m = state.m;
+    for(Index p = 0; p < num_salts; ++p)
+        ps.F += m[idx_cations[pitzer.salts[p].c]] * m[idx_anions[pitzer.salts[p].a]] * ps.B_prime[p];
 
-    // The number of species in the mixture
-    const unsigned nspecies = m.val.size();
+    for(Index k = 0; k < num_cc; ++k)
+        ps.F += m[idx_cations[pitzer.theta_cc[k].i]] * m[idx_cations[pitzer.theta_cc[k].j]] * ps.Phi_prime_cc[k];
 
-    // The electrical charge of the X-th anion
-    const double zX = pitzer.z_anions[X];
+    for(Index k = 0; k < num_aa; ++k)
+        ps.F += m[idx_anions[pitzer.theta_aa[k].i]] * m[idx_anions[pitzer.theta_aa[k].j]] * ps.Phi_prime_aa[k];
 
-    // The terms F and Z of the Harvie-Moller-Weare Pitzer's model
-    const double F = computeF(state, pitzer);
-    const double Z = computeZ(state, pitzer);
+    // Calculate the term Z of the Harvie-Moller-Weare Pitzer's model
+    ps.Z = rows(m, idx_charged).dot(pitzer.z_charged.cwiseAbs());
 
-    // The log of the activity coefficient of the X-th anion
-    ChemicalScalar ln_gammaX(nspecies);
+    // Initialize the activity coefficients, the osmotic terms and their molar derivatives
+    ps.ln_gamma.setZero(nspecies);
+    ps.ln_gamma_dm.setZero(nspecies, nspecies);
+    ps.osmotic = 0.0;
+    ps.osmotic_dm.setZero(nspecies);
 
-    // Iterate over all cations
-    for(unsigned c = 0; c < num_cations; ++c)
+    // Add the contribution of a binary term to the species i and j, whose ln activity
+    // coefficients are incremented by lncoeff*mj and lncoeff*mi, and to the osmotic terms,
+    // incremented by osmcoeff*mi*mj
+    auto binary = [&](Index i, Index j, double lncoeff, double osmcoeff)
     {
-        const ChemicalScalar mc = m[idx_cations[c]];
-        const double BcX = B(state, pitzer, c, X);
-        const double CcX = C(state, pitzer, c, X);
+        ps.ln_gamma[i] += lncoeff * m[j];
+        ps.ln_gamma[j] += lncoeff * m[i];
+        ps.ln_gamma_dm(i, j) += lncoeff;
+        ps.ln_gamma_dm(j, i) += lncoeff;
+        ps.osmotic += osmcoeff * m[i] * m[j];
+        ps.osmotic_dm[i] += osmcoeff * m[j];
+        ps.osmotic_dm[j] += osmcoeff * m[i];
+    };
 
-        ln_gammaX += mc * (2*BcX + Z*CcX);
-    }
+    // Add the contribution of a ternary term to the osmotic terms, incremented by value*mi*mj*mk
+    auto ternaryOsmotic = [&](Index i, Index j, Index k, double value)
+    {
+        ps.osmotic += value * m[i] * m[j] * m[k];
+        ps.osmotic_dm[i] += value * m[j] * m[k];
+        ps.osmotic_dm[j] += value * m[i] * m[k];
+        ps.osmotic_dm[k] += value * m[i] * m[j];
+    };
 
-    // Iterate over all anions
-    for(unsigned a = 0; a < num_anions; ++a)
+    // Add the contribution of a ternary term to the ln activity coefficient of species i, incremented by value*mj*mk
+    auto ternary = [&](Index i, Index j, Index k, double value)
     {
-        const ChemicalScalar ma = m[idx_anions[a]];
-        const double PhiXa = Phi_aa(state, pitzer, X, a);
+        ps.ln_gamma[i] += value * m[j] * m[k];
+        ps.ln_gamma_dm(i, j) += value * m[k];
+        ps.ln_gamma_dm(i, k) += value * m[j];
+    };
 
-        ChemicalScalar aux(nspecies);
-        aux.val = 2*PhiXa;
+    // The sum of mc*ma*C over all pairs of cations and anions and its molar derivatives
+    double sumC = 0.0;
+    Vector sumC_dm = zeros(nspecies);
 
-        // Iterate over all cations
-        for(unsigned c = 0; c < num_cations; ++c)
-        {
-            const ChemicalScalar mc = m[idx_cations[c]];
-            const double psiXac = pitzer.psi_aac[X][a][c];
+    // Iterate over all pairs of cations and anions
+    for(Index p = 0; p < num_salts; ++p)
+    {
+        const Index ic = idx_cations[pitzer.salts[p].c];
+        const Index ia = idx_anions[pitzer.salts[p].a];
+        const double Cca = pitzer.C[p];
 
-            aux += mc * psiXac;
-        }
+        binary(ic, ia, 2*ps.B[p] + ps.Z*Cca, ps.B_phi[p] + ps.Z*Cca);
 
-        ln_gammaX += ma * aux;
+        sumC += m[ic] * m[ia] * Cca;
+        sumC_dm[ic] += m[ia] * Cca;
+        sumC_dm[ia] += m[ic] * Cca;
     }
 
     // Iterate over all pairs of distinct cations
-    for(unsigned i = 0; i < num_cations - 1; ++i) for(unsigned j = i + 1; j < num_cations; ++j)
+    for(Index k = 0; k < num_cc; ++k)
     {
-        const ChemicalScalar mi = m[idx_cations[i]];
-        const ChemicalScalar mj = m[idx_cations[j]];
-        const double psi_ijX = pitzer.psi_cca[i][j][X];
+        const auto& pair = pitzer.theta_cc[k];
+        binary(idx_cations[pair.i], idx_cations[pair.j], 2*ps.Phi_cc[k], ps.Phi_phi_cc[k]);
+    }
 
-        ln_gammaX += mi * mj * psi_ijX;
+    // Iterate over all pairs of distinct anions
+    for(Index k = 0; k < num_aa; ++k)
+    {
+        const auto& pair = pitzer.theta_aa[k];
+        binary(idx_anions[pair.i], idx_anions[pair.j], 2*ps.Phi_aa[k], ps.Phi_phi_aa[k]);
     }
 
-    // Iterate over all pairs of cations and anions
-    for(unsigned c = 0; c < num_cations; ++c) for(unsigned a = 0; a < num_anions; ++a)
+    // Iterate over all triplets of two distinct cations and an anion
+    for(const auto& triplet : pitzer.psi_cca)
     {
-        const ChemicalScalar mc = m[idx_cations[c]];
-        const ChemicalScalar ma = m[idx_anions[a]];
-        const double Cca = C(state, pitzer, c, a);
+        const Index i = idx_cations[triplet.i];
+        const Index j = idx_cations[triplet.j];
+        const Index k = idx_anions[triplet.k];
+        ternary(i, j, k, triplet.value);
+        ternary(j, i, k, triplet.value);
+        ternary(k, i, j, triplet.value);
+        ternaryOsmotic(i, j, k, triplet.value);
+    }
 
-        ln_gammaX += std::abs(zX) * mc * ma * Cca;
+    // Iterate over all triplets of two distinct anions and a cation
+    for(const auto& triplet : pitzer.psi_aac)
+    {
+        const Index i = idx_anions[triplet.i];
+        const Index j = idx_anions[triplet.j];
+        const Index k = idx_cations[triplet.k];
+        ternary(i, j, k, triplet.value);
+        ternary(j, i, k, triplet.value);
+        ternary(k, i, j, triplet.value);
+        ternaryOsmotic(i, j, k, triplet.value);
     }
 
-    // Iterate over all pairs of neutral species
-    for(unsigned n = 0; n < num_neutrals; ++n)
-        ln_gammaX += 2.0 * m[idx_neutrals[n]] * pitzer.lambda_na[n][X];
+    // Iterate over all pairs of neutral species and cations
+    for(const auto& pair : pitzer.lambda_nc)
+        binary(idx_neutrals[pair.i], idx_cations[pair.j], 2*pair.value, pair.value);
 
-    // Finalize the calculation
-    ln_gammaX += zX*zX*F;
+    // Iterate over all pairs of neutral species and anions
+    for(const auto& pair : pitzer.lambda_na)
+        binary(idx_neutrals[pair.i], idx_anions[pair.j], 2*pair.value, pair.value);
 
-    return ln_gammaX;
+    // Iterate over all triplets of neutral species, cations and anions
+    for(const auto& triplet : pitzer.zeta)
+    {
+        const Index n = idx_neutrals[triplet.i];
+        const Index c = idx_cations[triplet.j];
+        const Index a = idx_anions[triplet.k];
+        ternary(n, c, a, triplet.value);
+        ternaryOsmotic(n, c, a, triplet.value);
+    }
+
+    // Finalize the calculation of the ln activity coefficients of the charged species
+    for(Index i = 0; i < idx_charged.size(); ++i)
+    {
+        const Index ispecies = idx_charged[i];
+        const double zi = pitzer.z_charged[i];
+        ps.ln_gamma[ispecies] += std::abs(zi)*sumC + zi*zi*ps.F;
+        ps.ln_gamma_dm.row(ispecies) += std::abs(zi)*tr(sumC_dm);
+    }
 }
 
 /// Return the Pitzer activity of water (in natural log scale).
 /// @param state The state of the aqueous mixture
 /// @param pitzer The Pitzer parameters
+/// @param ps The intermediate quantities of the Pitzer model
 /// @param iH2O The index of the water species
-auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitzer, Index iH2O) -> ChemicalScalar
+auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitzer, const PitzerState& ps, Index iH2O) -> ChemicalScalar
 {
-    // The indices of the neutral species, cations and anions
-    const auto& idx_neutrals = pitzer.idx_neutrals;
-    const auto& idx_cations  = pitzer.idx_cations;
-    const auto& idx_anions   = pitzer.idx_anions;
-
-    // The number of neutrals, cations and anions
-    const auto num_neutrals = idx_neutrals.size();
-    const auto num_cations  = idx_cations.size();
-    const auto num_anions   = idx_anions.size();
-
     // The vector of molalities of all aqueous species
     const ChemicalVector& m = state.m;
 
-    // The number of species in the mixture
-    const unsigned nspecies = m.val.size();
-
     // The ionic strength of the aqueous mixture
     const ChemicalScalar& I = state.Ie;
 
@@ -1245,87 +1254,16 @@ auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitze
     const double Mw = waterMolarMass;
 
     // The Debye-Huckel coefficient Aphi
-    const double Aphi = pitzer.Aphi(state.T.val, state.P.val);
+    const double Aphi = pitzer.Aphi;
 
     // The b parameter of the Harvie-Moller-Weare Pitzer's model
     const double b = 1.2;
 
-    // The term Z of the Harvie-Moller-Weare Pitzer's model
-    const double Z = computeZ(state, pitzer);
+    // The interaction terms of the osmotic coefficient and their partial derivatives
+    ChemicalScalar osmotic(ps.osmotic, ps.osmotic_dm.dot(m.ddT), ps.osmotic_dm.dot(m.ddP), tr(ps.osmotic_dm) * m.ddn);
 
     // The osmotic coefficient of the aqueous mixture
-    ChemicalScalar phi = -Aphi*I*sqrtI/(1 + b*sqrtI);
-
-    // Iterate over all pairs of cations and anions
-    for(unsigned c = 0; c < num_cations; ++c) for(unsigned a = 0; a < num_anions; ++a)
-    {
-        const ChemicalScalar mc = m[idx_cations[c]];
-        const ChemicalScalar ma = m[idx_anions[a]];
-        const double Bca = B_phi(state, pitzer, c, a);
-        const double Cca = C(state, pitzer, c, a);
-
-        phi += mc * ma * (Bca + Z*Cca);
-    }
-
-    // Iterate over all pairs of distinct cations
-    for(unsigned i = 0; i < num_cations - 1; ++i) for(unsigned j = i + 1; j < num_cations; ++j)
-    {
-        const ChemicalScalar mi = m[idx_cations[i]];
-        const ChemicalScalar mj = m[idx_cations[j]];
-        const double Phi_ij = Phi_phi_cc(state, pitzer, i, j);
-
-        ChemicalScalar aux(nspecies);
-        aux.val = Phi_ij;
-
-        // Iterate over all anions
-        for(unsigned a = 0; a < num_anions; ++a)
-        {
-            const ChemicalScalar ma = m[idx_anions[a]];
-            const double psi_ija = pitzer.psi_cca[i][j][a];
-
-            aux += ma * psi_ija;
-        }
-
-        phi += mi * mj * aux;
-    }
-
-    // Iterate over all pairs of distinct anions
-    for(unsigned i = 0; i < num_anions - 1; ++i) for(unsigned j = i + 1; j < num_anions; ++j)
-    {
-        const ChemicalScalar mi = m[idx_anions[i]];
-        const ChemicalScalar mj = m[idx_anions[j]];
-        const double Phi_ij = Phi_phi_aa(state, pitzer, i, j);
-
-        ChemicalScalar aux(nspecies);
-        aux.val = Phi_ij;
-
-        // Iterate over all cations
-        for(unsigned c = 0; c < num_cations; ++c)
-        {
-            const ChemicalScalar mc = m[idx_cations[c]];
-            const double psi_ija = pitzer.psi_aac[i][j][c];
-
-            aux += mc * psi_ija;
-        }
-
-        phi += mi * mj * aux;
-    }
-
-    // Iterate over all pairs of neutral species and cations
-    for(unsigned n = 0; n < num_neutrals; ++n)
-        for(unsigned c = 0; c < num_cations; ++c)
-            phi += m[idx_neutrals[n]] * m[idx_cations[c]] * pitzer.lambda_nc[n][c];
-
-    // Iterate over all pairs of neutral species and anions
-    for(unsigned n = 0; n < num_neutrals; ++n)
-        for(unsigned a = 0; a < num_anions; ++a)
-            phi += m[idx_neutrals[n]] * m[idx_anions[a]] * pitzer.lambda_na[n][a];
-
-    // Iterate over all triplets of neutral species, cations and anions
-    for(unsigned n = 0; n < num_neutrals; ++n)
-        for(unsigned c = 0; c < num_cations; ++c)
-            for(unsigned a = 0; a < num_anions; ++a)
-                phi += m[idx_neutrals[n]] * m[idx_cations[c]] * m[idx_anions[a]] * pitzer.zeta[n][c][a];
+    ChemicalScalar phi = -Aphi*I*sqrtI/(1 + b*sqrtI) + osmotic;
 
     // Calculate the sum of molalities of the solutes
     const ChemicalScalar sum_mi = sum(m) - m[iH2O];
@@ -1339,45 +1277,6 @@ auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitze
     return ln_aw;
 }
 
-/// Return the Pitzer activity coefficient of a neutral species (in natural log scale).
-/// @param state The state of the aqueous mixture
-/// @param pitzer The Pitzer parameters
-/// @param N The local index of the neutral species among all neutral species in the mixture
-auto lnActivityCoefficientNeutral(const AqueousMixtureState& state, const PitzerParams& pitzer, Index N) -> ChemicalScalar
-{
-    // The indices of the neutral species, cations and anions
-    const auto& idx_cations  = pitzer.idx_cations;
-    const auto& idx_anions   = pitzer.idx_anions;
-
-    // The number of neutrals, cations and anions
-    const auto num_cations  = idx_cations.size();
-    const auto num_anions   = idx_anions.size();
-
-    // The vector of molalities of all aqueous species
-    const ChemicalVector& m = state.m;
-
-    // The number of species in the mixture
-    const unsigned nspecies = m.val.size();
-
-    // The log of the activity coefficient of the N-th neutral species
-    ChemicalScalar ln_gammaN(nspecies);
-
-    // Iterate over all cations
-    for(unsigned c = 0; c < num_cations; ++c)
-        ln_gammaN += 2.0 * m[idx_cations[c]] * pitzer.lambda_nc[N][c];
-
-    // Iterate over all anions
-    for(unsigned a = 0; a < num_anions; ++a)
-        ln_gammaN += 2.0 * m[idx_anions[a]] * pitzer.lambda_na[N][a];
-
-    // Iterate over all pairs of cations and anions
-    for(unsigned c = 0; c < num_cations; ++c)
-        for(unsigned a = 0; a < num_anions; ++a)
-            ln_gammaN += m[idx_cations[c]] * m[idx_anions[a]] * pitzer.zeta[N][c][a];
-
-    return ln_gammaN;
-}
-
 } // namespace Pitzer
 
 auto aqueousChemicalModelPitzerHMW(const AqueousMixture& mixture) -> PhaseChemicalModel
@@ -1394,43 +1293,32 @@ auto aqueousChemicalModelPitzerHMW(const AqueousMixture& mixture) -> PhaseChemic
     // The state of the aqueous mixture
     AqueousMixtureState state;
 
+    // The intermediate quantities of the Pitzer model
+    PitzerState pstate;
+
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the aqueous mixture
         state = mixture.state(T, P, n);
 
-        // Calculate the activity coefficients of the cations
-        for(unsigned M = 0; M < pitzer.idx_cations.size(); ++M)
-        {
-            // Get the global index of the cation in the mixture
-            const Index i = pitzer.idx_cations[M];
+        // Evaluate the temperature and pressure dependent Pitzer parameters
+        pitzer.update(T.val, P.val);
 
-            // Set the activity coefficient of the i-th species
-            res.ln_activity_coefficients[i] = lnActivityCoefficientCation(state, pitzer, M);
-        }
+        // Evaluate the intermediate quantities shared by all species
+        update(pstate, state, pitzer);
 
-        // Calculate the activity coefficients of the anions
-        for(unsigned X = 0; X < pitzer.idx_anions.size(); ++X)
-        {
-            // Get the global index of the anion in the mixture
-            const Index i = pitzer.idx_anions[X];
+        // The molalities of all aqueous species
+        const ChemicalVector& m = state.m;
 
-            // Set the activity coefficient of the i-th species
-            res.ln_activity_coefficients[i] = lnActivityCoefficientAnion(state, pitzer, X);
-        }
-
-        // Calculate the activity coefficients of the neutral species
-        for(unsigned N = 0; N < pitzer.idx_neutrals.size(); ++N)
-        {
-            // Get the global index of the neutral species in the mixture
-            const Index i = pitzer.idx_neutrals[N];
-
-            // Set the activity coefficient of the i-th species
-            res.ln_activity_coefficients[i] = lnActivityCoefficientNeutral(state, pitzer, N);
-        }
+        // Set the activity coefficients of all species and their partial derivatives
+        auto& ln_g = res.ln_activity_coefficients;
+        ln_g.val = pstate.ln_gamma;
+        ln_g.ddT.noalias() = pstate.ln_gamma_dm * m.ddT;
+        ln_g.ddP.noalias() = pstate.ln_gamma_dm * m.ddP;
+        ln_g.ddn.noalias() = pstate.ln_gamma_dm * m.ddn;
 
         // Calculate the activity of water
-        const ChemicalScalar ln_aw = lnActivityWater(state, pitzer, iwater);
+        const ChemicalScalar ln_aw = lnActivityWater(state, pitzer, pstate, iwater);
 
         // The mole fraction of water
         const auto xw = state.x[iwater];
@@ -17,27 +17,29 @@
 
 #include "ChemicalModel.hpp"
 
+// C++ includes
+#include <numeric>
+
 namespace Reaktoro {
 
 ChemicalModelResult::ChemicalModelResult()
 {}
 
 ChemicalModelResult::ChemicalModelResult(Index nphases, Index nspecies)
-: ln_activity_coefficients(nspecies),
-  ln_activities(nspecies),
-  partial_molar_volumes(nspecies),
-  phase_molar_volumes(nphases, nspecies),
-  phase_residual_molar_gibbs_energies(nphases, nspecies),
-  phase_residual_molar_enthalpies(nphases, nspecies),
-  phase_residual_molar_heat_capacities_cp(nphases, nspecies),
-  phase_residual_molar_heat_capacities_cv(nphases, nspecies)
-{}
+{
+    resize(nphases, nspecies);
+}
+
+ChemicalModelResult::ChemicalModelResult(const Indices& nspecies)
+{
+    resize(nspecies);
+}
 
 auto ChemicalModelResult::resize(Index nphases, Index nspecies) -> void
 {
-    ln_activity_coefficients.resize(nspecies);
-    ln_activities.resize(nspecies);
-    partial_molar_volumes.resize(nspecies);
+    ln_activity_coefficients.resize({nspecies});
+    ln_activities.resize({nspecies});
+    partial_molar_volumes.resize({nspecies});
     phase_molar_volumes.resize(nphases, nspecies);
     phase_residual_molar_gibbs_energies.resize(nphases, nspecies);
     phase_residual_molar_enthalpies.resize(nphases, nspecies);
@@ -45,12 +47,26 @@ auto ChemicalModelResult::resize(Index nphases, Index nspecies) -> void
     phase_residual_molar_heat_capacities_cv.resize(nphases, nspecies);
 }
 
+auto ChemicalModelResult::resize(const Indices& nspecies) -> void
+{
+    const Index nphases = nspecies.size();
+    const Index size = std::accumulate(nspecies.begin(), nspecies.end(), Index(0));
+    ln_activity_coefficients.resize(nspecies);
+    ln_activities.resize(nspecies);
+    partial_molar_volumes.resize(nspecies);
+    phase_molar_volumes.resize(nphases, size);
+    phase_residual_molar_gibbs_energies.resize(nphases, size);
+    phase_residual_molar_enthalpies.resize(nphases, size);
+    phase_residual_molar_heat_capacities_cp.resize(nphases, size);
+    phase_residual_molar_heat_capacities_cv.resize(nphases, size);
+}
+
 auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index nspecies) -> PhaseChemicalModelResult
 {
     return {
-        rows(ln_activity_coefficients, ispecies, ispecies, nspecies, nspecies),
-        rows(ln_activities, ispecies, ispecies, nspecies, nspecies),
-        rows(partial_molar_volumes, ispecies, ispecies, nspecies, nspecies),
+        ln_activity_coefficients.block(ispecies, nspecies),
+        ln_activities.block(ispecies, nspecies),
+        partial_molar_volumes.block(ispecies, nspecies),
         row(phase_molar_volumes, iphase, ispecies, nspecies),
         row(phase_residual_molar_gibbs_energies, iphase, ispecies, nspecies),
         row(phase_residual_molar_enthalpies, iphase, ispecies, nspecies),
@@ -62,9 +78,9 @@ auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index ns
 auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index nspecies) const -> PhaseChemicalModelResultConst
 {
     return {
-        rows(ln_activity_coefficients, ispecies, nspecies),
-        rows(ln_activities, ispecies, nspecies),
-        rows(partial_molar_volumes, ispecies, nspecies),
+        ln_activity_coefficients.block(ispecies, nspecies),
+        ln_activities.block(ispecies, nspecies),
+        partial_molar_volumes.block(ispecies, nspecies),
         row(phase_molar_volumes, iphase, ispecies, nspecies),
         row(phase_residual_molar_gibbs_energies, iphase, ispecies, nspecies),
         row(phase_residual_molar_enthalpies, iphase, ispecies, nspecies),
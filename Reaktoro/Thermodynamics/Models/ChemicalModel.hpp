@@ -21,6 +21,7 @@
 #include <functional>
 
 // Reaktoro includes
+#include <Reaktoro/Common/BlockDiagonalChemicalVector.hpp>
 #include <Reaktoro/Thermodynamics/Models/PhaseChemicalModel.hpp>
 
 namespace Reaktoro {
@@ -33,15 +34,25 @@ public:
     ChemicalModelResult();
 
     /// Construct a ChemicalModelResultBase instance with allocated memory
+    /// The molar derivatives of the species properties are stored in a single dense block.
     /// @param nphases The number of phases in the chemical system.
     /// @param nspecies The number of species in the chemical system.
     ChemicalModelResult(Index nphases, Index nspecies);
 
+    /// Construct a ChemicalModelResultBase instance with allocated memory
+    /// The molar derivatives of the species properties are stored in one block per phase.
+    /// @param nspecies The number of species in each phase of the chemical system.
+    explicit ChemicalModelResult(const Indices& nspecies);
+
     /// Resize this ChemicalModelResultBase with a given number of species.
     /// @param nphases The number of phases in the chemical system.
     /// @param nspecies The number of species in the chemical system.
     auto resize(Index nphases, Index nspecies) -> void;
 
+    /// Resize this ChemicalModelResultBase with a given number of species in each phase.
+    /// @param nspecies The number of species in each phase of the chemical system.
+    auto resize(const Indices& nspecies) -> void;
+
     /// Return a view of the chemical properties of a phase.
     /// @param iphase The index of the phase.
     /// @param ispecies The index of the first species in the phase.
@@ -55,22 +66,22 @@ public:
     auto phaseProperties(Index iphase, Index ispecies, Index nspecies) const -> PhaseChemicalModelResultConst;
 
     /// Return the natural log of the activity coefficients of the species.
-    inline auto lnActivityCoefficients() -> ChemicalVectorRef { return ln_activity_coefficients; }
+    inline auto lnActivityCoefficients() -> BlockDiagonalChemicalVector& { return ln_activity_coefficients; }
 
     /// Return the natural log of the activity coefficients of the species.
-    inline auto lnActivityCoefficients() const -> ChemicalVectorConstRef { return ln_activity_coefficients; }
+    inline auto lnActivityCoefficients() const -> const BlockDiagonalChemicalVector& { return ln_activity_coefficients; }
 
     /// Return the natural log of the activities of the species.
-    inline auto lnActivities() -> ChemicalVectorRef { return ln_activities; }
+    inline auto lnActivities() -> BlockDiagonalChemicalVector& { return ln_activities; }
 
     /// Return the natural log of the activities of the species.
-    inline auto lnActivities() const -> ChemicalVectorConstRef { return ln_activities; }
+    inline auto lnActivities() const -> const BlockDiagonalChemicalVector& { return ln_activities; }
 
     /// Return the partial molar volume of species each phase (in units of m3/mol).
-    inline auto partialMolarVolumes() -> ChemicalVectorRef { return partial_molar_volumes; }
+    inline auto partialMolarVolumes() -> BlockDiagonalChemicalVector& { return partial_molar_volumes; }
 
     /// Return the partial molar volume of species each phase (in units of m3/mol).
-    inline auto partialMolarVolumes() const -> ChemicalVectorConstRef { return partial_molar_volumes; }
+    inline auto partialMolarVolumes() const -> const BlockDiagonalChemicalVector& { return partial_molar_volumes; }
 
     /// Return the molar volumes of the phases (in units of m3/mol).
     inline auto phaseMolarVolumes() -> ChemicalVectorRef { return phase_molar_volumes; }
@@ -104,13 +115,13 @@ public:
 
 private:
     /// The natural log of the activity coefficients of the species.
-    ChemicalVector ln_activity_coefficients;
+    BlockDiagonalChemicalVector ln_activity_coefficients;
 
     /// The natural log of the activities of the species.
-    ChemicalVector ln_activities;
+    BlockDiagonalChemicalVector ln_activities;
 
     /// The partial molar volume of specie each phase (in units of m3/mol).
-    ChemicalVector partial_molar_volumes;
+    BlockDiagonalChemicalVector partial_molar_volumes;
 
     /// The molar volumes of the phases (in units of m3/mol).
     ChemicalVector phase_molar_volumes;
@@ -62,6 +62,9 @@ auto fluidChemicalModelCubicEOS(
     // The state of the gaseous mixture
     FluidMixtureState state;
 
+    // The result of the CubicEOS evaluation, reused across evaluations
+    CubicEOS::Result eosres(nspecies);
+
     // Define the chemical model function of the gaseous phase
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
@@ -72,7 +75,7 @@ auto fluidChemicalModelCubicEOS(
         const auto& x = state.x;
 
         // Evaluate the CubicEOS
-        const CubicEOS::Result eosres = eos(T, P, x);
+        eos(eosres, T, P, x);
 
         // The ln of mole fractions
         const ChemicalVector ln_x = log(x);
@@ -253,7 +253,7 @@ auto fluidChemicalModelSpycherReed(const FluidMixture& mixture) -> PhaseChemical
         const auto ln_Pbar = log(Pbar);
 
         // The ln of mole fractions of the species
-        const auto ln_x = log(x);
+        const ChemicalVector ln_x = log(x);
 
         // The mole fractions of the gaseous species H2O(g), CO2(g) and CH4(g)
         ChemicalScalar y[3];
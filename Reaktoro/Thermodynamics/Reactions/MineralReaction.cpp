@@ -54,7 +54,7 @@ auto mineralCatalystFunctionActivity(const MineralCatalyst& catalyst, const Chem
 
     MineralCatalystFunction fn = [=](const ChemicalProperties& properties) mutable
     {
-        const ChemicalVector& ln_a = properties.lnActivities();
+        const auto& ln_a = properties.lnActivities();
         ChemicalScalar ai = exp(ln_a[ispecies]);
         ChemicalScalar res = pow(ai, power);
         return res;
@@ -522,6 +522,13 @@ auto createReaction(const MineralReaction& mineralrxn, const ChemicalSystem& sys
     // Set the rate of the reaction
     reaction.setRate(rate);
 
+    // Set the mineral and the catalysts as the species whose amounts affect the rate besides the reacting species
+    Indices rate_species = {imineral};
+    for(const MineralMechanism& mechanism : mineralrxn.mechanisms())
+        for(const MineralCatalyst& catalyst : mechanism.catalysts)
+            rate_species.push_back(system.indexSpeciesWithError(catalyst.species));
+    reaction.setRateSpecies(rate_species);
+
     return reaction;
 }
 
@@ -17,4 +17,5 @@
 
 #pragma once
 
+#include <Reaktoro/Transport/GridTransportSolver.hpp>
 #include <Reaktoro/Transport/TransportSolver.hpp>
@@ -0,0 +1,206 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "GridTransportSolver.hpp"
+
+// C++ includes
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+Grid::Grid()
+{}
+
+Grid::Grid(Index nx, Index ny, Index nz, double lx, double ly, double lz)
+{
+    setDiscretization(nx, ny, nz, lx, ly, lz);
+}
+
+auto Grid::setDiscretization(Index nx, Index ny, Index nz, double lx, double ly, double lz) -> void
+{
+    Assert(nx > 0 && ny > 0 && nz > 0, "Could not set the discretization.",
+        "The number of cells along each axis needs to be positive.");
+
+    Assert(lx > 0.0 && ly > 0.0 && lz > 0.0, "Could not set the discretization.",
+        "The length of the domain along each axis needs to be positive.");
+
+    m_nx = nx;
+    m_ny = ny;
+    m_nz = nz;
+    m_dx = lx / nx;
+    m_dy = ly / ny;
+    m_dz = lz / nz;
+}
+
+GridTransportSolver::GridTransportSolver()
+: ub(zeros(1))
+{}
+
+auto GridTransportSolver::setGrid(const Grid& grid) -> void
+{
+    m_grid = grid;
+    outdated = true;
+}
+
+auto GridTransportSolver::setVelocity(double vx, double vy, double vz) -> void
+{
+    this->vx = vx;
+    this->vy = vy;
+    this->vz = vz;
+    outdated = true;
+}
+
+auto GridTransportSolver::setDiffusionCoeff(double val) -> void
+{
+    diffusion = val;
+    outdated = true;
+}
+
+auto GridTransportSolver::setBoundaryValue(double val) -> void
+{
+    ub = constants(1, val);
+}
+
+auto GridTransportSolver::setBoundaryValues(VectorConstRef vals) -> void
+{
+    ub = vals;
+}
+
+auto GridTransportSolver::setTimeStep(double val) -> void
+{
+    outdated = outdated || val != dt;
+    dt = val;
+}
+
+auto GridTransportSolver::initialize() -> void
+{
+    const Index nx = m_grid.numCellsX();
+    const Index ny = m_grid.numCellsY();
+    const Index nz = m_grid.numCellsZ();
+    const Index num_cells = m_grid.numCells();
+
+    // The velocities, spacings, and cell strides along each axis
+    const double v[3] = { vx, vy, vz };
+    const double h[3] = { m_grid.dx(), m_grid.dy(), m_grid.dz() };
+    const Index n[3] = { nx, ny, nz };
+    const Index stride[3] = { 1, nx, nx*ny };
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(num_cells * 7);
+
+    g = zeros(num_cells);
+
+    for(Index k = 0; k < nz; ++k)
+    for(Index j = 0; j < ny; ++j)
+    for(Index i = 0; i < nx; ++i)
+    {
+        const Index icell = m_grid.index(i, j, k);
+        const Index pos[3] = { i, j, k };
+
+        double diagonal = 1.0;
+
+        for(Index axis = 0; axis < 3; ++axis)
+        {
+            const double a = dt * std::abs(v[axis]) / h[axis]; // the upwind advection coefficient
+            const double d = dt * diffusion / (h[axis] * h[axis]); // the diffusion coefficient
+
+            const bool haswest = pos[axis] > 0;
+            const bool haseast = pos[axis] + 1 < n[axis];
+
+            // The upstream neighbour along this axis depends on the sign of the velocity component
+            const bool hasupstream = v[axis] > 0.0 ? haswest : haseast;
+            const Index iupstream = v[axis] > 0.0 ? icell - stride[axis] : icell + stride[axis];
+
+            // Advection with upwind values, with zero gradient on the boundary faces other than x = 0
+            if(hasupstream)
+            {
+                diagonal += a;
+                triplets.emplace_back(icell, iupstream, -a);
+            }
+            else if(axis == 0 && v[axis] > 0.0)
+            {
+                diagonal += a;
+                g[icell] += a;
+            }
+
+            // Diffusion with central differences, with the boundary value prescribed half a cell away on the face x = 0
+            if(haswest)
+            {
+                diagonal += d;
+                triplets.emplace_back(icell, icell - stride[axis], -d);
+            }
+            else if(axis == 0)
+            {
+                diagonal += 2*d;
+                g[icell] += 2*d;
+            }
+
+            if(haseast)
+            {
+                diagonal += d;
+                triplets.emplace_back(icell, icell + stride[axis], -d);
+            }
+        }
+
+        triplets.emplace_back(icell, icell, diagonal);
+    }
+
+    // Assemble the coefficient matrix A and compute its preconditioner for future uses in method step
+    A.resize(num_cells, num_cells);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    bicgstab.compute(A);
+
+    Assert(bicgstab.info() == Eigen::Success, "Could not initialize the transport solver.",
+        "The preconditioning of the coefficient matrix failed.");
+
+    outdated = false;
+}
+
+auto GridTransportSolver::step(MatrixRef u, MatrixConstRef q) -> void
+{
+    Assert(u.rows() == static_cast<int>(m_grid.numCells()), "Could not step the transport solver.",
+        "The number of rows of the solution matrix does not match the number of cells in the grid.");
+
+    Assert(ub.size() == 1 || ub.size() == u.cols(), "Could not step the transport solver.",
+        "The number of boundary values does not match the number of components.");
+
+    if(outdated)
+        initialize();
+
+    // Assemble the right-hand side with the previous values, the sources, and the boundary values
+    rhs.noalias() = u + dt * q;
+    if(ub.size() == 1)
+        rhs.colwise() += g * ub[0];
+    else
+        rhs.noalias() += g * tr(ub);
+
+    // Solve the transport problem for all components, using their previous values as initial guess
+    u = bicgstab.solveWithGuess(rhs, u);
+
+    Assert(bicgstab.info() == Eigen::Success, "Could not step the transport solver.",
+        "The iterative solution of the linear systems did not converge.");
+}
+
+auto GridTransportSolver::step(MatrixRef u) -> void
+{
+    step(u, zeros(u.rows(), u.cols()));
+}
+
+} // namespace Reaktoro
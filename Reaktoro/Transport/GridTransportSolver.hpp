@@ -0,0 +1,176 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/IterativeLinearSolvers>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
+
+namespace Reaktoro {
+
+/// A class that defines a uniform structured grid in one, two, or three dimensions.
+/// The cells are numbered with the x-index varying fastest, so that the cell with
+/// indices `(i, j, k)` has the global index `i + nx*(j + ny*k)`.
+class Grid
+{
+public:
+    /// Construct a default Grid instance.
+    Grid();
+
+    /// Construct a Grid instance.
+    /// @param nx The number of cells along the x-axis
+    /// @param ny The number of cells along the y-axis
+    /// @param nz The number of cells along the z-axis
+    /// @param lx The length of the domain along the x-axis (in m)
+    /// @param ly The length of the domain along the y-axis (in m)
+    /// @param lz The length of the domain along the z-axis (in m)
+    Grid(Index nx, Index ny = 1, Index nz = 1, double lx = 1.0, double ly = 1.0, double lz = 1.0);
+
+    /// Set the discretization of the grid.
+    /// @see Grid(Index, Index, Index, double, double, double)
+    auto setDiscretization(Index nx, Index ny = 1, Index nz = 1, double lx = 1.0, double ly = 1.0, double lz = 1.0) -> void;
+
+    /// Return the total number of cells in the grid.
+    auto numCells() const -> Index { return m_nx * m_ny * m_nz; }
+
+    /// Return the number of cells along the x-axis.
+    auto numCellsX() const -> Index { return m_nx; }
+
+    /// Return the number of cells along the y-axis.
+    auto numCellsY() const -> Index { return m_ny; }
+
+    /// Return the number of cells along the z-axis.
+    auto numCellsZ() const -> Index { return m_nz; }
+
+    /// Return the length of the cells along the x-axis (in m).
+    auto dx() const -> double { return m_dx; }
+
+    /// Return the length of the cells along the y-axis (in m).
+    auto dy() const -> double { return m_dy; }
+
+    /// Return the length of the cells along the z-axis (in m).
+    auto dz() const -> double { return m_dz; }
+
+    /// Return the global index of the cell with given indices along the x, y, and z axes.
+    auto index(Index i, Index j = 0, Index k = 0) const -> Index { return i + m_nx * (j + m_ny * k); }
+
+private:
+    /// The number of cells along the x, y, and z axes.
+    Index m_nx = 10, m_ny = 1, m_nz = 1;
+
+    /// The lengths of the cells along the x, y, and z axes (in m).
+    double m_dx = 0.1, m_dy = 1.0, m_dz = 1.0;
+};
+
+/// A class for solving advection-diffusion problems on structured grids.
+/// Eq: du/dt + v.grad(u) = D*div(grad(u)) + q
+///     u - amount
+///     v - velocity vector
+///     D - diffusion coefficient
+/// The advection and diffusion terms are discretized with first-order upwind and central
+/// finite volumes, and integrated in time with the implicit Euler method, which has no
+/// restriction on the time step. The resulting sparse matrix is assembled and preconditioned
+/// only when the grid, the coefficients, or the time step change. The linear systems of all
+/// components (e.g., the amounts of every element) are solved in one call with the BiCGSTAB
+/// method, using the values of the previous step as initial guess.
+/// The value of u is prescribed on the boundary face at x = 0, and the other boundary faces
+/// have zero gradient of u, as in the one-dimensional TransportSolver.
+class GridTransportSolver
+{
+public:
+    /// Construct a default GridTransportSolver instance.
+    GridTransportSolver();
+
+    /// Set the grid for the numerical solution of the transport problem.
+    auto setGrid(const Grid& grid) -> void;
+
+    /// Set the velocity vector for the transport problem.
+    /// @param vx The velocity along the x-axis (in m/s)
+    /// @param vy The velocity along the y-axis (in m/s)
+    /// @param vz The velocity along the z-axis (in m/s)
+    auto setVelocity(double vx, double vy = 0.0, double vz = 0.0) -> void;
+
+    /// Set the diffusion coefficient for the transport problem.
+    /// @param val The diffusion coefficient (in m^2/s)
+    auto setDiffusionCoeff(double val) -> void;
+
+    /// Set the value of every component on the boundary face at x = 0.
+    auto setBoundaryValue(double val) -> void;
+
+    /// Set the values of each component on the boundary face at x = 0.
+    auto setBoundaryValues(VectorConstRef vals) -> void;
+
+    /// Set the time step for the numerical solution of the transport problem.
+    auto setTimeStep(double val) -> void;
+
+    /// Return the time step for the numerical solution of the transport problem.
+    auto timeStep() const -> double { return dt; }
+
+    /// Return the grid.
+    auto grid() const -> const Grid& { return m_grid; }
+
+    /// Assemble and precondition the coefficient matrix of the transport problem.
+    /// This method is called by @ref step whenever the grid, the coefficients, or the time step change.
+    auto initialize() -> void;
+
+    /// Step the transport solver.
+    /// @param[in,out] u The solution matrix, with one row per cell and one column per component
+    /// @param q The source rates matrix, with same dimension as u ([same unit considered for u]/s)
+    auto step(MatrixRef u, MatrixConstRef q) -> void;
+
+    /// Step the transport solver.
+    /// @param[in,out] u The solution matrix, with one row per cell and one column per component
+    auto step(MatrixRef u) -> void;
+
+private:
+    /// The grid describing the discretization of the domain.
+    Grid m_grid;
+
+    /// The time step used to solve the transport problem (in s).
+    double dt = 0.0;
+
+    /// The velocity vector in the transport problem (in m/s).
+    double vx = 0.0, vy = 0.0, vz = 0.0;
+
+    /// The diffusion coefficient in the transport problem (in m^2/s).
+    double diffusion = 0.0;
+
+    /// The values of the components on the boundary face at x = 0.
+    Vector ub;
+
+    /// The coefficients of the boundary values in the discretized equation of each cell.
+    Vector g;
+
+    /// The coefficient matrix from the discretized transport equation.
+    SparseMatrix A;
+
+    /// The iterative solver of the linear systems, with a diagonal preconditioner (the coefficient matrix is diagonally dominant).
+    Eigen::BiCGSTAB<SparseMatrix> bicgstab;
+
+    /// The right-hand side matrix of the discretized transport equation.
+    Matrix rhs;
+
+    /// The flag that indicates if the coefficient matrix needs to be assembled and preconditioned again.
+    bool outdated = true;
+};
+
+} // namespace Reaktoro
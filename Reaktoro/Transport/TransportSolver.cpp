@@ -333,24 +333,38 @@ auto TransportSolver::step(VectorRef u) -> void
 }
 
 ReactiveTransportSolver::ReactiveTransportSolver(const ChemicalSystem& system)
-: system_(system), equilibriumsolver(system)
+: system_(system), state(system), equilibriumsolver(system), partition(system)
 {
     setBoundaryState(ChemicalState(system));
 }
 
+ReactiveTransportSolver::ReactiveTransportSolver(const ReactionSystem& reactions)
+: ReactiveTransportSolver(reactions.system())
+{
+    this->reactions = reactions;
+}
+
 auto ReactiveTransportSolver::setMesh(const Mesh& mesh) -> void
 {
     transportsolver.setMesh(mesh);
 }
 
-auto ReactiveTransportSolver::setVelocity(double val) -> void
+auto ReactiveTransportSolver::setGrid(const Grid& grid) -> void
+{
+    gridsolver.setGrid(grid);
+    usegrid = true;
+}
+
+auto ReactiveTransportSolver::setVelocity(double vx, double vy, double vz) -> void
 {
-    transportsolver.setVelocity(val);
+    transportsolver.setVelocity(vx);
+    gridsolver.setVelocity(vx, vy, vz);
 }
 
 auto ReactiveTransportSolver::setDiffusionCoeff(double val) -> void
 {
     transportsolver.setDiffusionCoeff(val);
+    gridsolver.setDiffusionCoeff(val);
 }
 
 auto ReactiveTransportSolver::setBoundaryState(const ChemicalState& state) -> void
@@ -361,6 +375,18 @@ auto ReactiveTransportSolver::setBoundaryState(const ChemicalState& state) -> vo
 auto ReactiveTransportSolver::setTimeStep(double val) -> void
 {
     transportsolver.setTimeStep(val);
+    gridsolver.setTimeStep(val);
+}
+
+auto ReactiveTransportSolver::setPartition(const Partition& partition) -> void
+{
+    this->partition = partition;
+    equilibriumsolver.setPartition(partition);
+}
+
+auto ReactiveTransportSolver::setKineticOptions(const KineticOptions& options) -> void
+{
+    kineticoptions = options;
 }
 
 auto ReactiveTransportSolver::output() -> ChemicalOutput
@@ -371,62 +397,236 @@ auto ReactiveTransportSolver::output() -> ChemicalOutput
 
 auto ReactiveTransportSolver::initialize(const ChemicalField& field) -> void
 {
-    const Mesh& mesh = transportsolver.mesh();
+    initialize(usegrid ? gridsolver.grid().numCells() : transportsolver.mesh().numCells());
+}
+
+auto ReactiveTransportSolver::initialize(const ChemicalStateBatch& batch) -> void
+{
+    initialize(usegrid ? gridsolver.grid().numCells() : transportsolver.mesh().numCells());
+}
+
+auto ReactiveTransportSolver::initialize(Index num_cells) -> void
+{
     const Index num_elements = system_.numElements();
-    const Index num_cells = mesh.numCells();
 
     bf.resize(num_cells, num_elements);
     bs.resize(num_cells, num_elements);
     b.resize(num_cells, num_elements);
 
-    transportsolver.initialize();
+    // Zero temperatures of the last equilibrium calculations force every cell to be equilibrated in the first step
+    blast = zeros(num_cells, num_elements);
+    Tlast = zeros(num_cells);
+    Plast = zeros(num_cells);
+    isskipped.assign(num_cells, false);
+
+    // Initialize the solvers for the chemical kinetics of the cells, if there are kinetically-controlled reactions
+    if(reactions.numReactions())
+    {
+        kineticfield = KineticField(reactions, num_cells);
+        kineticfield.setOptions(kineticoptions);
+        kineticfield.setPartition(partition);
+    }
+
+    t = 0.0;
+
+    if(usegrid)
+        gridsolver.initialize();
+    else
+        transportsolver.initialize();
 }
 
 auto ReactiveTransportSolver::step(ChemicalField& field) -> void
 {
-    const auto& mesh = transportsolver.mesh();
-    const auto& num_elements = system_.numElements();
-    const auto& num_cells = mesh.numCells();
-    const auto& ifs = system_.indicesFluidSpecies();
-    const auto& iss = system_.indicesSolidSpecies();
+    const auto num_cells = usegrid ? gridsolver.grid().numCells() : transportsolver.mesh().numCells();
+    const auto dt = transportsolver.timeStep();
+
+    // Check if the chemical kinetics of the cells is integrated along with the transport (Strang splitting)
+    const bool kinetics = reactions.numReactions();
 
-    // Collect the amounts of elements in the solid and fluid species
+    // The species whose elements are transported (the kinetic species are assumed immobile)
+    const auto& ifs = kinetics ? partition.indicesEquilibriumFluidSpecies() : system_.indicesFluidSpecies();
+    const auto& iss = kinetics ? partition.indicesEquilibriumSolidSpecies() : system_.indicesSolidSpecies();
+
+    // Integrate the chemical kinetics of every cell over the first half of the time step
+    if(kinetics)
+        kineticfield.solve(field, t, 0.5*dt);
+
+    // Collect the amounts of elements in the solid and fluid species (skipped cells keep their transported amounts so that small changes accumulate)
     for(Index icell = 0; icell < num_cells; ++icell)
     {
+        if(isskipped[icell])
+            continue;
         bf.row(icell) = field[icell].elementAmountsInSpecies(ifs);
         bs.row(icell) = field[icell].elementAmountsInSpecies(iss);
     }
 
-    // Transport the elements in the fluid species
-    for(Index ielement = 0; ielement < num_elements; ++ielement)
+    transport();
+
+    openOutputs();
+
+    skipped = 0;
+
+    for(Index icell = 0; icell < num_cells; ++icell)
     {
-        transportsolver.setBoundaryValue(bbc[ielement]);
-        transportsolver.step(bf.col(ielement));
+        // Check if the cell is chemically unchanged since its last equilibrium calculation
+        isskipped[icell] = unchanged(icell, field[icell].temperature(), field[icell].pressure());
+
+        if(isskipped[icell])
+            ++skipped;
+        else
+            equilibrate(icell, field[icell]);
     }
 
-    // Sum the amounts of elements distributed among fluid and solid species
-    b.noalias() = bf + bs;
+    // Integrate the chemical kinetics of every cell over the second half of the time step
+    if(kinetics)
+        kineticfield.solve(field, t + 0.5*dt, 0.5*dt);
 
     for(auto output : outputs)
     {
-        output.suffix("-" + std::to_string(steps));
-        output.open();
+        for(Index icell = 0; icell < num_cells; ++icell)
+            output.update(field[icell], icell);
+        output.close();
     }
 
-    for(Index icell = 0; icell < num_cells; ++icell)
+    t += dt;
+    ++steps;
+}
+
+auto ReactiveTransportSolver::step(ChemicalStateBatch& batch) -> void
+{
+    const auto num_cells = usegrid ? gridsolver.grid().numCells() : transportsolver.mesh().numCells();
+    const auto dt = transportsolver.timeStep();
+
+    Assert(batch.size() == num_cells,
+        "Cannot proceed with ReactiveTransportSolver::step.",
+        "The size of the batch of chemical states does not match the number of cells.");
+
+    // Check if the chemical kinetics of the cells is integrated along with the transport (Strang splitting)
+    const bool kinetics = reactions.numReactions();
+
+    // The species whose elements are transported (the kinetic species are assumed immobile)
+    const auto& ifs = kinetics ? partition.indicesEquilibriumFluidSpecies() : system_.indicesFluidSpecies();
+    const auto& iss = kinetics ? partition.indicesEquilibriumSolidSpecies() : system_.indicesSolidSpecies();
+
+    // Integrate the chemical kinetics of every cell over the first half of the time step
+    if(kinetics)
+        kineticfield.solve(batch, t, 0.5*dt);
+
+    // Collect the amounts of elements in the solid and fluid species of all cells with one matrix product each
+    if(skipped == 0)
+    {
+        bf.noalias() = tr(batch.elementAmountsInSpecies(ifs));
+        bs.noalias() = tr(batch.elementAmountsInSpecies(iss));
+    }
+    else
     {
-        const double T = field[icell].temperature();
-        const double P = field[icell].pressure();
-        equilibriumsolver.solve(field[icell], T, P, b.row(icell));
+        // Skipped cells keep their transported amounts so that small changes accumulate
+        const Matrix bfnew = tr(batch.elementAmountsInSpecies(ifs));
+        const Matrix bsnew = tr(batch.elementAmountsInSpecies(iss));
+        for(Index icell = 0; icell < num_cells; ++icell)
+        {
+            if(isskipped[icell])
+                continue;
+            bf.row(icell) = bfnew.row(icell);
+            bs.row(icell) = bsnew.row(icell);
+        }
+    }
 
-        for(auto output : outputs)
-            output.update(field[icell], icell);
+    transport();
+
+    openOutputs();
+
+    skipped = 0;
+
+    for(Index icell = 0; icell < num_cells; ++icell)
+    {
+        // Check if the cell is chemically unchanged since its last equilibrium calculation
+        isskipped[icell] = unchanged(icell, batch.temperatures()[icell], batch.pressures()[icell]);
+
+        if(isskipped[icell])
+            ++skipped;
+        else
+        {
+            batch.get(icell, state);
+            equilibrate(icell, state);
+            batch.set(icell, state);
+        }
     }
 
+    // Integrate the chemical kinetics of every cell over the second half of the time step
+    if(kinetics)
+        kineticfield.solve(batch, t + 0.5*dt, 0.5*dt);
+
     for(auto output : outputs)
+    {
+        for(Index icell = 0; icell < num_cells; ++icell)
+        {
+            batch.get(icell, state);
+            output.update(state, icell);
+        }
         output.close();
+    }
 
+    t += dt;
     ++steps;
 }
 
+auto ReactiveTransportSolver::transport() -> void
+{
+    const auto& num_elements = system_.numElements();
+
+    // Transport the elements in the fluid species (all at once on a structured grid)
+    if(usegrid)
+    {
+        gridsolver.setBoundaryValues(bbc);
+        gridsolver.step(bf);
+    }
+    else
+    {
+        for(Index ielement = 0; ielement < num_elements; ++ielement)
+        {
+            transportsolver.setBoundaryValue(bbc[ielement]);
+            transportsolver.step(bf.col(ielement));
+        }
+    }
+
+    // Sum the amounts of elements distributed among fluid and solid species
+    b.noalias() = bf + bs;
+}
+
+auto ReactiveTransportSolver::openOutputs() -> void
+{
+    for(auto output : outputs)
+    {
+        output.suffix("-" + std::to_string(steps));
+        output.open();
+    }
+}
+
+auto ReactiveTransportSolver::unchanged(Index icell, double T, double P) const -> bool
+{
+    // The detection is disabled with kinetically-controlled reactions or a negative tolerance
+    if(reactions.numReactions() || skiptol < 0.0)
+        return false;
+
+    if(std::abs(T - Tlast[icell]) > skiptol * Tlast[icell] || std::abs(P - Plast[icell]) > skiptol * Plast[icell])
+        return false;
+
+    // Compare each element amount with its own amount at the last equilibrium calculation, so that trace elements are not dominated by major ones
+    return ((b.row(icell) - blast.row(icell)).array().abs() <= skiptol * blast.row(icell).array().abs() + skipabstol).all();
+}
+
+auto ReactiveTransportSolver::equilibrate(Index icell, ChemicalState& state) -> void
+{
+    const double T = state.temperature();
+    const double P = state.pressure();
+    const auto& iee = partition.indicesEquilibriumElements();
+
+    be = b.row(icell)(iee);
+    equilibriumsolver.solve(state, T, P, be);
+    blast.row(icell) = b.row(icell);
+    Tlast[icell] = T;
+    Plast[icell] = P;
+}
+
 } // namespace Reaktoro
@@ -27,9 +27,15 @@
 #include <Reaktoro/Core/ChemicalOutput.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateBatch.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Kinetics/KineticField.hpp>
+#include <Reaktoro/Kinetics/KineticOptions.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
+#include <Reaktoro/Transport/GridTransportSolver.hpp>
 
 namespace Reaktoro {
 
@@ -232,6 +238,9 @@ public:
     /// Set the time step for the numerical solution of the transport problem.
     auto setTimeStep(double val) -> void { dt = val; }
 
+    /// Return the time step for the numerical solution of the transport problem.
+    auto timeStep() const -> double { return dt; }
+
     /// Return the mesh.
     auto mesh() const -> const Mesh& { return mesh_; }
 
@@ -284,9 +293,25 @@ public:
     /// Construct a default ReactiveTransportSolver instance.
     ReactiveTransportSolver(const ChemicalSystem& system);
 
+    /// Construct a ReactiveTransportSolver instance with kinetically-controlled reactions.
+    /// Each step is then split into a half step of chemical kinetics, a full step of transport
+    /// followed by the equilibration of the equilibrium species, and another half step of chemical
+    /// kinetics (Strang splitting). The chemical kinetics of every cell is integrated with its own
+    /// KineticSolver, whose adaptive internal time steps are independent of the other cells.
+    /// The kinetic species are assumed immobile, so that only the elements in the fluid species
+    /// of the equilibrium partition are transported.
+    /// @param reactions The kinetically-controlled reactions common to all cells
+    ReactiveTransportSolver(const ReactionSystem& reactions);
+
     auto setMesh(const Mesh& mesh) -> void;
 
-    auto setVelocity(double val) -> void;
+    /// Set a structured grid in one, two, or three dimensions to be used instead of the mesh.
+    /// The elements are then transported with a GridTransportSolver instance.
+    auto setGrid(const Grid& grid) -> void;
+
+    /// Set the velocity for the transport problem.
+    /// The components along the y and z axes are used only with a structured grid.
+    auto setVelocity(double vx, double vy = 0.0, double vz = 0.0) -> void;
 
     auto setDiffusionCoeff(double val) -> void;
 
@@ -294,24 +319,93 @@ public:
 
     auto setTimeStep(double val) -> void;
 
+    /// Set the partition of the chemical system into equilibrium, kinetic, and inert species.
+    auto setPartition(const Partition& partition) -> void;
+
+    /// Set the options for the chemical kinetics calculations in the cells.
+    auto setKineticOptions(const KineticOptions& options) -> void;
+
+    /// Set the tolerances used to detect chemically unchanged cells.
+    /// A cell keeps its previous chemical state in a step if its temperature and pressure changed by less than
+    /// the relative tolerance `reltol`, and every element amount `b[i]` satisfies `|b[i] - blast[i]| <= reltol*|blast[i]| + abstol`,
+    /// where `blast[i]` is the amount of the element at the last equilibrium calculation of the cell.
+    /// A negative relative tolerance (the default) disables the detection, so every cell is equilibrated.
+    /// The detection is not used with kinetically-controlled reactions.
+    /// @param reltol The relative tolerance on temperature, pressure, and the amount of each element
+    /// @param abstol The absolute tolerance on the amount of each element (in units of mol)
+    auto setSkipTolerance(double reltol, double abstol = 1e-14) -> void { skiptol = reltol; skipabstol = abstol; }
+
     auto system() const -> const ChemicalSystem& { return system_; }
 
+    /// Return the number of cells whose equilibrium calculation was skipped in the last step.
+    auto numSkippedCells() const -> Index { return skipped; }
+
     auto output() -> ChemicalOutput;
 
     auto initialize(const ChemicalField& field) -> void;
 
+    /// Initialize the solver for a batch of chemical states stored in contiguous arrays.
+    auto initialize(const ChemicalStateBatch& batch) -> void;
+
     auto step(ChemicalField& field) -> void;
 
+    /// Perform a step on a batch of chemical states stored in contiguous arrays.
+    /// The amounts of the elements in the fluid and solid species of all cells are
+    /// then collected with a single matrix product instead of a loop over the cells.
+    auto step(ChemicalStateBatch& batch) -> void;
+
 private:
+    /// Initialize the solver for a given number of cells.
+    auto initialize(Index num_cells) -> void;
+
+    /// Transport the amounts of the elements in the fluid species and update the total amounts of the elements.
+    auto transport() -> void;
+
+    /// Open the chemical output objects for the current step.
+    auto openOutputs() -> void;
+
+    /// Return true if a cell is chemically unchanged since its last equilibrium calculation.
+    auto unchanged(Index icell, double T, double P) const -> bool;
+
+    /// Equilibrate a cell with its transported amounts of elements.
+    auto equilibrate(Index icell, ChemicalState& state) -> void;
+
     /// The chemical system common to all degrees of freedom in the chemical field.
     ChemicalSystem system_;
 
+    /// The chemical state of a cell copied out of a batch of chemical states.
+    ChemicalState state;
+
     /// The solver for solving the transport equations
     TransportSolver transportsolver;
 
+    /// The solver for solving the transport equations on a structured grid
+    GridTransportSolver gridsolver;
+
+    /// The flag that indicates if the structured grid is used instead of the mesh
+    bool usegrid = false;
+
     /// The solver for solving the equilibrium equations
     EquilibriumSolver equilibriumsolver;
 
+    /// The kinetically-controlled reactions common to all cells (empty if chemical equilibrium is assumed)
+    ReactionSystem reactions;
+
+    /// The partition of the chemical system into equilibrium, kinetic, and inert species.
+    Partition partition;
+
+    /// The options for the chemical kinetics calculations in the cells.
+    KineticOptions kineticoptions;
+
+    /// The solvers for the chemical kinetics of the cells.
+    KineticField kineticfield;
+
+    /// The amounts of the elements in the equilibrium partition of a cell.
+    Vector be;
+
+    /// The current time in the solution of the reactive transport equations (in units of s).
+    double t = 0.0;
+
     /// The list of chemical output objects
     std::vector<ChemicalOutput> outputs;
 
@@ -329,6 +423,24 @@ private:
 
     /// The current number of steps in the solution of the reactive transport equations.
     Index steps = 0;
+
+    /// The relative tolerance used to detect chemically unchanged cells (negative if disabled).
+    double skiptol = -1.0;
+
+    /// The absolute tolerance on the amounts of elements used to detect chemically unchanged cells.
+    double skipabstol = 1e-14;
+
+    /// The amounts of the elements on each cell of the mesh at their last equilibrium calculation.
+    Matrix blast;
+
+    /// The temperatures and pressures on each cell of the mesh at their last equilibrium calculation.
+    Vector Tlast, Plast;
+
+    /// The flags indicating which cells had their equilibrium calculation skipped in the last step.
+    std::vector<bool> isskipped;
+
+    /// The number of cells whose equilibrium calculation was skipped in the last step.
+    Index skipped = 0;
 };
 
 } // namespace Reaktoro
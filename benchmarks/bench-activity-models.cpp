@@ -0,0 +1,69 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// The aqueous species of the representative brine
+const std::vector<std::string> species = {"H2O(l)", "H+", "OH-", "Na+", "Cl-", "K+", "Ca++", "Mg++", "Sr++",
+    "Br-", "SO4--", "HSO4-", "HCO3-", "CO3--", "CO2(aq)", "MgOH+", "B(OH)3(aq)", "NaCl(aq)"};
+
+// The amounts of the aqueous species (in units of mol) in the representative brine (about 3 molal NaCl)
+const std::vector<double> amounts = {55.3, 1.0e-8, 1.0e-6, 3.0, 3.1, 0.05, 0.1, 0.15, 1.0e-3,
+    5.0e-3, 0.05, 1.0e-9, 2.0e-3, 1.0e-4, 1.0e-3, 1.0e-5, 4.0e-4, 0.1};
+
+// The number of evaluations of each activity model
+const unsigned num_evaluations = 20000;
+
+// Return the average time (in microseconds) of an evaluation of the activity model of an aqueous phase.
+auto timeit(const std::function<void(AqueousPhase&)>& setmodel) -> double
+{
+    Database database("supcrt98.xml");
+
+    ChemicalEditor editor(database);
+    setmodel(editor.addAqueousPhase(species));
+
+    ChemicalSystem system(editor);
+
+    const Phase& aqueous = system.phase(0);
+    const Index nspecies = aqueous.numSpecies();
+
+    Vector n = Vector::Map(amounts.data(), amounts.size());
+
+    ChemicalModelResult res(1, nspecies);
+    PhaseChemicalModelResult resphase = res.phaseProperties(0, 0, nspecies);
+
+    const double T = 333.15;
+    const double P = 1.0e7;
+
+    Time begin = time();
+    for(unsigned k = 0; k < num_evaluations; ++k)
+    {
+        n[3] *= 1.0 + 1e-12*k;
+        aqueous.properties(resphase, T, P, n);
+    }
+    return elapsed(begin)/num_evaluations * 1e6;
+}
+
+int main()
+{
+    std::cout << "Aqueous activity models (" << species.size() << " species, " << num_evaluations << " evaluations)" << std::endl;
+    std::cout << "  Ideal:        " << timeit([](AqueousPhase& phase) { phase.setChemicalModelIdeal(); }) << " us/evaluation" << std::endl;
+    std::cout << "  Debye-Huckel: " << timeit([](AqueousPhase& phase) { phase.setChemicalModelDebyeHuckel(); }) << " us/evaluation" << std::endl;
+    std::cout << "  HKF:          " << timeit([](AqueousPhase& phase) { phase.setChemicalModelHKF(); }) << " us/evaluation" << std::endl;
+    std::cout << "  Pitzer HMW:   " << timeit([](AqueousPhase& phase) { phase.setChemicalModelPitzerHMW(); }) << " us/evaluation" << std::endl;
+}
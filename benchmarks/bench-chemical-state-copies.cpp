@@ -0,0 +1,70 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// The number of repetitions of each operation
+const unsigned num_repetitions = 10000;
+
+int main()
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCO3 MgCO3 CO2");
+    editor.addGaseousPhase({"H2O(g)", "CO2(g)"});
+    editor.addMineralPhase("Calcite");
+
+    ChemicalSystem system(editor);
+
+    EquilibriumProblem problem(system);
+    problem.add("H2O", 1.0, "kg");
+    problem.add("NaCl", 0.5, "mol");
+    problem.add("CaCO3", 10.0, "g");
+    problem.add("CO2", 1.0, "mol");
+
+    const ChemicalState state = equilibrate(problem);
+
+    // Copy the chemical state without modifying the copies
+    std::vector<ChemicalState> copies;
+    copies.reserve(num_repetitions);
+    Time begin = time();
+    for(unsigned k = 0; k < num_repetitions; ++k)
+        copies.push_back(state);
+    const double copy_time = elapsed(begin);
+
+    // Copy the chemical state and modify the amount of a species in the copy
+    begin = time();
+    for(unsigned k = 0; k < num_repetitions; ++k)
+    {
+        ChemicalState copy = state;
+        copy.setSpeciesAmount(0, 55.0 + 1e-6*k);
+    }
+    const double copy_modify_time = elapsed(begin);
+
+    // Query the chemical properties of an unmodified state repeatedly
+    double sum = 0.0;
+    begin = time();
+    for(unsigned k = 0; k < num_repetitions; ++k)
+        sum += state.properties().volume().val;
+    const double properties_time = elapsed(begin);
+
+    std::cout << "Chemical state with " << system.numSpecies() << " species (" << num_repetitions << " repetitions)" << std::endl;
+    std::cout << "  Copy:                " << copy_time/num_repetitions * 1e6 << " us/copy" << std::endl;
+    std::cout << "  Copy and modify:     " << copy_modify_time/num_repetitions * 1e6 << " us/copy" << std::endl;
+    std::cout << "  Properties query:    " << properties_time/num_repetitions * 1e6 << " us/query" << std::endl;
+    std::cout << "  (volume sum " << sum << " m3)" << std::endl;
+}
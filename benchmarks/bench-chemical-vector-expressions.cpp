@@ -0,0 +1,88 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// The number of species used for the molar derivatives
+const Index num_species = 40;
+
+// The number of evaluations of each expression
+const unsigned num_evaluations = 20000;
+
+// Return the average time (in microseconds) of an evaluation of a function.
+template<typename Function>
+auto timeit(Function f) -> double
+{
+    Time begin = time();
+    for(unsigned k = 0; k < num_evaluations; ++k)
+        f(k);
+    return elapsed(begin)/num_evaluations * 1e6;
+}
+
+// Return a chemical vector with random values and derivatives.
+auto randomChemicalVector(Index nrows) -> ChemicalVector
+{
+    ChemicalVector res(nrows, num_species);
+    res.val = 1.0 + 0.5*Vector::Random(nrows).array();
+    res.ddT = Vector::Random(nrows);
+    res.ddP = Vector::Random(nrows);
+    res.ddn = Matrix::Random(nrows, num_species);
+    return res;
+}
+
+int main()
+{
+    const ChemicalVector m = randomChemicalVector(num_species);
+    const ChemicalVector x = randomChemicalVector(num_species);
+    const ChemicalVector y = randomChemicalVector(num_species);
+    const ChemicalScalar I = sum(m);
+    const ThermoScalar A(0.51, 1e-3, 1e-9);
+    const Vector z2 = Vector::Random(num_species).array().square();
+
+    ChemicalVector res(num_species, num_species);
+    ChemicalScalar ress(num_species);
+
+    std::cout << "Chemical vector expressions (" << num_species << " species, " << num_evaluations << " evaluations)" << std::endl;
+
+    std::cout << "  A*z2*sqrtI*sigma/3.0 + alpha: " << timeit([&](unsigned k) {
+        const ChemicalScalar sqrtI = sqrt(I);
+        res = A*(z2 % (sqrtI*x))/3.0 + y;
+    }) << " us/evaluation" << std::endl;
+
+    std::cout << "  ln_g + log(m):                " << timeit([&](unsigned k) {
+        res = x + log(m);
+    }) << " us/evaluation" << std::endl;
+
+    std::cout << "  x/sum(x):                     " << timeit([&](unsigned k) {
+        res = x/sum(x);
+    }) << " us/evaluation" << std::endl;
+
+    std::cout << "  x/y % m:                      " << timeit([&](unsigned k) {
+        res = x/y % m;
+    }) << " us/evaluation" << std::endl;
+
+    std::cout << "  sqrt(x) + abs(y) - 1.0:       " << timeit([&](unsigned k) {
+        res = sqrt(x) + abs(y) - ThermoScalar(1.0);
+    }) << " us/evaluation" << std::endl;
+
+    std::cout << "  (I + 1.0)*(I - 2.0)/I:        " << timeit([&](unsigned k) {
+        ress = (I + 1.0)*(I - 2.0)/I;
+    }) << " us/evaluation" << std::endl;
+
+    std::cout << "  (check " << res.val.sum() + res.ddn.sum() + ress.val + ress.ddn.sum() << ")" << std::endl;
+}
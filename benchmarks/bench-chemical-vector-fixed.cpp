@@ -0,0 +1,71 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// The number of species of the small chemical system
+const int num_species = 12;
+
+// The number of evaluations of each variant
+const unsigned num_evaluations = 1000000;
+
+// Evaluate the ln activities of the species of a small aqueous solution with an extended Debye-Huckel equation.
+template<typename ChemicalVectorType, typename ChemicalScalarType, typename VectorType>
+auto lnActivities(const ChemicalVectorType& m, const VectorType& z2, const VectorType& a, ThermoScalar A, ThermoScalar B, ChemicalVectorType& ln_a) -> void
+{
+    const ChemicalScalarType I = 0.5 * sum(z2 % m);
+    const ChemicalScalarType sqrtI = sqrt(I);
+    ln_a = log(m);
+    for(Index i = 0; i < m.size(); ++i)
+        ln_a[i] += -A*z2[i]*sqrtI/(1.0 + B*a[i]*sqrtI) + 0.1*I;
+}
+
+// Return the average time (in microseconds) of an evaluation of the ln activities with given chemical vector and scalar types.
+template<typename ChemicalVectorType, typename ChemicalScalarType, typename VectorType>
+auto timeit(double& check) -> double
+{
+    ChemicalVectorType m(num_species);
+    m.val = 0.1 + 0.05*VectorType::Random(num_species).array();
+    m.ddn = 0.01*Matrix::Random(num_species, num_species);
+    const VectorType z2 = VectorType::Random(num_species).array().abs().round();
+    const VectorType a = 4.0 + VectorType::Random(num_species).array();
+    const ThermoScalar A(0.5114, 8.6e-4, 0.0);
+    const ThermoScalar B(0.3288, 1.6e-4, 0.0);
+
+    ChemicalVectorType ln_a(num_species);
+
+    Time begin = time();
+    for(unsigned k = 0; k < num_evaluations; ++k)
+    {
+        m.val[0] *= 1.0 + 1e-12*k;
+        lnActivities<ChemicalVectorType, ChemicalScalarType>(m, z2, a, A, B, ln_a);
+    }
+    const double t = elapsed(begin)/num_evaluations * 1e6;
+    check += ln_a.val.sum() + ln_a.ddn.sum();
+    return t;
+}
+
+int main()
+{
+    double check = 0.0;
+    std::cout << "Extended Debye-Huckel ln activities (" << num_species << " species, " << num_evaluations << " evaluations)" << std::endl;
+    std::cout << "  ChemicalVector:                 " << timeit<ChemicalVector, ChemicalScalar, Vector>(check) << " us/evaluation" << std::endl;
+    std::cout << "  ChemicalVectorFixed<12>:        " << timeit<ChemicalVectorFixed<num_species>, ChemicalScalarFixed<num_species>, VectorFixed<num_species>>(check) << " us/evaluation" << std::endl;
+    std::cout << "  ChemicalVectorFixed<Dynamic,16>: " << timeit<ChemicalVectorFixed<Eigen::Dynamic, 16>, ChemicalScalarFixed<Eigen::Dynamic, 16>, VectorFixed<Eigen::Dynamic, 16>>(check) << " us/evaluation" << std::endl;
+    std::cout << "  (check " << check << ")" << std::endl;
+}
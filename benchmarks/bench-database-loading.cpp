@@ -0,0 +1,49 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// The built-in databases whose loading times are compared
+const std::vector<std::string> databases = {"supcrt98.xml", "supcrt07.xml"};
+
+// The number of times each database is loaded
+const unsigned num_loads = 20;
+
+// Return the average time (in milliseconds) of loading a database with a given name.
+auto timeit(const std::string& name) -> double
+{
+    Time begin = time();
+    for(unsigned k = 0; k < num_loads; ++k)
+        Database database(name);
+    return elapsed(begin)/num_loads * 1e3;
+}
+
+int main()
+{
+    std::cout << "Database loading (" << num_loads << " loads)" << std::endl;
+    for(const std::string& name : databases)
+    {
+        // Compile the xml database into a binary database once
+        const std::string binary = name.substr(0, name.find('.')) + ".rdb";
+        Database(name).save(binary);
+
+        std::cout << "  " << name << std::endl;
+        std::cout << "    xml:    " << timeit(name) << " ms/load" << std::endl;
+        std::cout << "    binary: " << timeit(binary) << " ms/load" << std::endl;
+    }
+}
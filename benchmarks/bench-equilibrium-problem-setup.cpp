@@ -0,0 +1,49 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// The number of equilibrium problems that are set up
+const unsigned num_problems = 10000;
+
+int main()
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCO3 MgCO3 CO2");
+    editor.addGaseousPhase({"H2O(g)", "CO2(g)"});
+    editor.addMineralPhase("Calcite");
+
+    ChemicalSystem system(editor);
+
+    Time begin = time();
+    for(unsigned k = 0; k < num_problems; ++k)
+    {
+        EquilibriumProblem problem(system);
+        problem.setTemperature(60.0, "celsius");
+        problem.setPressure(100.0, "bar");
+        problem.add("H2O", 1.0, "kg");
+        problem.add("NaCl", 0.5, "mol");
+        problem.add("CaCO3", 10.0, "g");
+        problem.add("MgCO3", 2.0, "mmol");
+        problem.add("CO2", 1.0, "mol");
+    }
+    const double elapsed_time = elapsed(begin);
+
+    std::cout << "Equilibrium problem setup (" << num_problems << " problems)" << std::endl;
+    std::cout << "  " << elapsed_time/num_problems * 1e6 << " us/problem" << std::endl;
+}
@@ -0,0 +1,118 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <iomanip>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// This string defines a PHREEQC script problem with the seawater
+// composition of the official PHREEQC example named ex1.
+const std::string seawater = R"(
+SOLUTION 1  SEAWATER FROM NORDSTROM AND OTHERS (1979)
+        units   ppm
+        pH      8.22
+        density 1.023
+        temp    25.0
+        Ca              412.3
+        Mg              1291.8
+        Na              10768.0
+        K               399.1
+        Sr              8.14
+        Cl              19353.0
+        Br              67.3
+        Alkalinity      141.682 as HCO3
+        S(6)            2712.0
+        B               4.45
+END
+)";
+
+// This benchmark uses only the public interface of Reaktoro, so it also builds against
+// previous versions of the library. Run it against two builds to compare the timings
+// of their native Pitzer models. The ln activity coefficients are printed in full
+// precision, so the outputs of the two builds can also be diffed.
+
+// The number of evaluations of each activity model
+const unsigned num_evaluations = 10000;
+
+// Return the average time (in microseconds) of an evaluation of a function.
+template<typename Function>
+auto timeit(Function f) -> double
+{
+    Time begin = time();
+    for(unsigned k = 0; k < num_evaluations; ++k)
+        f(k);
+    return elapsed(begin)/num_evaluations * 1e6;
+}
+
+int main()
+{
+    // The temperature and pressure of the benchmark (in units of K and Pa)
+    const double T = 298.15;
+    const double P = 1.0e5;
+
+    //=============================================================================================
+    // The reference: the Pitzer model of PHREEQC with the pitzer.dat database
+    //=============================================================================================
+    Phreeqc phreeqc("databases/phreeqc/pitzer.dat");
+    phreeqc.execute(seawater);
+
+    Vector nphreeqc = phreeqc.speciesAmounts();
+    ChemicalModelResult resphreeqc(phreeqc.numPhases(), phreeqc.numSpecies());
+
+    const double tphreeqc = timeit([&](unsigned k)
+    {
+        nphreeqc[0] *= 1.0 + 1e-12*k;
+        phreeqc.properties(resphreeqc, T, P, nphreeqc);
+    });
+
+    //=============================================================================================
+    // The native Harvie-Moller-Weare Pitzer model applied to the same seawater system
+    //=============================================================================================
+    Database database("supcrt98.xml");
+
+    ChemicalEditor editor(database);
+    editor.addAqueousPhase({"H2O(l)", "H+", "OH-", "Na+", "Cl-", "K+", "Ca++", "Mg++", "Sr++",
+        "Br-", "SO4--", "HSO4-", "HCO3-", "CO3--", "CO2(aq)", "MgOH+", "B(OH)3(aq)", "NaCl(aq)"})
+        .setChemicalModelPitzerHMW();
+
+    ChemicalSystem system(editor);
+
+    const Phase& aqueous = system.phase(0);
+    const Index nspecies = aqueous.numSpecies();
+
+    // The amounts of the aqueous species (in units of mol) in 1 kg of seawater
+    Vector n(nspecies);
+    n << 55.3, 6.3e-9, 1.3e-6, 0.4685, 0.5459, 0.0102, 0.0103, 0.0532, 9.3e-5,
+        8.4e-4, 0.0282, 1.0e-9, 1.8e-3, 2.7e-4, 1.2e-5, 1.1e-6, 4.1e-4, 1.0e-3;
+
+    ChemicalModelResult resnative(1, nspecies);
+    PhaseChemicalModelResult resphase = resnative.phaseProperties(0, 0, nspecies);
+
+    const double tnative = timeit([&](unsigned k)
+    {
+        n[0] *= 1.0 + 1e-12*k;
+        aqueous.properties(resphase, T, P, n);
+    });
+
+    std::cout << "Pitzer activity model (seawater, " << num_evaluations << " evaluations)" << std::endl;
+    std::cout << "  Native HMW model (" << nspecies << " species): " << tnative << " us/evaluation" << std::endl;
+    std::cout << "  PHREEQC pitzer.dat (" << phreeqc.numSpecies() << " species): " << tphreeqc << " us/evaluation" << std::endl;
+    std::cout << "  ln activity coefficients (native): " << std::setprecision(17) << tr(resnative.lnActivityCoefficients().val) << std::endl;
+}
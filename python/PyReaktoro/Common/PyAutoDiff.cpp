@@ -18,6 +18,7 @@
 #include <PyReaktoro/PyReaktoro.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/BlockDiagonalChemicalVector.hpp>
 #include <Reaktoro/Common/ChemicalScalar.hpp>
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/ThermoScalar.hpp>
@@ -104,6 +105,24 @@ void exportChemicalVector(py::module& m)
         ;
 }
 
+void exportBlockDiagonalChemicalVector(py::module& m)
+{
+    auto ddn = [](const BlockDiagonalChemicalVector& self) { return self.ddn.dense(); };
+
+    py::class_<BlockDiagonalChemicalVector>(m, "BlockDiagonalChemicalVector")
+        .def(py::init<>())
+        .def(py::init<const Indices&>())
+        .def_readwrite("val", &BlockDiagonalChemicalVector::val)
+        .def_readwrite("ddT", &BlockDiagonalChemicalVector::ddT)
+        .def_readwrite("ddP", &BlockDiagonalChemicalVector::ddP)
+        .def_property_readonly("ddn", ddn)
+        .def("size", &BlockDiagonalChemicalVector::size)
+        .def("dense", &BlockDiagonalChemicalVector::dense)
+        ;
+
+    py::implicitly_convertible<BlockDiagonalChemicalVector, ChemicalVector>();
+}
+
 void exportTemperature(py::module& m)
 {
     py::class_<Temperature, ThermoScalar>(m, "Temperature")
@@ -130,6 +149,7 @@ void exportAutoDiff(py::module& m)
     exportThermoVector(m);
     exportChemicalScalar(m);
     exportChemicalVector(m);
+    exportBlockDiagonalChemicalVector(m);
     exportTemperature(m);
     exportPressure(m);
 }
@@ -24,8 +24,19 @@ namespace Reaktoro {
 
 void exportUnits(py::module& m)
 {
+    py::class_<units::Converter>(m, "Converter")
+        .def(py::init<>())
+        .def(py::init<double, double, double>())
+        .def(py::init<const std::string&, const std::string&>())
+        .def("__call__", &units::Converter::operator())
+        .def("factor", &units::Converter::factor)
+        .def("divisor", &units::Converter::divisor)
+        .def("offset", &units::Converter::offset)
+        ;
+
     m.def("convert", units::convert);
     m.def("convertible", units::convertible);
+    m.def("converter", units::converter);
 }
 
 } // namespace Reaktoro
@@ -42,7 +42,7 @@ void exportChemicalProperties(py::module& m)
         .def("composition", &ChemicalProperties::composition)
         .def("thermoModelResult", &ChemicalProperties::thermoModelResult, py::return_value_policy::reference_internal)
         .def("chemicalModelResult", &ChemicalProperties::chemicalModelResult, py::return_value_policy::reference_internal)
-        .def("moleFractions", &ChemicalProperties::moleFractions)
+        .def("moleFractions", &ChemicalProperties::moleFractions, py::return_value_policy::reference_internal)
         .def("lnActivityCoefficients", &ChemicalProperties::lnActivityCoefficients, py::return_value_policy::reference_internal)
         .def("lnActivityConstants", &ChemicalProperties::lnActivityConstants, py::return_value_policy::reference_internal)
         .def("lnActivities", &ChemicalProperties::lnActivities, py::return_value_policy::reference_internal)
@@ -80,6 +80,15 @@ void exportChemicalProperties(py::module& m)
         .def("subvolume", &ChemicalProperties::subvolume)
         .def("fluidVolume", &ChemicalProperties::fluidVolume)
         .def("solidVolume", &ChemicalProperties::solidVolume)
+        .def("phaseMassValues", &ChemicalProperties::phaseMassValues, py::return_value_policy::reference_internal)
+        .def("phaseAmountValues", &ChemicalProperties::phaseAmountValues, py::return_value_policy::reference_internal)
+        .def("phaseMolarVolumeValues", &ChemicalProperties::phaseMolarVolumeValues, py::return_value_policy::reference_internal)
+        .def("phaseVolumeValues", &ChemicalProperties::phaseVolumeValues, py::return_value_policy::reference_internal)
+        .def("phaseDensityValues", &ChemicalProperties::phaseDensityValues)
+        .def("volumeValue", &ChemicalProperties::volumeValue)
+        .def("subvolumeValue", &ChemicalProperties::subvolumeValue)
+        .def("fluidVolumeValue", &ChemicalProperties::fluidVolumeValue)
+        .def("solidVolumeValue", &ChemicalProperties::solidVolumeValue)
         ;
 }
 
@@ -0,0 +1,71 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateBatch.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+
+auto ChemicalStateBatch_setitem(ChemicalStateBatch& self, Index i, const ChemicalState& state) -> void
+{
+    self.set(i, state);
+}
+
+auto ChemicalStateBatch_getitem(const ChemicalStateBatch& self, Index i) -> ChemicalState
+{
+    return self.state(i);
+}
+
+void exportChemicalStateBatch(py::module& m)
+{
+    auto set1 = static_cast<void(ChemicalStateBatch::*)(const ChemicalState&)>(&ChemicalStateBatch::set);
+    auto set2 = static_cast<void(ChemicalStateBatch::*)(Index, const ChemicalState&)>(&ChemicalStateBatch::set);
+
+    auto temperatures = static_cast<VectorRef(ChemicalStateBatch::*)()>(&ChemicalStateBatch::temperatures);
+    auto pressures = static_cast<VectorRef(ChemicalStateBatch::*)()>(&ChemicalStateBatch::pressures);
+    auto speciesAmounts = static_cast<MatrixRef(ChemicalStateBatch::*)()>(&ChemicalStateBatch::speciesAmounts);
+    auto elementDualPotentials = static_cast<MatrixRef(ChemicalStateBatch::*)()>(&ChemicalStateBatch::elementDualPotentials);
+    auto speciesDualPotentials = static_cast<MatrixRef(ChemicalStateBatch::*)()>(&ChemicalStateBatch::speciesDualPotentials);
+
+    py::class_<ChemicalStateBatch>(m, "ChemicalStateBatch")
+        .def(py::init<>())
+        .def(py::init<Index, const ChemicalSystem&>())
+        .def(py::init<Index, const ChemicalState&>())
+        .def("size", &ChemicalStateBatch::size)
+        .def("system", &ChemicalStateBatch::system, py::return_value_policy::reference_internal)
+        .def("set", set1)
+        .def("set", set2)
+        .def("get", &ChemicalStateBatch::get)
+        .def("state", &ChemicalStateBatch::state)
+        .def("temperatures", temperatures, py::return_value_policy::reference_internal)
+        .def("pressures", pressures, py::return_value_policy::reference_internal)
+        .def("speciesAmounts", speciesAmounts, py::return_value_policy::reference_internal)
+        .def("elementDualPotentials", elementDualPotentials, py::return_value_policy::reference_internal)
+        .def("speciesDualPotentials", speciesDualPotentials, py::return_value_policy::reference_internal)
+        .def("elementAmounts", &ChemicalStateBatch::elementAmounts)
+        .def("elementAmountsInSpecies", &ChemicalStateBatch::elementAmountsInSpecies)
+        .def("__len__", &ChemicalStateBatch::size)
+        .def("__setitem__", ChemicalStateBatch_setitem)
+        .def("__getitem__", ChemicalStateBatch_getitem)
+        ;
+}
+
+} // namespace Reaktoro
@@ -38,12 +38,14 @@ void exportReaction(py::module& m)
         .def("setName", &Reaction::setName)
         .def("setEquilibriumConstant", &Reaction::setEquilibriumConstant)
         .def("setRate", &Reaction::setRate)
+        .def("setRateSpecies", &Reaction::setRateSpecies)
         .def("name", &Reaction::name)
         .def("equilibriumConstant", &Reaction::equilibriumConstant, py::return_value_policy::reference_internal)
         .def("equation", &Reaction::equation, py::return_value_policy::reference_internal)
         .def("system", &Reaction::system, py::return_value_policy::reference_internal)
         .def("species", &Reaction::species, py::return_value_policy::reference_internal)
         .def("indices", &Reaction::indices, py::return_value_policy::reference_internal)
+        .def("rateSpecies", &Reaction::rateSpecies, py::return_value_policy::reference_internal)
         .def("stoichiometries", &Reaction::stoichiometries, py::return_value_policy::reference_internal)
         .def("stoichiometry", &Reaction::stoichiometry)
         .def("lnEquilibriumConstant", &Reaction::lnEquilibriumConstant)
@@ -0,0 +1,51 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateBatch.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Kinetics/KineticField.hpp>
+#include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
+
+namespace Reaktoro {
+
+void exportKineticField(py::module& m)
+{
+    auto solve1 = static_cast<void(KineticField::*)(ChemicalField&, double, double)>(&KineticField::solve);
+    auto solve2 = static_cast<void(KineticField::*)(VectorConstRef, VectorConstRef, VectorRef, double, double)>(&KineticField::solve);
+    auto solve3 = static_cast<void(KineticField::*)(ChemicalStateBatch&, double, double)>(&KineticField::solve);
+
+    py::class_<KineticField>(m, "KineticField")
+        .def(py::init<const ReactionSystem&, Index>())
+        .def("setOptions", &KineticField::setOptions)
+        .def("setPartition", &KineticField::setPartition)
+        .def("numCells", &KineticField::numCells)
+        .def("solve", solve1)
+        .def("solve", solve2)
+        .def("solve", solve3)
+        .def("state", &KineticField::state, py::return_value_policy::reference_internal)
+        .def("result", &KineticField::result, py::return_value_policy::reference_internal)
+        ;
+}
+
+} // namespace Reaktoro
@@ -34,6 +34,7 @@ void exportKineticOptions(py::module& m)
         .def_readwrite("equilibrium", &KineticOptions::equilibrium)
         .def_readwrite("ode", &KineticOptions::ode)
         .def_readwrite("output", &KineticOptions::output)
+        .def_readwrite("use_smart_equilibrium", &KineticOptions::use_smart_equilibrium)
         ;
 }
 
@@ -0,0 +1,36 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Kinetics/KineticResult.hpp>
+
+namespace Reaktoro {
+
+void exportKineticResult(py::module& m)
+{
+    py::class_<KineticResult>(m, "KineticResult")
+        .def(py::init<>())
+        .def_readwrite("num_function_evaluations", &KineticResult::num_function_evaluations)
+        .def_readwrite("num_smart_equilibrium_accepted", &KineticResult::num_smart_equilibrium_accepted)
+        .def_readwrite("num_equilibrium_calculations", &KineticResult::num_equilibrium_calculations)
+        .def_readwrite("num_equilibrium_coldstarts", &KineticResult::num_equilibrium_coldstarts)
+        ;
+}
+
+} // namespace Reaktoro
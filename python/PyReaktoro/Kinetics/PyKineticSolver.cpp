@@ -22,6 +22,7 @@
 #include <Reaktoro/Core/ReactionSystem.hpp>
 #include <Reaktoro/Core/Partition.hpp>
 #include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticResult.hpp>
 #include <Reaktoro/Kinetics/KineticSolver.hpp>
 
 namespace Reaktoro {
@@ -43,6 +44,7 @@ void exportKineticSolver(py::module& m)
         .def("step", step1)
         .def("step", step2)
         .def("solve", &KineticSolver::solve)
+        .def("result", &KineticSolver::result, py::return_value_policy::reference_internal)
         ;
 }
 
@@ -34,6 +34,12 @@ void exportODE(py::module& m)
         .value("Newton", ODEIterationMode::Newton)
         ;
 
+    py::enum_<ODELinearSolverMode>(m, "ODELinearSolverMode")
+        .value("Dense", ODELinearSolverMode::Dense)
+        .value("Band", ODELinearSolverMode::Band)
+        .value("SPGMR", ODELinearSolverMode::SPGMR)
+        ;
+
     py::class_<ODEOptions>(m, "ODEOptions")
         .def(py::init<>())
         .def_readwrite("step", &ODEOptions::step)
@@ -53,6 +59,10 @@ void exportODE(py::module& m)
         .def_readwrite("max_num_convergence_failures", &ODEOptions::max_num_convergence_failures)
         .def_readwrite("nonlinear_convergence_coefficient", &ODEOptions::nonlinear_convergence_coefficient)
         .def_readwrite("abstols", &ODEOptions::abstols)
+        .def_readwrite("linear_solver", &ODEOptions::linear_solver)
+        .def_readwrite("band_upper", &ODEOptions::band_upper)
+        .def_readwrite("band_lower", &ODEOptions::band_lower)
+        .def_readwrite("krylov_max_dimension", &ODEOptions::krylov_max_dimension)
         ;
 
 //
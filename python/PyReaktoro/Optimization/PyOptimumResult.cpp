@@ -35,6 +35,8 @@ void exportOptimumResult(py::module& m)
         .def_readwrite("time_objective_evals", &OptimumResult::time_objective_evals)
         .def_readwrite("time_constraint_evals", &OptimumResult::time_constraint_evals)
         .def_readwrite("time_linear_systems", &OptimumResult::time_linear_systems)
+        .def_readwrite("num_kkt_decompositions", &OptimumResult::num_kkt_decompositions)
+        .def_readwrite("num_kkt_refinements", &OptimumResult::num_kkt_refinements)
         ;
 }
 
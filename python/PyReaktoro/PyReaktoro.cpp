@@ -40,6 +40,7 @@ extern void exportChemicalProperties(py::module& m);
 extern void exportChemicalProperty(py::module& m);
 extern void exportChemicalQuantity(py::module& m);
 extern void exportChemicalState(py::module& m);
+extern void exportChemicalStateBatch(py::module& m);
 extern void exportChemicalSystem(py::module& m);
 extern void exportConnectivity(py::module& m);
 extern void exportElement(py::module& m);
@@ -73,8 +74,10 @@ extern void exportPhreeqcEditor(py::module& m);
 extern void exportInterpreter(py::module& m);
 
 // Kinetics module
+extern void exportKineticField(py::module& m);
 extern void exportKineticOptions(py::module& m);
 extern void exportKineticPath(py::module& m);
+extern void exportKineticResult(py::module& m);
 extern void exportKineticSolver(py::module& m);
 
 // Math module
@@ -112,7 +115,9 @@ extern void exportThermoDataProperties(py::module& m);
 // Transport module
 extern void exportChemicalField(py::module& m);
 extern void exportMesh(py::module& m);
+extern void exportGrid(py::module& m);
 extern void exportTransportSolver(py::module& m);
+extern void exportGridTransportSolver(py::module& m);
 extern void exportReactiveTransportSolver(py::module& m);
 
 } // namespace Reaktoro
@@ -140,6 +145,7 @@ PYBIND11_MODULE(PyReaktoro, m)
     exportChemicalProperty(m);
     exportChemicalQuantity(m);
     exportChemicalState(m);
+    exportChemicalStateBatch(m);
     exportChemicalSystem(m);
     exportConnectivity(m);
     exportElement(m);
@@ -174,7 +180,9 @@ PYBIND11_MODULE(PyReaktoro, m)
 
     // Kinetics module
     exportKineticOptions(m);
+    exportKineticField(m);
     exportKineticPath(m);
+    exportKineticResult(m);
     exportKineticSolver(m);
 
     // Math module
@@ -212,6 +220,8 @@ PYBIND11_MODULE(PyReaktoro, m)
     // Transport module
     exportChemicalField(m);
     exportMesh(m);
+    exportGrid(m);
     exportTransportSolver(m);
+    exportGridTransportSolver(m);
     exportReactiveTransportSolver(m);
 }
@@ -48,19 +48,20 @@ void exportDatabase(py::module& m)
         .def(py::init<>())
         .def(py::init<std::string>())
         .def(py::init<const ThermoFun::Database&>())
+        .def("save", &Database::save)
         .def("elements", &Database::elements)
 		.def("addElement", &Database::addElement)
         .def("aqueousSpecies", aqueousSpecies1)
-        .def("aqueousSpecies", aqueousSpecies2, py::return_value_policy::reference_internal)
+        .def("aqueousSpecies", aqueousSpecies2, py::return_value_policy::reference_internal, py::call_guard<py::gil_scoped_release>())
 		.def("addAqueousSpecies", &Database::addAqueousSpecies)
         .def("gaseousSpecies", gaseousSpecies1)
-        .def("gaseousSpecies", gaseousSpecies2, py::return_value_policy::reference_internal)
+        .def("gaseousSpecies", gaseousSpecies2, py::return_value_policy::reference_internal, py::call_guard<py::gil_scoped_release>())
 		.def("addGaseousSpecies", &Database::addGaseousSpecies)
         .def("liquidSpecies", liquidSpecies1)
-        .def("liquidSpecies", liquidSpecies2, py::return_value_policy::reference_internal)
+        .def("liquidSpecies", liquidSpecies2, py::return_value_policy::reference_internal, py::call_guard<py::gil_scoped_release>())
         .def("addLiquidSpecies", &Database::addLiquidSpecies)
         .def("mineralSpecies", mineralSpecies1)
-        .def("mineralSpecies", mineralSpecies2, py::return_value_policy::reference_internal)
+        .def("mineralSpecies", mineralSpecies2, py::return_value_policy::reference_internal, py::call_guard<py::gil_scoped_release>())
 		.def("addMineralSpecies", &Database::addMineralSpecies)
         .def("containsAqueousSpecies", &Database::containsAqueousSpecies)
         .def("containsGaseousSpecies", &Database::containsGaseousSpecies)
@@ -0,0 +1,63 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/GridTransportSolver.hpp>
+
+namespace Reaktoro {
+
+void exportGrid(py::module& m)
+{
+    py::class_<Grid>(m, "Grid")
+        .def(py::init<>())
+        .def(py::init<Index, Index, Index, double, double, double>(), py::arg("nx"), py::arg("ny") = 1, py::arg("nz") = 1, py::arg("lx") = 1.0, py::arg("ly") = 1.0, py::arg("lz") = 1.0)
+        .def("setDiscretization", &Grid::setDiscretization, py::arg("nx"), py::arg("ny") = 1, py::arg("nz") = 1, py::arg("lx") = 1.0, py::arg("ly") = 1.0, py::arg("lz") = 1.0)
+        .def("numCells", &Grid::numCells)
+        .def("numCellsX", &Grid::numCellsX)
+        .def("numCellsY", &Grid::numCellsY)
+        .def("numCellsZ", &Grid::numCellsZ)
+        .def("dx", &Grid::dx)
+        .def("dy", &Grid::dy)
+        .def("dz", &Grid::dz)
+        .def("index", &Grid::index, py::arg("i"), py::arg("j") = 0, py::arg("k") = 0)
+        ;
+}
+
+void exportGridTransportSolver(py::module& m)
+{
+    auto step1 = static_cast<void(GridTransportSolver::*)(MatrixRef, MatrixConstRef)>(&GridTransportSolver::step);
+    auto step2 = static_cast<void(GridTransportSolver::*)(MatrixRef)>(&GridTransportSolver::step);
+
+    py::class_<GridTransportSolver>(m, "GridTransportSolver")
+        .def(py::init<>())
+        .def("setGrid", &GridTransportSolver::setGrid)
+        .def("setVelocity", &GridTransportSolver::setVelocity, py::arg("vx"), py::arg("vy") = 0.0, py::arg("vz") = 0.0)
+        .def("setDiffusionCoeff", &GridTransportSolver::setDiffusionCoeff)
+        .def("setBoundaryValue", &GridTransportSolver::setBoundaryValue)
+        .def("setBoundaryValues", &GridTransportSolver::setBoundaryValues)
+        .def("setTimeStep", &GridTransportSolver::setTimeStep)
+        .def("timeStep", &GridTransportSolver::timeStep)
+        .def("grid", &GridTransportSolver::grid, py::return_value_policy::reference_internal)
+        .def("initialize", &GridTransportSolver::initialize)
+        .def("step", step1)
+        .def("step", step2)
+        ;
+}
+
+} // namespace Reaktoro
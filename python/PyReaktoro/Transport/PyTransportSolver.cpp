@@ -19,7 +19,11 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateBatch.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Kinetics/KineticOptions.hpp>
 #include <Reaktoro/Transport/TransportSolver.hpp>
 
 namespace Reaktoro {
@@ -76,6 +80,7 @@ void exportTransportSolver(py::module& m)
         .def("setDiffusionCoeff", &TransportSolver::setDiffusionCoeff)
         .def("setBoundaryValue", &TransportSolver::setBoundaryValue)
         .def("setTimeStep", &TransportSolver::setTimeStep)
+        .def("timeStep", &TransportSolver::timeStep)
         .def("mesh", &TransportSolver::mesh, py::return_value_policy::reference_internal)
         .def("initialize", &TransportSolver::initialize)
         .def("step", step1)
@@ -85,17 +90,31 @@ void exportTransportSolver(py::module& m)
 
 void exportReactiveTransportSolver(py::module& m)
 {
+    auto initialize1 = static_cast<void(ReactiveTransportSolver::*)(const ChemicalField&)>(&ReactiveTransportSolver::initialize);
+    auto initialize2 = static_cast<void(ReactiveTransportSolver::*)(const ChemicalStateBatch&)>(&ReactiveTransportSolver::initialize);
+
+    auto step1 = static_cast<void(ReactiveTransportSolver::*)(ChemicalField&)>(&ReactiveTransportSolver::step);
+    auto step2 = static_cast<void(ReactiveTransportSolver::*)(ChemicalStateBatch&)>(&ReactiveTransportSolver::step);
+
     py::class_<ReactiveTransportSolver>(m, "ReactiveTransportSolver")
         .def(py::init<const ChemicalSystem&>())
+        .def(py::init<const ReactionSystem&>())
         .def("setMesh", &ReactiveTransportSolver::setMesh)
-        .def("setVelocity", &ReactiveTransportSolver::setVelocity)
+        .def("setGrid", &ReactiveTransportSolver::setGrid)
+        .def("setVelocity", &ReactiveTransportSolver::setVelocity, py::arg("vx"), py::arg("vy") = 0.0, py::arg("vz") = 0.0)
         .def("setDiffusionCoeff", &ReactiveTransportSolver::setDiffusionCoeff)
         .def("setBoundaryState", &ReactiveTransportSolver::setBoundaryState)
         .def("setTimeStep", &ReactiveTransportSolver::setTimeStep)
+        .def("setPartition", &ReactiveTransportSolver::setPartition)
+        .def("setKineticOptions", &ReactiveTransportSolver::setKineticOptions)
+        .def("setSkipTolerance", &ReactiveTransportSolver::setSkipTolerance, py::arg("reltol"), py::arg("abstol") = 1e-14)
         .def("system", &ReactiveTransportSolver::system, py::return_value_policy::reference_internal)
+        .def("numSkippedCells", &ReactiveTransportSolver::numSkippedCells)
         .def("output", &ReactiveTransportSolver::output)
-        .def("initialize", &ReactiveTransportSolver::initialize)
-        .def("step", &ReactiveTransportSolver::step)
+        .def("initialize", initialize1)
+        .def("initialize", initialize2)
+        .def("step", step1)
+        .def("step", step2)
         ;
 }
 
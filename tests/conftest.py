@@ -11,6 +11,8 @@ from reaktoro import (
     Partition,
     EquilibriumProblem,
     EquilibriumInverseProblem,
+    ReactionSystem,
+    equilibrate,
     isUsingOpenlibm,
 )
 
@@ -378,3 +380,118 @@ def chemical_properties(chemical_system):
     n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
 
     return chemical_system.properties(T, P, n)
+
+
+@pytest.fixture
+def kinetic_state_with_h2o_hcl_calcite():
+    """
+    Build a chemical state with 1 kg of H2O, 1 mmol of HCl and 100 g of
+    calcite, which dissolves according to a kinetic reaction
+    """
+    editor = ChemicalEditor()
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3")
+    editor.addMineralPhase("Calcite")
+
+    reaction = editor.addMineralReaction("Calcite")
+    reaction.setEquation("Calcite = Ca++ + CO3--")
+    reaction.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    reaction.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    reaction.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite"])
+
+    problem = EquilibriumProblem(system)
+    problem.setPartition(partition)
+    problem.add("H2O", 1, "kg")
+    problem.add("HCl", 1, "mmol")
+
+    state = equilibrate(problem)
+    state.setSpeciesMass("Calcite", 100, "g")
+
+    return (reactions, partition, state)
+
+
+@pytest.fixture(scope="function")
+def kinetic_state_with_h2o_hcl_co2_gas_calcite():
+    """
+    Build a chemical state with 1 kg of H2O, 1 mmol of HCl, 1 mol of CO2 and
+    100 g of calcite, which dissolves according to a kinetic reaction, and an
+    inflow state with 1 kg of H2O and 10 mmol of HCl
+    """
+    editor = ChemicalEditor()
+    editor.addAqueousPhaseWithElementsOf("H2O HCl CaCO3")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Calcite")
+
+    reaction = editor.addMineralReaction("Calcite")
+    reaction.setEquation("Calcite = Ca++ + CO3--")
+    reaction.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    reaction.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    reaction.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite"])
+
+    problem = EquilibriumProblem(system)
+    problem.setPartition(partition)
+    problem.add("H2O", 1, "kg")
+    problem.add("HCl", 1, "mmol")
+    problem.add("CO2", 1, "mol")
+
+    state = equilibrate(problem)
+    state.setSpeciesMass("Calcite", 100, "g")
+
+    inflow_problem = EquilibriumProblem(system)
+    inflow_problem.setPartition(partition)
+    inflow_problem.add("H2O", 1, "kg")
+    inflow_problem.add("HCl", 10, "mmol")
+
+    inflow = equilibrate(inflow_problem)
+    inflow.setSpeciesAmount("Calcite", 0.0)
+
+    return (reactions, partition, state, inflow)
+
+
+@pytest.fixture(scope="function")
+def brine_calcite_reactions_and_states():
+    """
+    Build the reactions of a system with a brine, a gaseous phase and calcite,
+    which dissolves according to a kinetic reaction, and a function that
+    returns an equilibrium state at a given temperature and pressure, with a
+    tenth of its CO2(aq), so that calcite is not in equilibrium
+    """
+    editor = ChemicalEditor()
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCO3 CO2")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Calcite")
+
+    reaction = editor.addMineralReaction("Calcite")
+    reaction.setEquation("Calcite = Ca++ + CO3--")
+    reaction.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    reaction.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    reaction.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    problem = EquilibriumProblem(system)
+    problem.add("H2O", 1, "kg")
+    problem.add("NaCl", 0.5, "mol")
+    problem.add("CO2", 0.5, "mol")
+    problem.add("CaCO3", 1, "mol")
+
+    def equilibrium_state(T, P):
+        problem.setTemperature(T, "celsius")
+        problem.setPressure(P, "bar")
+        state = equilibrate(problem)
+        state.setSpeciesAmount("CO2(aq)", 0.1 * state.speciesAmount("CO2(aq)"))
+        return state
+
+    return (reactions, equilibrium_state)
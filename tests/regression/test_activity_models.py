@@ -0,0 +1,133 @@
+import numpy as np
+import pytest
+
+from reaktoro import ChemicalEditor, ChemicalSystem, Database
+
+
+"""
+These tests record the activity coefficients and the standard partial molar
+properties of an aqueous phase at a few temperatures, pressures and ionic
+strengths, so that any change in the evaluation of the aqueous activity models
+is checked against the values they produced before
+"""
+
+species = [
+    "H2O(l)",
+    "H+",
+    "OH-",
+    "Na+",
+    "Cl-",
+    "Ca++",
+    "Mg++",
+    "SO4--",
+    "HCO3-",
+    "CO3--",
+    "CO2(aq)",
+    "NaCl(aq)",
+    "CaSO4(aq)",
+]
+
+conditions = pytest.mark.parametrize(
+    "temperature, pressure, molality",
+    [
+        (298.15, 1.0e5, 0.1),
+        (348.15, 50.0e5, 1.0),
+        (423.15, 200.0e5, 3.0),
+    ],
+    ids=[
+        "298.15 K 1 bar 0.1 molal NaCl",
+        "348.15 K 50 bar 1 molal NaCl",
+        "423.15 K 200 bar 3 molal NaCl",
+    ],
+)
+
+tolerance = dict(atol=1e-16, rtol=1e-10)
+
+
+def aqueous_properties(model, temperature, pressure, molality):
+    """
+    Evaluate the chemical properties of an aqueous phase with 1 kg of H2O,
+    a given molality of NaCl and smaller amounts of CaCl2, MgSO4 and CO2
+    @param model
+        the name of the activity model, as in setChemicalModel<model>
+    """
+    editor = ChemicalEditor(Database("supcrt98.xml"))
+    aqueous = editor.addAqueousPhase(species)
+    getattr(aqueous, "setChemicalModel" + model)()
+
+    system = ChemicalSystem(editor)
+
+    m = molality
+    n = np.array([
+        55.508, 1.0e-6, 1.0e-8, m, 1.2*m, 0.1*m, 0.05*m,
+        0.05*m, 1.0e-3, 1.0e-5, 1.0e-2, 1.0e-3*m, 1.0e-4*m,
+    ])
+
+    return system.properties(temperature, pressure, n)
+
+
+def values_and_thermo_derivatives(properties):
+    ln_g = properties.lnActivityCoefficients()
+    ln_a = properties.lnActivities()
+    G0 = properties.standardPartialMolarGibbsEnergies()
+    V0 = properties.standardPartialMolarVolumes()
+
+    return {
+        "lnActivityCoefficients": np.asarray(ln_g.val),
+        "lnActivityCoefficients.ddT": np.asarray(ln_g.ddT),
+        "lnActivityCoefficients.ddP": np.asarray(ln_g.ddP),
+        "lnActivities": np.asarray(ln_a.val),
+        "standardPartialMolarGibbsEnergies": np.asarray(G0.val),
+        "standardPartialMolarGibbsEnergies.ddT": np.asarray(G0.ddT),
+        "standardPartialMolarVolumes": np.asarray(V0.val),
+    }
+
+
+def composition_derivatives(properties):
+    ln_g = properties.lnActivityCoefficients()
+    ddn = np.asarray(ln_g.ddn)
+
+    return {
+        "lnActivityCoefficients.ddn[{}]".format(name): ddn[:, j]
+        for j, name in enumerate(species)
+    }
+
+
+@conditions
+def test_pitzer_activity_coefficients(temperature, pressure, molality, num_regression):
+    properties = aqueous_properties("PitzerHMW", temperature, pressure, molality)
+
+    num_regression.check(
+        values_and_thermo_derivatives(properties),
+        default_tolerance=tolerance,
+    )
+
+
+@conditions
+def test_pitzer_activity_coefficients_composition_derivatives(temperature, pressure, molality, num_regression):
+    properties = aqueous_properties("PitzerHMW", temperature, pressure, molality)
+
+    num_regression.check(
+        composition_derivatives(properties),
+        default_tolerance=tolerance,
+    )
+
+
+@conditions
+def test_debye_huckel_activity_coefficients(temperature, pressure, molality, num_regression):
+    properties = aqueous_properties("DebyeHuckel", temperature, pressure, molality)
+
+    num_regression.check(
+        {**values_and_thermo_derivatives(properties), **composition_derivatives(properties)},
+        default_tolerance=tolerance,
+    )
+
+
+@conditions
+def test_hkf_activity_coefficients(temperature, pressure, molality, num_regression):
+    properties = aqueous_properties("HKF", temperature, pressure, molality)
+
+    num_regression.check(
+        {**values_and_thermo_derivatives(properties), **composition_derivatives(properties)},
+        default_tolerance=tolerance,
+    )
@@ -0,0 +1,34 @@
+from reaktoro import ChemicalOutput
+
+
+def test_chemical_output_columns(brine_calcite_reactions_and_states, file_regression, tmpdir):
+    """
+    Test that the columns of a ChemicalOutput file are those recorded when the
+    quantities were parsed from their names in every update, before they were
+    parsed once when the output is opened
+    """
+    reactions, equilibrium_state = brine_calcite_reactions_and_states
+
+    filepath = tmpdir / "test_chemical_output_columns.txt"
+
+    output = ChemicalOutput(reactions)
+    output.filename(str(filepath))
+    output.add("i")
+    output.add("t")
+    output.add("temperature(units=celsius)")
+    output.add("pressure(units=bar)")
+    output.add("pH")
+    output.add("ionicStrength")
+    output.add("speciesAmount(Ca++ units=mmol)")
+    output.add("elementMolality(C)")
+    output.add("phaseVolume(Calcite units=cm3)")
+    output.add("activity(CO2(aq))")
+    output.add("reactionRate(Calcite)")
+    output.open()
+
+    for i, (T, P) in enumerate([(25.0, 1.0), (60.0, 100.0), (90.0, 200.0)]):
+        output.update(equilibrium_state(T, P), 10.0 * i)
+
+    output.close()
+
+    file_regression.check(filepath.read_text("utf-8"))
@@ -306,3 +306,50 @@ def test_chemical_state_output_with_gaseous_phase_only(file_regression, tmpdir):
     filepath = tmpdir / 'test_chemical_state_output_with_gaseous_phase_only.txt'
     state.output(str(filepath), precision=17)
     file_regression.check(filepath.read_text('utf-8'))
+
+
+def test_chemical_state_copies_are_independent():
+    """Test that copies of a chemical state share nothing observable after being modified."""
+
+    editor = ChemicalEditor()
+    editor.addAqueousPhase("H2O(l) H+ OH- HCO3- CO2(aq) CO3--".split())
+    system = ChemicalSystem(editor)
+
+    state = ChemicalState(system)
+    state.setSpeciesAmounts(array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01]))
+
+    volume = state.properties().volume().val
+
+    copy = state.clone()
+    copy.setSpeciesAmount("H2O(l)", 110.0)
+    copy.setTemperature(350.0)
+
+    assert state.speciesAmount("H2O(l)") == approx(55.0)
+    assert state.temperature() == approx(298.15)
+    assert state.properties().volume().val == approx(volume)
+
+    assert copy.speciesAmount("H2O(l)") == approx(110.0)
+    assert copy.temperature() == approx(350.0)
+    assert copy.properties().volume().val > volume
+
+
+def test_chemical_state_properties_outlive_modifications():
+    """Test that the properties of a chemical state remain valid after the state is modified."""
+
+    editor = ChemicalEditor()
+    editor.addAqueousPhase("H2O(l) H+ OH- HCO3- CO2(aq) CO3--".split())
+    system = ChemicalSystem(editor)
+
+    state = ChemicalState(system)
+    state.setSpeciesAmounts(array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01]))
+
+    properties = state.properties()
+    volume = properties.volume().val
+
+    state.setTemperature(350.0)
+    state.setSpeciesAmount("H2O(l)", 110.0)
+
+    assert properties.temperature().val == approx(298.15)
+    assert properties.volume().val == approx(volume)
+    assert properties.phaseVolumeValues()[0] == approx(volume)
+    assert state.properties().volume().val > volume
@@ -0,0 +1,164 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Check the assertions also in release builds
+#undef NDEBUG
+
+// C++ includes
+#include <cassert>
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/BlockDiagonalChemicalVector.hpp>
+#include <Reaktoro/Math/BlockDiagonalMatrix.hpp>
+using namespace Reaktoro;
+
+// The number of species in each phase of the tests
+const Indices sizes = {3, 1, 4};
+
+// The number of species in all phases of the tests
+const Index num_species = 8;
+
+// Return a block-diagonal matrix with random entries in its diagonal blocks.
+auto randomBlockDiagonalMatrix() -> BlockDiagonalMatrix
+{
+    BlockDiagonalMatrix res(sizes);
+    res.data() = Vector::Random(res.data().size());
+    return res;
+}
+
+// Return the dense matrix with the diagonal blocks of a block-diagonal matrix, assembled one entry at a time.
+auto denseEquivalent(const BlockDiagonalMatrix& A) -> Matrix
+{
+    Matrix res = zeros(num_species, num_species);
+    Index offset = 0, start = 0;
+    for(Index size : sizes)
+    {
+        for(Index j = 0; j < size; ++j)
+            for(Index i = 0; i < size; ++i)
+                res(offset + i, offset + j) = A.data()[start + i + j*size];
+        offset += size;
+        start += size * size;
+    }
+    return res;
+}
+
+// Return the largest difference between the values and derivatives of two chemical vectors.
+template<typename V, typename T, typename P, typename N>
+auto difference(const ChemicalVectorBase<V,T,P,N>& a, const ChemicalVector& b) -> double
+{
+    return std::max({ norminf(a.val - b.val), norminf(a.ddT - b.ddT), norminf(a.ddP - b.ddP), norminf(a.ddn - b.ddn) });
+}
+
+// Return the largest difference between the values and derivatives of two chemical scalars.
+auto difference(const ChemicalScalar& a, const ChemicalScalar& b) -> double
+{
+    return std::max({ std::abs(a.val - b.val), std::abs(a.ddT - b.ddT), std::abs(a.ddP - b.ddP), norminf(a.ddn - b.ddn) });
+}
+
+// Test the views, rows and products of a block-diagonal matrix against its dense equivalent.
+auto testBlockDiagonalMatrix() -> void
+{
+    const BlockDiagonalMatrix A = randomBlockDiagonalMatrix();
+    const Matrix D = denseEquivalent(A);
+
+    assert(A.rows() == num_species);
+    assert(A.cols() == num_species);
+    assert(A.numBlocks() == sizes.size());
+
+    for(Index i = 0, offset = 0; i < sizes.size(); offset += sizes[i], ++i)
+    {
+        assert(A.blockSize(i) == sizes[i]);
+        assert(A.blockOffset(i) == offset);
+        assert(A.block(i) == D.block(offset, offset, sizes[i], sizes[i]));
+        for(Index irow = offset; irow < offset + sizes[i]; ++irow)
+            assert(A.indexBlockWithRow(irow) == i);
+    }
+
+    assert(A.block(4, 3) == D.block(4, 4, 3, 3));
+    assert(A.block(1, 2) == D.block(1, 1, 2, 2));
+
+    for(Index irow = 0; irow < num_species; ++irow)
+        assert(A.row(irow) == D.row(irow));
+
+    assert(A.diagonal() == D.diagonal());
+    assert(A.dense() == D);
+    assert(Matrix(A) == D);
+
+    const Indices irows = {5, 0, 2, 7, 3};
+    Matrix Dsub(irows.size(), irows.size());
+    for(Index i = 0; i < irows.size(); ++i)
+        for(Index j = 0; j < irows.size(); ++j)
+            Dsub(i, j) = D(irows[i], irows[j]);
+    assert(A.dense(irows) == Dsub);
+
+    const Vector x = Vector::Random(num_species);
+    assert(norminf(A*x - D*x) < 1e-15);
+
+    // Check that a mutable view of a submatrix writes into its diagonal block
+    BlockDiagonalMatrix B = A;
+    B.block(5, 2).setConstant(1.0);
+    Matrix E = D;
+    E.block(5, 5, 2, 2).setConstant(1.0);
+    assert(B.dense() == E);
+}
+
+// Test the views, rows and conversions of a block-diagonal chemical vector against its dense equivalent.
+auto testBlockDiagonalChemicalVector() -> void
+{
+    BlockDiagonalChemicalVector x(sizes);
+    x.val = Vector::Random(num_species);
+    x.ddT = Vector::Random(num_species);
+    x.ddP = Vector::Random(num_species);
+    x.ddn = randomBlockDiagonalMatrix();
+
+    const ChemicalVector d(x.val, x.ddT, x.ddP, denseEquivalent(x.ddn));
+
+    assert(x.size() == num_species);
+    assert(difference(x.dense(), d) == 0.0);
+
+    const ChemicalVector c = x;
+    assert(difference(c, d) == 0.0);
+
+    for(Index irow = 0; irow < num_species; ++irow)
+        assert(difference(x[irow], ChemicalScalar(d[irow])) == 0.0);
+
+    const BlockDiagonalChemicalVector& cx = x;
+    const ChemicalVectorConstRef b = cx.block(4, 3);
+    assert(difference(b, ChemicalVector(rows(d, 4, 4, 3, 3))) == 0.0);
+
+    assert(difference(rows(x, 1, 5), ChemicalVector(rows(d, 1, 5))) == 0.0);
+
+    const Indices irows = {6, 0, 3};
+    ChemicalVector expected(irows.size(), num_species);
+    for(Index i = 0; i < irows.size(); ++i)
+        row(expected, i) = d[irows[i]];
+    assert(difference(rows(x, irows), expected) == 0.0);
+
+    // Check that a mutable view of a range of species writes into the vector and its diagonal block
+    x.block(0, 3) = ChemicalVector(3, 3, 2.0);
+    ChemicalVector e = d;
+    rows(e, 0, 0, 3, 3) = ChemicalVector(3, 3, 2.0);
+    assert(difference(x.dense(), e) == 0.0);
+}
+
+int main()
+{
+    testBlockDiagonalMatrix();
+    testBlockDiagonalChemicalVector();
+    std::cout << "All tests of the block-diagonal matrix and chemical vector passed." << std::endl;
+}
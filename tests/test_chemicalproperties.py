@@ -19,7 +19,7 @@
 import pytest
 
 import numpy as np
-from reaktoro import ChemicalProperties, PhaseType
+from reaktoro import ChemicalProperties, ChemicalState, PhaseType
 
 
 def test_chemical_properties_subvolume(chemical_properties):
@@ -67,3 +67,50 @@ def test_chemical_properties_partial_volumes(chemical_system, chemical_propertie
     only_updated_by_temperature_and_pressure.update(chemical_properties.temperature().val, chemical_properties.pressure().val)
     for pVol in only_updated_by_temperature_and_pressure.partialMolarVolumes().val:
         assert pVol == 0.0
+
+
+def test_chemical_properties_phase_quantity_values(chemical_system, chemical_properties):
+    assert chemical_properties.phaseAmountValues() == pytest.approx(chemical_properties.phaseAmounts().val)
+    assert chemical_properties.phaseMassValues() == pytest.approx(chemical_properties.phaseMasses().val)
+    assert chemical_properties.phaseMolarVolumeValues() == pytest.approx(chemical_properties.phaseMolarVolumes().val)
+    assert chemical_properties.phaseVolumeValues() == pytest.approx(chemical_properties.phaseVolumes().val)
+    assert chemical_properties.phaseDensityValues() == pytest.approx(chemical_properties.phaseDensities().val)
+    assert chemical_properties.volumeValue() == pytest.approx(chemical_properties.volume().val)
+    assert chemical_properties.subvolumeValue([0]) == pytest.approx(chemical_properties.subvolume([0]).val)
+    assert chemical_properties.fluidVolumeValue() == pytest.approx(chemical_properties.fluidVolume().val)
+    assert chemical_properties.solidVolumeValue() == pytest.approx(chemical_properties.solidVolume().val)
+
+
+def test_chemical_properties_phase_quantities_updated(chemical_system):
+    n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    chemical_properties = ChemicalProperties(chemical_system)
+    chemical_properties.update(300.0, 1e5, n)
+    volume = chemical_properties.volumeValue()
+    phase_amounts = chemical_properties.phaseAmounts().val
+
+    chemical_properties.update(2*n)
+
+    assert chemical_properties.volumeValue() == pytest.approx(2*volume)
+    assert chemical_properties.phaseAmounts().val == pytest.approx(2*phase_amounts)
+
+
+def test_chemical_properties_copies_updated_independently(chemical_system):
+    n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    state = ChemicalState(chemical_system)
+    state.setTemperature(300.0)
+    state.setSpeciesAmounts(n)
+
+    # Both copies of the properties of the state share the phase quantities computed by either of them
+    first = state.properties()
+    second = state.properties()
+    volume = first.volumeValue()
+    phase_volumes = first.phaseVolumes().val
+
+    second.update(2*n)
+
+    assert second.volumeValue() == pytest.approx(2*volume)
+    assert first.volumeValue() == pytest.approx(volume)
+    assert first.phaseVolumes().val == pytest.approx(phase_volumes)
+    assert state.properties().volumeValue() == pytest.approx(volume)
@@ -0,0 +1,72 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+from reaktoro import *
+
+
+names = ["pH", "ionicStrength", "phaseVolume(Calcite)", "activity(CO2(aq))", "reactionRate(Calcite)"]
+
+
+def values(quantity):
+    return [quantity.value(name) for name in names]
+
+
+def test_chemical_quantity_update(brine_calcite_reactions_and_states):
+    """
+    Test that the values of a ChemicalQuantity instance are those of a new instance
+    after every update, so that the properties and rates computed on demand are
+    recomputed only after the state, temperature or pressure changes
+    """
+    reactions, equilibrium_state = brine_calcite_reactions_and_states
+
+    def new_values(state):
+        quantity = ChemicalQuantity(reactions)
+        quantity.update(state)
+        return values(quantity)
+
+    state = equilibrium_state(60.0, 100.0)
+
+    quantity = ChemicalQuantity(reactions)
+    quantity.update(state)
+
+    expected = values(quantity)
+    assert expected == new_values(state)
+
+    # The values are unchanged when evaluated again without an update
+    assert values(quantity) == expected
+
+    temperature = state.clone()
+    temperature.setTemperature(70.0, "celsius")
+
+    pressure = state.clone()
+    pressure.setPressure(150.0, "bar")
+
+    amounts = state.clone()
+    amounts.setSpeciesAmount("Ca++", 2.0 * state.speciesAmount("Ca++"))
+
+    for changed in [temperature, pressure, amounts]:
+        quantity.update(changed)
+        recomputed = values(quantity)
+        assert recomputed == new_values(changed)
+
+        # The pH, the activity of CO2(aq) and the rate of calcite depend on T, P and the amounts
+        assert recomputed[0] != expected[0]
+        assert recomputed[3] != expected[3]
+        assert recomputed[4] != expected[4]
+
+        quantity.update(state)
+        assert values(quantity) == expected
@@ -0,0 +1,68 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import numpy as np
+from pytest import approx
+from reaktoro import ChemicalState, ChemicalStateBatch
+
+
+def test_chemical_state_batch_set_and_get(chemical_system):
+    """Test that the chemical states of the cells are stored and retrieved unchanged."""
+
+    n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    state = ChemicalState(chemical_system)
+    state.setTemperature(350.0)
+    state.setPressure(2e5)
+    state.setSpeciesAmounts(n)
+
+    batch = ChemicalStateBatch(4, chemical_system)
+    batch[2] = state
+
+    assert len(batch) == 4
+    assert batch.temperatures() == approx([298.15, 298.15, 350.0, 298.15])
+    assert batch.pressures() == approx([1e5, 1e5, 2e5, 1e5])
+    assert batch.speciesAmounts()[:, 2] == approx(n)
+    assert batch.speciesAmounts()[:, 0] == approx(0.0)
+
+    other = batch[2]
+
+    assert other.temperature() == approx(350.0)
+    assert other.pressure() == approx(2e5)
+    assert other.speciesAmounts() == approx(n)
+
+
+def test_chemical_state_batch_element_amounts(chemical_system):
+    """Test that the element amounts of all cells match those calculated cell by cell."""
+
+    n = np.array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    state = ChemicalState(chemical_system)
+    state.setSpeciesAmounts(n)
+
+    batch = ChemicalStateBatch(3, state)
+    batch.speciesAmounts()[:, 1] *= 2.0
+
+    ifluid = chemical_system.indicesFluidSpecies()
+
+    b = batch.elementAmounts()
+    bf = batch.elementAmountsInSpecies(ifluid)
+
+    for i in range(3):
+        cell = batch[i]
+        assert b[:, i] == approx(cell.elementAmounts())
+        assert bf[:, i] == approx(cell.elementAmountsInSpecies(ifluid))
@@ -0,0 +1,180 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Check the assertions also in release builds
+#undef NDEBUG
+
+// C++ includes
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ChemicalScalar.hpp>
+#include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Common/ThermoScalar.hpp>
+#include <Reaktoro/Common/ThermoVector.hpp>
+using namespace Reaktoro;
+
+// The number of species in the tests
+const Index num_species = 6;
+
+// Return a chemical vector with random derivatives and values of given sign.
+auto randomChemicalVector(double sign) -> ChemicalVector
+{
+    const Vector val = sign * (1.0 + Vector::Random(num_species).array().abs());
+    return ChemicalVector(val, Vector::Random(num_species), Vector::Random(num_species), Matrix::Random(num_species, num_species));
+}
+
+// Return a thermo vector with random positive values and random derivatives.
+auto randomThermoVector() -> ThermoVector
+{
+    const Vector val = 1.0 + Vector::Random(num_species).array().abs();
+    return ThermoVector(val, Vector::Random(num_species), Vector::Random(num_species));
+}
+
+// Return a chemical vector whose values are the given ones and whose derivatives are the given ones scaled row by row.
+// This is the eager evaluation of a function `f` with values `f(x)` and derivatives `diag(f'(x)) * dx`.
+auto chainRule(VectorConstRef val, VectorConstRef dval, const ChemicalVector& x) -> ChemicalVector
+{
+    return ChemicalVector(val,
+        Vector(dval.array() * x.ddT.array()),
+        Vector(dval.array() * x.ddP.array()),
+        Matrix(dval.asDiagonal() * x.ddn));
+}
+
+// Return the eager evaluation of the quotient of two chemical vectors, one row at a time.
+auto quotient(const ChemicalVector& l, const ChemicalVector& r) -> ChemicalVector
+{
+    ChemicalVector res(num_species);
+    for(Index i = 0; i < num_species; ++i)
+    {
+        const double q = 1.0/(r.val[i] * r.val[i]);
+        res.val[i] = l.val[i]/r.val[i];
+        res.ddT[i] = q * (r.val[i] * l.ddT[i] - l.val[i] * r.ddT[i]);
+        res.ddP[i] = q * (r.val[i] * l.ddP[i] - l.val[i] * r.ddP[i]);
+        res.ddn.row(i) = q * (r.val[i] * l.ddn.row(i) - l.val[i] * r.ddn.row(i));
+    }
+    return res;
+}
+
+// Return the largest difference between the values and derivatives of two chemical vectors.
+auto difference(const ChemicalVector& a, const ChemicalVector& b) -> double
+{
+    return std::max({ norminf(a.val - b.val), norminf(a.ddT - b.ddT), norminf(a.ddP - b.ddP), norminf(a.ddn - b.ddn) });
+}
+
+// Return the largest difference between the values and derivatives of two thermo vectors.
+auto difference(const ThermoVector& a, const ThermoVector& b) -> double
+{
+    return std::max({ norminf(a.val - b.val), norminf(a.ddT - b.ddT), norminf(a.ddP - b.ddP) });
+}
+
+// Test that the lazy division operators agree with their eager evaluation.
+auto testDivision() -> void
+{
+    const ChemicalVector x = randomChemicalVector(1.0);
+    const ChemicalVector y = randomChemicalVector(-1.0);
+    const ThermoVector t = randomThermoVector();
+    const ChemicalScalar s(2.0, 0.3, -0.2, Vector::Random(num_species));
+    const ThermoScalar a(2.0, 0.3, -0.2);
+
+    const ChemicalVector ct(t.val, t.ddT, t.ddP, zeros(num_species, num_species));
+    const ChemicalVector cs(constants(num_species, s.val), constants(num_species, s.ddT), constants(num_species, s.ddP), s.ddn.replicate(num_species, 1));
+    const ChemicalVector ca(constants(num_species, a.val), constants(num_species, a.ddT), constants(num_species, a.ddP), zeros(num_species, num_species));
+
+    assert(difference(x/y, quotient(x, y)) < 1e-14);
+    assert(difference(x/t, quotient(x, ct)) < 1e-14);
+    assert(difference(x/s, quotient(x, cs)) < 1e-14);
+    assert(difference(x/a, quotient(x, ca)) < 1e-14);
+    assert(difference(x/2.0, quotient(x, ChemicalVector(num_species, num_species, 2.0))) < 1e-14);
+
+    const ThermoVector u = randomThermoVector();
+    const ThermoVector tu = t/u;
+    const ChemicalVector expected = quotient(ct, ChemicalVector(u.val, u.ddT, u.ddP, zeros(num_species, num_species)));
+    assert(difference(tu, ThermoVector(expected.val, expected.ddT, expected.ddP)) < 1e-14);
+}
+
+// Test that the lazy functions agree with their eager evaluation by the chain rule.
+auto testFunctions() -> void
+{
+    ChemicalVector x = randomChemicalVector(1.0);
+    x.val[1] = -x.val[1];
+
+    const ChemicalVector p = randomChemicalVector(1.0);
+    const Vector ones = constants(num_species, 1.0);
+
+    const Vector sign = x.val.array().sign();
+    assert(difference(abs(x), chainRule(x.val.array().abs(), sign, x)) < 1e-14);
+    assert(difference(sqrt(p), chainRule(p.val.array().sqrt(), 0.5/p.val.array().sqrt(), p)) < 1e-14);
+    assert(difference(log(p), chainRule(p.val.array().log(), ones.array()/p.val.array(), p)) < 1e-14);
+    assert(difference(log10(p), chainRule(p.val.array().log10(), 1.0/(std::log(10.0) * p.val.array()), p)) < 1e-14);
+    assert(difference(exp(x), chainRule(x.val.array().exp(), x.val.array().exp(), x)) < 1e-14);
+    assert(difference(pow(p, 2.5), chainRule(p.val.array().pow(2.5), 2.5 * p.val.array().pow(1.5), p)) < 1e-14);
+
+    const ThermoVector t = randomThermoVector();
+    const ChemicalVector ct(t.val, t.ddT, t.ddP, zeros(num_species, num_species));
+    const ChemicalVector expected = chainRule(t.val.array().log(), ones.array()/t.val.array(), ct);
+    assert(difference(log(t), ThermoVector(expected.val, expected.ddT, expected.ddP)) < 1e-14);
+}
+
+// Test that assigning an expression to one of its own operands gives the same result as assigning it to another instance.
+auto testAliasing() -> void
+{
+    const ChemicalVector x0 = randomChemicalVector(1.0);
+    const ChemicalVector y = randomChemicalVector(-1.0);
+    const ThermoVector t = randomThermoVector();
+    const ChemicalScalar s(2.0, 0.3, -0.2, Vector::Random(num_species));
+
+    ChemicalVector x;
+
+    x = x0; x = x/y;     assert(difference(x, ChemicalVector(x0/y)) == 0.0);
+    x = x0; x = y/x;     assert(difference(x, ChemicalVector(y/x0)) == 0.0);
+    x = x0; x = x/x;     assert(difference(x, ChemicalVector(x0/x0)) == 0.0);
+    x = x0; x = x/t;     assert(difference(x, ChemicalVector(x0/t)) == 0.0);
+    x = x0; x = x/s;     assert(difference(x, ChemicalVector(x0/s)) == 0.0);
+    x = x0; x = x % y;   assert(difference(x, ChemicalVector(x0 % y)) == 0.0);
+    x = x0; x = x * s;   assert(difference(x, ChemicalVector(x0 * s)) == 0.0);
+    x = x0; x = x + y;   assert(difference(x, ChemicalVector(x0 + y)) == 0.0);
+    x = x0; x = abs(x);  assert(difference(x, ChemicalVector(abs(x0))) == 0.0);
+    x = x0; x = sqrt(x); assert(difference(x, ChemicalVector(sqrt(x0))) == 0.0);
+    x = x0; x = log(x);  assert(difference(x, ChemicalVector(log(x0))) == 0.0);
+    x = x0; x = log10(x); assert(difference(x, ChemicalVector(log10(x0))) == 0.0);
+    x = x0; x = exp(x);  assert(difference(x, ChemicalVector(exp(x0))) == 0.0);
+    x = x0; x = pow(x, 2.5); assert(difference(x, ChemicalVector(pow(x0, 2.5))) == 0.0);
+
+    const ThermoVector t0 = randomThermoVector();
+    const ThermoVector u = randomThermoVector();
+
+    ThermoVector v;
+
+    v = t0; v = v/u;     assert(difference(v, ThermoVector(t0/u)) == 0.0);
+    v = t0; v = u/v;     assert(difference(v, ThermoVector(u/t0)) == 0.0);
+    v = t0; v = v % u;   assert(difference(v, ThermoVector(t0 % u)) == 0.0);
+    v = t0; v = abs(v);  assert(difference(v, ThermoVector(abs(t0))) == 0.0);
+    v = t0; v = sqrt(v); assert(difference(v, ThermoVector(sqrt(t0))) == 0.0);
+    v = t0; v = log(v);  assert(difference(v, ThermoVector(log(t0))) == 0.0);
+    v = t0; v = log10(v); assert(difference(v, ThermoVector(log10(t0))) == 0.0);
+}
+
+int main()
+{
+    testDivision();
+    testFunctions();
+    testAliasing();
+    std::cout << "All tests of the chemical vector expressions passed." << std::endl;
+}
@@ -0,0 +1,163 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Check the memory allocations of Eigen at runtime, also in release builds
+#define EIGEN_RUNTIME_NO_MALLOC
+#undef NDEBUG
+
+// C++ includes
+#include <cassert>
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ChemicalScalar.hpp>
+#include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Common/ThermoScalar.hpp>
+#include <Reaktoro/Common/ThermoVector.hpp>
+#include <Reaktoro/Thermodynamics/Models/AqueousChemicalModelDebyeHuckel.hpp>
+using namespace Reaktoro;
+
+// The number of species in the tests
+const int num_species = 8;
+
+// Evaluate a chain of chemical vector expressions that uses every operator and function.
+template<typename ChemicalVectorType, typename ChemicalScalarType, typename ThermoVectorType, typename VectorType>
+auto chain(const ChemicalVectorType& m, const ChemicalVectorType& x, const ThermoVectorType& t, const VectorType& z2, ThermoScalar A, ChemicalVectorType& res, ChemicalScalarType& s) -> void
+{
+    s = sum(m % m)/2.0;
+    const ChemicalScalarType sqrtI = sqrt(s);
+    res = A*(z2 % (sqrtI*x))/3.0 + x;
+    res += log(m) + exp(x/10.0) + sqrt(abs(m)) + pow(m, 1.3) + log10(m) - ThermoScalar(1.0);
+    res = res/m + x/sum(x) + m/t + res % m;
+    res += log(t) + exp(t/10.0) + (t + z2) % z2 - z2;
+    res[2] = res[3] * s + s/x[1] - exp(s) + log(s);
+    s = sum(res % x) + max(res) + min(x) + res[4] * 2.0;
+}
+
+// Return the largest difference between the values and derivatives of two chemical vectors.
+template<typename V, typename T, typename P, typename N>
+auto difference(const ChemicalVectorBase<V,T,P,N>& a, const ChemicalVector& b) -> double
+{
+    return std::max({
+        (a.val - b.val).template lpNorm<Eigen::Infinity>(),
+        (a.ddT - b.ddT).template lpNorm<Eigen::Infinity>(),
+        (a.ddP - b.ddP).template lpNorm<Eigen::Infinity>(),
+        (a.ddn - b.ddn).template lpNorm<Eigen::Infinity>() });
+}
+
+// Return the largest difference between the values and derivatives of two chemical scalars.
+template<typename V, typename N>
+auto difference(const ChemicalScalarBase<V,N>& a, const ChemicalScalar& b) -> double
+{
+    return std::max({ std::abs(a.val - b.val), std::abs(a.ddT - b.ddT), std::abs(a.ddP - b.ddP), (a.ddn - b.ddn).template lpNorm<Eigen::Infinity>() });
+}
+
+// Test that the fixed-size types give the same results as the dynamic ones without allocating memory.
+auto testChemicalVectorFixedArithmetic() -> void
+{
+    ChemicalVector m(num_species), x(num_species);
+    m.val = Vector::Random(num_species).cwiseAbs() + Vector::Constant(num_species, 0.5);
+    m.ddT = Vector::Random(num_species);
+    m.ddP = Vector::Random(num_species);
+    m.ddn = Matrix::Random(num_species, num_species);
+    x.val = Vector::Random(num_species).cwiseAbs() + Vector::Constant(num_species, 0.5);
+    x.ddT = Vector::Random(num_species);
+    x.ddP = Vector::Random(num_species);
+    x.ddn = Matrix::Random(num_species, num_species);
+
+    ThermoVector t(num_species);
+    t.val = Vector::Random(num_species).cwiseAbs() + Vector::Constant(num_species, 0.5);
+    t.ddT = Vector::Random(num_species);
+    t.ddP = Vector::Random(num_species);
+
+    const Vector z2 = Vector::Random(num_species).cwiseAbs();
+    const ThermoScalar A(0.5, 1e-3, 1e-5);
+
+    ChemicalVector res(num_species);
+    ChemicalScalar s(num_species);
+    chain(m, x, t, z2, A, res, s);
+
+    const ChemicalVectorFixed<num_species> mf = m, xf = x;
+    const ThermoVectorFixed<num_species> tf = t;
+    const VectorFixed<num_species> z2f = z2;
+    ChemicalVectorFixed<num_species> resf;
+    ChemicalScalarFixed<num_species> sf(num_species);
+
+    const ChemicalVectorFixed<Eigen::Dynamic, 16> mc = m, xc = x;
+    const ThermoVectorFixed<Eigen::Dynamic, 16> tc = t;
+    const VectorFixed<Eigen::Dynamic, 16> z2c = z2;
+    ChemicalVectorFixed<Eigen::Dynamic, 16> resc(num_species);
+    ChemicalScalarFixed<Eigen::Dynamic, 16> sc(num_species);
+
+    Eigen::internal::set_is_malloc_allowed(false);
+    chain(mf, xf, tf, z2f, A, resf, sf);
+    chain(mc, xc, tc, z2c, A, resc, sc);
+    Eigen::internal::set_is_malloc_allowed(true);
+
+    assert(difference(resf, res) < 1e-10 * res.val.lpNorm<Eigen::Infinity>());
+    assert(difference(resc, res) < 1e-10 * res.val.lpNorm<Eigen::Infinity>());
+    assert(difference(sf, s) < 1e-10 * std::abs(s.val));
+    assert(difference(sc, s) < 1e-10 * std::abs(s.val));
+}
+
+// Test that the Debye-Huckel kernel of ionic species gives the same results with fixed-size types without allocating memory.
+auto testAqueousChemicalModelDebyeHuckelIonsFixed() -> void
+{
+    ChemicalVector m(num_species);
+    m.val = 0.1 + 0.05*Vector::Random(num_species).array();
+    m.ddT = 1e-4*Vector::Random(num_species);
+    m.ddP = 1e-6*Vector::Random(num_species);
+    m.ddn = 0.01*Matrix::Random(num_species, num_species);
+
+    Vector z2(num_species), aions(num_species), bions(num_species);
+    z2 << 1, 1, 4, 4, 1, 9, 1, 4;
+    aions << 4.08, 3.63, 5.0, 5.5, 9.0, 9.0, 0.0, 5.4;
+    bions << 0.082, 0.017, 0.165, 0.2, 0.0, 0.0, 0.0, -0.04;
+
+    const ThermoScalar A(0.5114, 8.6e-4, 1e-9);
+    const ThermoScalar B(0.3288, 1.6e-4, 1e-10);
+
+    const ChemicalScalar I = 0.5 * sum(z2 % m);
+    ChemicalVector lng(num_species);
+    ChemicalScalar Sigma(num_species);
+    aqueousChemicalModelDebyeHuckelIons(I, A, B, z2, aions, bions, lng, Sigma);
+
+    const ChemicalVectorFixed<num_species> mf = m;
+    const VectorFixed<num_species> z2f = z2, aionsf = aions, bionsf = bions;
+    ChemicalVectorFixed<num_species> lngf;
+    ChemicalScalarFixed<num_species> Sigmaf(num_species);
+
+    Eigen::internal::set_is_malloc_allowed(false);
+    const ChemicalScalarFixed<num_species> If = 0.5 * sum(z2f % mf);
+    aqueousChemicalModelDebyeHuckelIons(If, A, B, z2f, aionsf, bionsf, lngf, Sigmaf);
+    Eigen::internal::set_is_malloc_allowed(true);
+
+    assert(difference(lngf, lng) < 1e-13);
+    assert(difference(Sigmaf, Sigma) < 1e-13);
+
+    // Check the ln activity coefficients against the modified Debye-Huckel equation
+    const double sqrtI = std::sqrt(I.val);
+    for(Index i = 0; i < num_species; ++i)
+        assert(std::abs(lngf.val[i] - std::log(10) * (-A.val*z2[i]*sqrtI/(1.0 + B.val*aions[i]*sqrtI) + bions[i]*I.val)) < 1e-13);
+}
+
+int main()
+{
+    testChemicalVectorFixedArithmetic();
+    testAqueousChemicalModelDebyeHuckelIonsFixed();
+    std::cout << "All tests of the fixed-size chemical vectors passed." << std::endl;
+}
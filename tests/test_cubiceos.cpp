@@ -0,0 +1,205 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Check the assertions also in release builds
+#undef NDEBUG
+
+// C++ includes
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Thermodynamics/EOS/CubicEOS.hpp>
+using namespace Reaktoro;
+
+// The number of species of the CO2-H2O-CH4 mixture in the tests
+const unsigned num_species = 3;
+
+// The pressure of the mixture in the tests (in units of Pa)
+const double pressure = 100e5;
+
+// Return the binary interaction parameters of the mixture, which depend linearly on temperature.
+auto interactionParams(const CubicEOS::InteractionParamsArgs& args) -> CubicEOS::InteractionParamsResult
+{
+    const double k0[num_species][num_species] = {{0.0, 0.19, 0.10}, {0.19, 0.0, 0.48}, {0.10, 0.48, 0.0}};
+    const double k1[num_species][num_species] = {{0.0, 5e-4, 0.0}, {5e-4, 0.0, 1e-3}, {0.0, 1e-3, 0.0}};
+
+    CubicEOS::InteractionParamsResult res;
+    res.k = table2D<ThermoScalar>(num_species, num_species);
+    res.kT = table2D<ThermoScalar>(num_species, num_species);
+    res.kTT = table2D<ThermoScalar>(num_species, num_species);
+    for(unsigned i = 0; i < num_species; ++i)
+    {
+        for(unsigned j = 0; j < num_species; ++j)
+        {
+            res.k[i][j] = k0[i][j] + k1[i][j] * (args.T - 298.15);
+            res.kT[i][j] = ThermoScalar(k1[i][j]);
+            res.kTT[i][j] = ThermoScalar(0.0);
+        }
+    }
+    return res;
+}
+
+// Return a Peng-Robinson equation of state of the mixture with the given interaction parameters function.
+auto createCubicEOS(bool isvapor, const CubicEOS::InteractionParamsFunction& func) -> CubicEOS
+{
+    CubicEOS eos(num_species, CubicEOS::Params{});
+    eos.setCriticalTemperatures({304.2, 647.1, 190.6});
+    eos.setCriticalPressures({73.83e5, 220.55e5, 45.99e5});
+    eos.setAcentricFactors({0.224, 0.344, 0.012});
+    eos.setInteractionParamsFunction(func);
+    if(isvapor) eos.setPhaseAsVapor();
+    else eos.setPhaseAsLiquid();
+    return eos;
+}
+
+// Return the mole fractions of the mixture, with their derivatives with respect to species amounts.
+auto moleFractions(double n0, double n1, double n2) -> ChemicalVector
+{
+    const Vector n = (Vector(num_species) << n0, n1, n2).finished();
+    const ChemicalVector nc = Composition(n);
+    return nc / sum(nc);
+}
+
+// Return the largest relative difference between the values and derivatives of two chemical scalars.
+auto difference(const ChemicalScalar& a, const ChemicalScalar& b) -> double
+{
+    const auto rel = [](double x, double y) { return std::abs(x - y) / std::max(std::abs(y), 1e-300); };
+    double res = std::max({rel(a.val, b.val), rel(a.ddT, b.ddT), rel(a.ddP, b.ddP)});
+    for(Index i = 0; i < a.ddn.size(); ++i)
+        res = std::max(res, std::abs(a.ddn[i] - b.ddn[i]) / std::max(b.ddn.cwiseAbs().maxCoeff(), 1e-300));
+    return res;
+}
+
+// Return the largest relative difference between the values and derivatives of two chemical vectors.
+auto difference(const ChemicalVector& a, const ChemicalVector& b) -> double
+{
+    double res = 0.0;
+    for(Index i = 0; i < a.size(); ++i)
+        res = std::max(res, difference(ChemicalScalar(a[i]), ChemicalScalar(b[i])));
+    return res;
+}
+
+// Return the largest relative difference between all properties of two results of the equation of state.
+auto difference(const CubicEOS::Result& a, const CubicEOS::Result& b) -> double
+{
+    return std::max({
+        difference(a.molar_volume, b.molar_volume),
+        difference(a.residual_molar_gibbs_energy, b.residual_molar_gibbs_energy),
+        difference(a.residual_molar_enthalpy, b.residual_molar_enthalpy),
+        difference(a.residual_molar_heat_capacity_cp, b.residual_molar_heat_capacity_cp),
+        difference(a.residual_molar_heat_capacity_cv, b.residual_molar_heat_capacity_cv),
+        difference(a.partial_molar_volumes, b.partial_molar_volumes),
+        difference(a.residual_partial_molar_gibbs_energies, b.residual_partial_molar_gibbs_energies),
+        difference(a.residual_partial_molar_enthalpies, b.residual_partial_molar_enthalpies),
+        difference(a.ln_fugacity_coefficients, b.ln_fugacity_coefficients),
+    });
+}
+
+// Return the result of the equation of state from a new instance, without any previously cached parameters.
+auto freshResult(bool isvapor, double T, const ChemicalVector& x) -> CubicEOS::Result
+{
+    CubicEOS eos = createCubicEOS(isvapor, interactionParams);
+    return eos(Temperature(T), Pressure(pressure), x);
+}
+
+// Test that the cached temperature-dependent parameters are recalculated whenever temperature changes.
+auto testTemperatureChange(bool isvapor) -> void
+{
+    unsigned num_calls = 0;
+    const auto counted = [&](const CubicEOS::InteractionParamsArgs& args)
+    {
+        ++num_calls;
+        return interactionParams(args);
+    };
+
+    CubicEOS eos = createCubicEOS(isvapor, counted);
+
+    const ChemicalVector x = isvapor ? moleFractions(0.80, 0.05, 0.15) : moleFractions(0.02, 0.97, 0.01);
+
+    const double temperatures[] = {323.15, 323.15, 373.15, 323.15};
+    const unsigned expected_calls[] = {1, 1, 2, 3};
+
+    for(unsigned k = 0; k < 4; ++k)
+    {
+        const CubicEOS::Result res = eos(Temperature(temperatures[k]), Pressure(pressure), x);
+        assert(num_calls == expected_calls[k]);
+        assert(difference(res, freshResult(isvapor, temperatures[k], x)) < 1e-12);
+    }
+
+    // Check that the kij-dependent results at the new temperature differ from those computed with kij frozen at the old one
+    const auto frozen = [](const CubicEOS::InteractionParamsArgs& args)
+    {
+        const CubicEOS::InteractionParamsArgs args0{Temperature(323.15), args.a, args.aT, args.aTT, args.b};
+        CubicEOS::InteractionParamsResult res = interactionParams(args0);
+        for(auto& row : res.kT) for(auto& kT : row) kT = ThermoScalar(0.0);
+        return res;
+    };
+
+    CubicEOS eos_frozen = createCubicEOS(isvapor, frozen);
+    const CubicEOS::Result res = eos(Temperature(373.15), Pressure(pressure), x);
+    const CubicEOS::Result res_frozen = eos_frozen(Temperature(373.15), Pressure(pressure), x);
+    assert(difference(res.ln_fugacity_coefficients, res_frozen.ln_fugacity_coefficients) > 1e-4);
+    assert(difference(res.residual_molar_gibbs_energy, res_frozen.residual_molar_gibbs_energy) > 1e-4);
+}
+
+// Test that the in-place and batch evaluations match the evaluation that returns a new result.
+auto testInPlaceAndBatch(bool isvapor) -> void
+{
+    CubicEOS eos = createCubicEOS(isvapor, interactionParams);
+
+    std::vector<ChemicalVector> xs;
+    if(isvapor)
+        for(double f : {0.1, 0.4, 0.7, 0.9})
+            xs.push_back(moleFractions(f, 0.03, 0.97 - f));
+    else
+        for(double f : {0.005, 0.01, 0.02, 0.03})
+            xs.push_back(moleFractions(f, 0.99 - f, 0.01));
+
+    for(double T : {323.15, 373.15})
+    {
+        std::vector<CubicEOS::Result> expected;
+        for(const ChemicalVector& x : xs)
+            expected.push_back(freshResult(isvapor, T, x));
+
+        CubicEOS::Result res(num_species);
+        for(Index i = 0; i < xs.size(); ++i)
+        {
+            eos(res, Temperature(T), Pressure(pressure), xs[i]);
+            assert(difference(res, expected[i]) < 1e-12);
+            assert(difference(eos(Temperature(T), Pressure(pressure), xs[i]), expected[i]) < 1e-12);
+        }
+
+        std::vector<CubicEOS::Result> batch;
+        eos(batch, Temperature(T), Pressure(pressure), xs);
+        assert(batch.size() == xs.size());
+        for(Index i = 0; i < xs.size(); ++i)
+            assert(difference(batch[i], expected[i]) < 1e-12);
+    }
+}
+
+int main()
+{
+    for(bool isvapor : {true, false})
+    {
+        testTemperatureChange(isvapor);
+        testInPlaceAndBatch(isvapor);
+    }
+    std::cout << "All tests of the cubic equation of state passed." << std::endl;
+}
@@ -0,0 +1,75 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+from reaktoro import *
+from pytest import approx
+from numpy import array, ones, zeros
+
+
+def test_grid():
+    """Test function for class Grid."""
+
+    grid = Grid(4, 3, 2, 1.0, 0.6, 0.2)
+
+    assert grid.numCells() == 24
+    assert grid.dx() == approx(0.25)
+    assert grid.dy() == approx(0.2)
+    assert grid.dz() == approx(0.1)
+    assert grid.index(1, 2, 1) == 1 + 4*(2 + 3*1)
+
+
+def test_grid_transport_solver_diffusion():
+    """Test that the diffusion on a 2D grid approaches the boundary values of each component."""
+
+    grid = Grid(8, 4, 1, 1.0, 0.5, 0.1)
+
+    solver = GridTransportSolver()
+    solver.setGrid(grid)
+    solver.setDiffusionCoeff(1e-3)
+    solver.setBoundaryValues(array([1.0, 2.0]))
+    solver.setTimeStep(100.0)
+
+    u = zeros((grid.numCells(), 2), order='F')
+
+    for i in range(200):
+        solver.step(u)
+
+    assert u[:, 0] == approx(1.0, rel=1e-6)
+    assert u[:, 1] == approx(2.0, rel=1e-6)
+
+
+def test_grid_transport_solver_advection():
+    """Test that the advection with a source on a 3D grid matches the upwind steady state along the x-axis."""
+
+    grid = Grid(10, 2, 2, 1.0, 1.0, 1.0)
+
+    solver = GridTransportSolver()
+    solver.setGrid(grid)
+    solver.setVelocity(1.0, 0.5, 0.5)
+    solver.setBoundaryValue(1.0)
+    solver.setTimeStep(0.1)
+
+    u = ones((grid.numCells(), 1), order='F')
+    q = ones((grid.numCells(), 1), order='F')
+
+    for i in range(500):
+        solver.step(u, q)
+
+    # The upwind steady state of du/dx = q/v with u = 1 at x = 0 is u = 1 + (i + 1)*dx on the i-th cell
+    expected = array([1.0 + (i % 10 + 1) * grid.dx() for i in range(grid.numCells())])
+
+    assert u[:, 0] == approx(expected)
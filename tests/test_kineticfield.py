@@ -0,0 +1,92 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+from reaktoro import *
+from numpy import full, tile
+from pytest import approx
+
+
+def test_kinetic_field_identical_cells(kinetic_state_with_h2o_hcl_calcite):
+    """Test that every cell of a field of identical cells is integrated as a single cell by a KineticSolver."""
+
+    reactions, partition, state = kinetic_state_with_h2o_hcl_calcite
+
+    ncells = 4
+    nspecies = reactions.system().numSpecies()
+
+    field = ChemicalField(ncells, state)
+    kinetic_field = KineticField(reactions, ncells)
+    kinetic_field.setPartition(partition)
+    assert kinetic_field.numCells() == ncells
+
+    T = full(ncells, state.temperature())
+    P = full(ncells, state.pressure())
+    n = tile(state.speciesAmounts(), ncells)
+    kinetic_field_arrays = KineticField(reactions, ncells)
+    kinetic_field_arrays.setPartition(partition)
+
+    expected = state.clone()
+    solver = KineticSolver(reactions)
+    solver.setPartition(partition)
+
+    t, dt = 0.0, 60.0
+    for i in range(3):
+        kinetic_field.solve(field, t, dt)
+        kinetic_field_arrays.solve(T, P, n, t, dt)
+        solver.solve(expected, t, dt)
+        t += dt
+
+    assert expected.speciesAmount('Calcite') < state.speciesAmount('Calcite')
+
+    for icell in range(ncells):
+        assert field[icell].speciesAmounts() == approx(expected.speciesAmounts(), rel=1e-10, abs=1e-16)
+        # The equilibrium calculations of the cells given by arrays start from another initial guess
+        assert n[icell*nspecies:(icell + 1)*nspecies] == approx(expected.speciesAmounts(), rel=1e-8, abs=1e-12)
+
+
+def test_kinetic_field_batch(kinetic_state_with_h2o_hcl_co2_gas_calcite):
+    """Test that the integration of a batch of chemical states gives the same results as that of a chemical field."""
+
+    reactions, partition, state, inflow = kinetic_state_with_h2o_hcl_co2_gas_calcite
+
+    ncells = 4
+
+    half = state.clone()
+    half.setSpeciesMass('Calcite', 50, 'g')
+
+    field = ChemicalField(ncells, state)
+    field[1] = half
+    field[2] = inflow
+    field_kinetics = KineticField(reactions, ncells)
+    field_kinetics.setPartition(partition)
+
+    batch = ChemicalStateBatch(ncells, state)
+    batch[1] = half
+    batch[2] = inflow
+    batch_kinetics = KineticField(reactions, ncells)
+    batch_kinetics.setPartition(partition)
+
+    t, dt = 0.0, 60.0
+    for i in range(3):
+        field_kinetics.solve(field, t, dt)
+        batch_kinetics.solve(batch, t, dt)
+        t += dt
+
+    for icell in range(ncells):
+        assert batch[icell].temperature() == field[icell].temperature()
+        assert batch[icell].pressure() == field[icell].pressure()
+        assert batch[icell].speciesAmounts() == approx(field[icell].speciesAmounts(), rel=1e-10, abs=1e-14)
@@ -0,0 +1,175 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+from reaktoro import *
+from pytest import approx
+
+
+def test_kinetic_solver_smart_equilibrium(kinetic_state_with_h2o_hcl_calcite):
+    """Test that smart equilibrium predictions replace most equilibrium calculations in a KineticSolver."""
+
+    reactions, partition, state = kinetic_state_with_h2o_hcl_calcite
+
+    options = KineticOptions()
+    options.use_smart_equilibrium = True
+
+    smart_solver = KineticSolver(reactions)
+    smart_solver.setPartition(partition)
+    smart_solver.setOptions(options)
+
+    solver = KineticSolver(reactions)
+    solver.setPartition(partition)
+
+    smart_state = state.clone()
+    expected = state.clone()
+
+    num_accepted = 0
+    num_calculations = 0
+    num_evaluations = 0
+
+    t, dt = 0.0, 60.0
+    for i in range(10):
+        smart_solver.solve(smart_state, t, dt)
+        solver.solve(expected, t, dt)
+        t += dt
+
+        result = smart_solver.result()
+        assert result.num_smart_equilibrium_accepted + result.num_equilibrium_calculations == result.num_function_evaluations
+        num_accepted += result.num_smart_equilibrium_accepted
+        num_calculations += result.num_equilibrium_calculations
+        num_evaluations += result.num_function_evaluations
+
+        assert solver.result().num_smart_equilibrium_accepted == 0
+        assert solver.result().num_equilibrium_calculations == solver.result().num_function_evaluations
+
+    assert num_accepted > num_calculations
+    assert num_evaluations > 0
+
+    assert smart_state.elementAmounts() == approx(state.elementAmounts(), rel=1e-12, abs=1e-15)
+
+    dissolved = state.speciesAmount('Calcite') - smart_state.speciesAmount('Calcite')
+    expected_dissolved = state.speciesAmount('Calcite') - expected.speciesAmount('Calcite')
+    assert dissolved == approx(expected_dissolved, rel=2e-2)
+    assert smart_state.speciesAmount('Ca++') == approx(expected.speciesAmount('Ca++'), rel=2e-2)
+
+
+def test_kinetic_solver_spgmr(kinetic_state_with_h2o_hcl_calcite):
+    """Test that the Krylov linear solver with the stoichiometric preconditioner agrees with the dense linear solver."""
+
+    reactions, partition, state = kinetic_state_with_h2o_hcl_calcite
+
+    options = KineticOptions()
+    options.ode.linear_solver = ODELinearSolverMode.SPGMR
+
+    spgmr_solver = KineticSolver(reactions)
+    spgmr_solver.setPartition(partition)
+    spgmr_solver.setOptions(options)
+
+    solver = KineticSolver(reactions)
+    solver.setPartition(partition)
+
+    spgmr_state = state.clone()
+    expected = state.clone()
+
+    t, dt = 0.0, 60.0
+    for i in range(10):
+        spgmr_solver.solve(spgmr_state, t, dt)
+        solver.solve(expected, t, dt)
+        t += dt
+
+    assert spgmr_state.elementAmounts() == approx(state.elementAmounts(), rel=1e-12, abs=1e-15)
+
+    # Both integrations satisfy the same ODE tolerances, not the same steps
+    dissolved = state.speciesAmount('Calcite') - spgmr_state.speciesAmount('Calcite')
+    expected_dissolved = state.speciesAmount('Calcite') - expected.speciesAmount('Calcite')
+    assert dissolved == approx(expected_dissolved, rel=5e-3)
+    assert spgmr_state.speciesAmount('Ca++') == approx(expected.speciesAmount('Ca++'), rel=5e-3)
+
+
+def solve_with_sources(reactions, partition, state, add_sources):
+    """Return the state after 5 kinetic steps of 60 s with the sources and sinks added by a given function."""
+    solver = KineticSolver(reactions)
+    solver.setPartition(partition)
+    add_sources(solver)
+
+    state = state.clone()
+
+    t, dt = 0.0, 60.0
+    for i in range(5):
+        solver.solve(state, t, dt)
+        t += dt
+
+    return state
+
+
+def test_kinetic_solver_sources_and_sinks(kinetic_state_with_h2o_hcl_co2_gas_calcite):
+    """Test the sources and sinks of a KineticSolver, with values recorded when each source was a chained closure."""
+
+    reactions, partition, state, inflow = kinetic_state_with_h2o_hcl_co2_gas_calcite
+
+    def add_two_sources(solver):
+        solver.addSource(inflow, 1e-6, "m3/s")
+        solver.addSource(inflow, 1e-6, "m3/s")
+
+    def add_one_source(solver):
+        solver.addSource(inflow, 2e-6, "m3/s")
+
+    def add_source_and_fluid_sink(solver):
+        solver.addSource(inflow, 1e-6, "m3/s")
+        solver.addFluidSink(1e-6, "m3/s")
+
+    def add_solid_sink(solver):
+        solver.addSolidSink(1e-9, "m3/s")
+
+    two_sources = solve_with_sources(reactions, partition, state, add_two_sources)
+    one_source = solve_with_sources(reactions, partition, state, add_one_source)
+
+    assert two_sources.speciesAmounts() == approx(one_source.speciesAmounts(), rel=1e-10, abs=1e-16)
+    assert two_sources.elementAmount("Cl") == approx(0.00698101348445541, rel=1e-8)
+    assert two_sources.speciesAmount("Calcite") == approx(0.99574204780707, rel=1e-8)
+
+    source_and_fluid_sink = solve_with_sources(reactions, partition, state, add_source_and_fluid_sink)
+
+    assert source_and_fluid_sink.elementAmount("Cl") == approx(0.00396000432662688, rel=1e-8)
+    assert source_and_fluid_sink.elementAmount("H") == approx(142.708365598651, rel=1e-8)
+    assert source_and_fluid_sink.speciesAmount("Calcite") == approx(0.997096496273743, rel=1e-8)
+
+    solid_sink = solve_with_sources(reactions, partition, state, add_solid_sink)
+
+    assert solid_sink.elementAmount("Cl") == approx(state.elementAmount("Cl"), rel=1e-12)
+    assert solid_sink.elementAmount("Ca") == approx(0.9910091574403, rel=1e-8)
+    assert solid_sink.speciesAmount("Calcite") == approx(0.990040597980995, rel=1e-8)
+
+
+def test_kinetic_solver_phase_sink(kinetic_state_with_h2o_hcl_co2_gas_calcite):
+    """Test that a phase sink removes only the species of its phase, also for phases after the first one."""
+
+    reactions, partition, state, inflow = kinetic_state_with_h2o_hcl_co2_gas_calcite
+
+    gaseous_sink = solve_with_sources(reactions, partition, state, lambda solver: solver.addPhaseSink("Gaseous", 1e-6, "m3/s"))
+
+    # The gaseous species contain neither Ca nor Cl
+    assert gaseous_sink.elementAmount("Ca") == approx(state.elementAmount("Ca"), rel=1e-12)
+    assert gaseous_sink.elementAmount("Cl") == approx(state.elementAmount("Cl"), rel=1e-12)
+    assert gaseous_sink.elementAmount("C") < state.elementAmount("C")
+
+    aqueous_sink = solve_with_sources(reactions, partition, state, lambda solver: solver.addPhaseSink("Aqueous", 1e-6, "m3/s"))
+
+    # Only the aqueous species contain Cl
+    assert aqueous_sink.elementAmount("Cl") < state.elementAmount("Cl")
+    assert aqueous_sink.elementAmount("H") < state.elementAmount("H")
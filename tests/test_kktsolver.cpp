@@ -0,0 +1,178 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Check the assertions also in release builds
+#undef NDEBUG
+
+// C++ includes
+#include <cassert>
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Optimization/KktSolver.hpp>
+using namespace Reaktoro;
+
+// The number of primal variables and equality constraints of the KKT equations in the tests
+const Index num_variables = 10;
+const Index num_constraints = 3;
+
+// The data of a KKT equation that is kept alive while it is decomposed and solved
+struct KktProblem
+{
+    Hessian H;
+    Matrix A;
+    Vector x;
+    Vector z;
+    KktVector rhs;
+};
+
+// Return a KKT problem with a Hessian in given mode and positive primal and dual variables.
+auto kktProblem(Hessian::Mode mode) -> KktProblem
+{
+    KktProblem problem;
+    const Matrix B = Matrix::Random(num_variables, num_variables);
+    problem.H.mode = mode;
+    problem.H.dense = B*tr(B) + num_variables*identity(num_variables, num_variables);
+    problem.H.diagonal = problem.H.dense.diagonal();
+    problem.A = Matrix::Random(num_constraints, num_variables);
+    problem.x = 1.0 + Vector::Random(num_variables).cwiseAbs().array();
+    problem.z = 1e-2 * (1.0 + Vector::Random(num_variables).cwiseAbs().array());
+    problem.rhs.rx = Vector::Random(num_variables);
+    problem.rhs.ry = Vector::Random(num_constraints);
+    problem.rhs.rz = Vector::Random(num_variables);
+    return problem;
+}
+
+// Return a KKT problem whose matrix is a perturbation of another one, with relative changes of given size.
+auto perturbed(const KktProblem& problem, double size) -> KktProblem
+{
+    KktProblem other = problem;
+    other.H.dense.diagonal().array() *= 1.0 + size * Vector::Random(num_variables).array();
+    other.H.diagonal = other.H.dense.diagonal();
+    other.x.array() *= 1.0 + size * Vector::Random(num_variables).array();
+    other.z.array() *= 1.0 + size * Vector::Random(num_variables).array();
+    other.rhs.rx = Vector::Random(num_variables);
+    other.rhs.ry = Vector::Random(num_constraints);
+    other.rhs.rz = Vector::Random(num_variables);
+    return other;
+}
+
+// Return the KKT matrix of a KKT problem.
+auto kktMatrix(const KktProblem& problem) -> KktMatrix
+{
+    return KktMatrix(problem.H, problem.A, problem.x, problem.z);
+}
+
+// Return the solution of a KKT problem with a new decomposition of its matrix.
+auto solve(const KktProblem& problem, KktMethod method) -> KktSolution
+{
+    KktOptions options;
+    options.method = method;
+
+    KktSolver solver;
+    solver.setOptions(options);
+    solver.decompose(kktMatrix(problem));
+
+    KktSolution sol;
+    solver.solve(problem.rhs, sol);
+    return sol;
+}
+
+// Return the largest difference between two solutions of a KKT equation, relative to the largest entry of the second one.
+auto difference(const KktSolution& a, const KktSolution& b) -> double
+{
+    const double scale = std::max({ norminf(b.dx), norminf(b.dy), norminf(b.dz) });
+    return std::max({ norminf(a.dx - b.dx), norminf(a.dy - b.dy), norminf(a.dz - b.dz) }) / scale;
+}
+
+// Test that the solutions with a reused decomposition agree with those with a new decomposition.
+auto testKktSolverReuseDecomposition(Hessian::Mode mode, KktMethod method) -> void
+{
+    KktOptions options;
+    options.method = method;
+    options.reuse_decomposition = true;
+
+    KktSolver solver;
+    solver.setOptions(options);
+
+    const KktProblem first = kktProblem(mode);
+    KktSolution sol;
+
+    solver.decompose(kktMatrix(first));
+    solver.solve(first.rhs, sol);
+    assert(solver.result().succeeded);
+    assert(solver.result().num_decompositions == 1);
+    assert(difference(sol, solve(first, method)) < 1e-14);
+
+    // The KKT equations of a slightly different matrix are solved by refinement with the first decomposition
+    const KktProblem second = perturbed(first, 1e-3);
+
+    solver.decompose(kktMatrix(second));
+    solver.solve(second.rhs, sol);
+    assert(solver.result().succeeded);
+    assert(solver.result().num_decompositions == 0);
+    assert(solver.result().num_refinement_iterations > 0);
+    assert(solver.result().num_refinement_iterations <= options.max_refinement_iterations);
+    assert(difference(sol, solve(second, method)) < 1e3 * options.refinement_tolerance);
+}
+
+// Test that the KKT matrix is decomposed again when the refinement does not converge within the maximum number of iterations.
+auto testKktSolverReuseDecompositionFallback(Hessian::Mode mode, KktMethod method) -> void
+{
+    KktOptions options;
+    options.method = method;
+    options.reuse_decomposition = true;
+    options.max_refinement_iterations = 1;
+
+    KktSolver solver;
+    solver.setOptions(options);
+
+    const KktProblem first = kktProblem(mode);
+    KktSolution sol;
+
+    solver.decompose(kktMatrix(first));
+    solver.solve(first.rhs, sol);
+
+    // The refinement of a very different matrix with the first decomposition stops after one iteration
+    const KktProblem second = perturbed(first, 0.5);
+
+    solver.decompose(kktMatrix(second));
+    solver.solve(second.rhs, sol);
+    assert(solver.result().succeeded);
+    assert(solver.result().num_decompositions == 1);
+    assert(solver.result().num_refinement_iterations <= options.max_refinement_iterations);
+    assert(difference(sol, solve(second, method)) < 1e-14);
+
+    // The new decomposition is reused for the next KKT equations with the same matrix
+    KktProblem third = second;
+    third.rhs.rx = Vector::Random(num_variables);
+
+    solver.decompose(kktMatrix(third));
+    solver.solve(third.rhs, sol);
+    assert(solver.result().num_decompositions == 0);
+    assert(difference(sol, solve(third, method)) < 1e3 * options.refinement_tolerance);
+}
+
+int main()
+{
+    testKktSolverReuseDecomposition(Hessian::Dense, KktMethod::PartialPivLU);
+    testKktSolverReuseDecomposition(Hessian::Dense, KktMethod::FullPivLU);
+    testKktSolverReuseDecomposition(Hessian::Diagonal, KktMethod::Rangespace);
+    testKktSolverReuseDecompositionFallback(Hessian::Dense, KktMethod::PartialPivLU);
+    testKktSolverReuseDecompositionFallback(Hessian::Diagonal, KktMethod::Rangespace);
+    std::cout << "All tests of the reuse of KKT decompositions passed." << std::endl;
+}
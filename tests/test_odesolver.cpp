@@ -0,0 +1,225 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Check the assertions also in release builds
+#undef NDEBUG
+
+// C++ includes
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/Eigenvalues>
+#include <Reaktoro/deps/eigen3/Eigen/LU>
+
+// Reaktoro includes
+#include <Reaktoro/Math/ODE.hpp>
+using namespace Reaktoro;
+
+// The number of equations of the discretized diffusion problem in the tests
+const unsigned num_equations = 20;
+
+// The final time of the integrations in the tests
+const double tfinal = 0.5;
+
+// Return the tridiagonal matrix of the diffusion problem `dy/dt = A*y` with zero boundary values.
+auto diffusionMatrix() -> Matrix
+{
+    const double kappa = 10.0;
+    Matrix A = zeros(num_equations, num_equations);
+    for(unsigned i = 0; i < num_equations; ++i)
+    {
+        A(i, i) = -2.0 * kappa;
+        if(i > 0) A(i, i - 1) = kappa;
+        if(i + 1 < num_equations) A(i, i + 1) = kappa;
+    }
+    return A;
+}
+
+// Return the initial values of the diffusion problem, a bump in the middle of the domain.
+auto initialValues() -> Vector
+{
+    Vector y0 = zeros(num_equations);
+    y0.segment(num_equations/2 - 2, 4).fill(1.0);
+    return y0;
+}
+
+// Return the exact solution of the diffusion problem at time `t` from the eigen decomposition of its matrix.
+auto exactSolution(double t) -> Vector
+{
+    Eigen::SelfAdjointEigenSolver<Matrix> eigen(diffusionMatrix());
+    const Matrix& V = eigen.eigenvectors();
+    const Vector exp_lambda_t = (eigen.eigenvalues() * t).array().exp();
+    return V * exp_lambda_t.asDiagonal() * tr(V) * initialValues();
+}
+
+// Return the ODE problem of the diffusion problem, with or without its Jacobian.
+auto diffusionProblem(bool with_jacobian) -> ODEProblem
+{
+    const Matrix A = diffusionMatrix();
+
+    ODEProblem problem;
+    problem.setNumEquations(num_equations);
+    problem.setFunction([=](double t, VectorConstRef y, VectorRef f) { f.noalias() = A*y; return 0; });
+    if(with_jacobian)
+        problem.setJacobian([=](double t, VectorConstRef y, MatrixRef J) { J = A; return 0; });
+    return problem;
+}
+
+// Return the options of the ODE solver with tight tolerances and a given linear solver.
+auto odeOptions(ODELinearSolverMode mode) -> ODEOptions
+{
+    ODEOptions options;
+    options.reltol = 1e-10;
+    options.abstol = 1e-12;
+    options.max_num_steps = 10000;
+    options.linear_solver = mode;
+    options.band_upper = 1;
+    options.band_lower = 1;
+    return options;
+}
+
+// Return the solution of the diffusion problem at the final time with a given solver.
+auto integrate(ODESolver& solver) -> Vector
+{
+    double t = 0.0;
+    Vector y = initialValues();
+    solver.initialize(t, y);
+    solver.solve(t, tfinal, y);
+    return y;
+}
+
+// Return the largest difference between two vectors, relative to the largest entry of the second one.
+auto difference(VectorConstRef a, VectorConstRef b) -> double
+{
+    return norminf(a - b) / norminf(b);
+}
+
+// Test that the banded linear solver gives the same solution as the dense one, with and without a Jacobian.
+auto testODESolverBand(bool with_jacobian) -> void
+{
+    const Vector exact = exactSolution(tfinal);
+
+    ODESolver dense;
+    dense.setOptions(odeOptions(ODELinearSolverMode::Dense));
+    dense.setProblem(diffusionProblem(with_jacobian));
+
+    ODESolver band;
+    band.setOptions(odeOptions(ODELinearSolverMode::Band));
+    band.setProblem(diffusionProblem(with_jacobian));
+
+    const Vector ydense = integrate(dense);
+    const Vector yband = integrate(band);
+
+    assert(difference(ydense, exact) < 1e-8);
+    assert(difference(yband, exact) < 1e-8);
+    assert(difference(yband, ydense) < 1e-8);
+}
+
+// Test that initializing an ODESolver again reuses its CVODE context without changing the solution.
+auto testODESolverReinitialize(ODELinearSolverMode mode) -> void
+{
+    ODESolver solver;
+    solver.setOptions(odeOptions(mode));
+    solver.setProblem(diffusionProblem(true));
+
+    ODESolver fresh;
+    fresh.setOptions(odeOptions(mode));
+    fresh.setProblem(diffusionProblem(true));
+
+    const Vector first = integrate(solver);
+    const Vector second = integrate(solver);
+
+    assert(second == first);
+    assert(integrate(fresh) == first);
+}
+
+// Test that changing the linear solver between two initializations of an ODESolver takes effect.
+auto testODESolverChangeLinearSolver() -> void
+{
+    ODESolver solver;
+    solver.setOptions(odeOptions(ODELinearSolverMode::Dense));
+    solver.setProblem(diffusionProblem(true));
+    const Vector ydense = integrate(solver);
+
+    solver.setOptions(odeOptions(ODELinearSolverMode::Band));
+    const Vector yband = integrate(solver);
+
+    ODESolver band;
+    band.setOptions(odeOptions(ODELinearSolverMode::Band));
+    band.setProblem(diffusionProblem(true));
+
+    assert(yband == integrate(band));
+    assert(difference(yband, ydense) < 1e-8);
+}
+
+// Test that the Krylov linear solver gives the same solution as the dense one, with and without a preconditioner.
+auto testODESolverSPGMR(bool with_preconditioner) -> void
+{
+    const Matrix A = diffusionMatrix();
+    const Vector exact = exactSolution(tfinal);
+
+    // The preconditioner is the exact Newton matrix I - gamma*A, so that the Krylov iterations converge at once
+    Eigen::PartialPivLU<Matrix> lu;
+    Index num_setups = 0;
+    Index num_solves = 0;
+
+    ODEProblem problem = diffusionProblem(false);
+    if(with_preconditioner)
+        problem.setPreconditioner(
+            [&](double t, VectorConstRef y, bool jok, bool& jcur, double gamma)
+            {
+                lu.compute(identity(num_equations, num_equations) - gamma*A);
+                jcur = true;
+                ++num_setups;
+                return 0;
+            },
+            [&](double t, VectorConstRef y, VectorConstRef r, VectorRef z, double gamma)
+            {
+                z = lu.solve(r);
+                ++num_solves;
+                return 0;
+            });
+
+    ODESolver spgmr;
+    spgmr.setOptions(odeOptions(ODELinearSolverMode::SPGMR));
+    spgmr.setProblem(problem);
+
+    ODESolver dense;
+    dense.setOptions(odeOptions(ODELinearSolverMode::Dense));
+    dense.setProblem(diffusionProblem(true));
+
+    const Vector yspgmr = integrate(spgmr);
+
+    assert(difference(yspgmr, exact) < 1e-8);
+    assert(difference(yspgmr, integrate(dense)) < 1e-8);
+    assert(with_preconditioner == (num_setups > 0));
+    assert(with_preconditioner == (num_solves > 0));
+}
+
+int main()
+{
+    testODESolverBand(true);
+    testODESolverBand(false);
+    testODESolverReinitialize(ODELinearSolverMode::Dense);
+    testODESolverReinitialize(ODELinearSolverMode::Band);
+    testODESolverChangeLinearSolver();
+    testODESolverSPGMR(true);
+    testODESolverSPGMR(false);
+    std::cout << "All tests of the linear solvers of ODESolver passed." << std::endl;
+}
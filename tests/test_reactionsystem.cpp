@@ -0,0 +1,114 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Check the assertions also in release builds
+#undef NDEBUG
+
+// C++ includes
+#include <cassert>
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// Test that the sparse molar derivatives of the rates are those of the dense ones, for mineral and custom rates.
+auto testReactionSystemSparseRates() -> void
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCO3 MgCO3 SiO2");
+    editor.addGaseousPhase({"H2O(g)", "CO2(g)"});
+    editor.addMineralPhase("Calcite");
+    editor.addMineralPhase("Magnesite");
+    editor.addMineralPhase("Quartz");
+    editor.addMineralReaction("Calcite")
+        .setEquation("Calcite = Ca++ + CO3--")
+        .addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+        .addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0; p[CO2(g)] = 1.0")
+        .setSpecificSurfaceArea(10, "cm2/g");
+    editor.addMineralReaction("Magnesite")
+        .setEquation("Magnesite = Mg++ + CO3--")
+        .addMechanism("logk = -9.34 mol/(m2*s); Ea = 23.5 kJ/mol")
+        .setSpecificSurfaceArea(10, "cm2/g");
+
+    ChemicalSystem system(editor);
+
+    const Index num_species = system.numSpecies();
+    const Index ico2g = system.indexSpeciesWithError("CO2(g)");
+    const Index icalcite = system.indexSpeciesWithError("Calcite");
+
+    // A reaction whose custom rate depends on species in phases other than those of its reacting species
+    Reaction quartz(ReactionEquation("Quartz = SiO2(aq)"), system);
+    quartz.setRateSpecies({ico2g});
+    quartz.setRate([=](const ChemicalProperties& properties)
+    {
+        ChemicalScalar ncalcite(num_species, properties.composition().val[icalcite]);
+        ncalcite.ddn[icalcite] = 1.0;
+        return 1e-6 * exp(properties.lnActivities()[ico2g]) * ncalcite;
+    });
+
+    // Setting the rate function clears the rate species declared for the previous one
+    assert(quartz.rateSpecies().empty());
+
+    std::vector<Reaction> reactions = ReactionSystem(editor).reactions();
+    reactions.push_back(quartz);
+
+    ReactionSystem reactionsys(system, reactions);
+
+    EquilibriumProblem problem(system);
+    problem.add("H2O", 1, "kg");
+    problem.add("NaCl", 0.1, "mol");
+    problem.add("CO2", 0.5, "mol");
+
+    ChemicalState state = equilibrate(problem);
+    state.setSpeciesMass("Calcite", 100, "g");
+    state.setSpeciesMass("Magnesite", 50, "g");
+    state.setSpeciesAmount("Quartz", 1.0);
+
+    ThermoVector r;
+    SparseMatrix drdn;
+
+    for(double T : {298.15, 348.15})
+    {
+        state.setTemperature(T);
+
+        const ChemicalProperties properties = state.properties();
+        const ChemicalVector rates = reactionsys.rates(properties);
+
+        reactionsys.rates(properties, r, drdn);
+
+        assert(r.val == rates.val);
+        assert(r.ddT == rates.ddT);
+        assert(r.ddP == rates.ddP);
+        assert(Matrix(drdn) == rates.ddn);
+
+        // The derivatives of the custom rate w.r.t. the gaseous species and the calcite are stored
+        assert(rates.ddn(2, ico2g) != 0.0);
+        assert(rates.ddn(2, icalcite) != 0.0);
+    }
+
+    // The rates of the mineral reactions only depend on the species of a few phases, the custom rate on all species
+    for(Index i = 0; i < 2; ++i)
+        assert(Index(drdn.row(i).nonZeros()) < num_species);
+    assert(Index(drdn.row(2).nonZeros()) == num_species);
+}
+
+int main()
+{
+    testReactionSystemSparseRates();
+    std::cout << "All tests of the reaction system passed." << std::endl;
+}
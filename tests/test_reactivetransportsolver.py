@@ -0,0 +1,271 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import pytest
+
+from reaktoro import *
+from pytest import approx
+
+
+def equilibrium_state(system):
+    problem = EquilibriumProblem(system)
+    problem.add('H2O', 1.0, 'kg')
+    problem.add('NaCl', 0.1, 'mol')
+    problem.add('CaCO3', 1.0, 'mol')
+    return equilibrate(problem)
+
+
+def trace_mg_states():
+    """
+    Return a chemical system with quartz and calcite, an initial state, and a boundary state
+    that differs from the initial state mostly by a trace amount of Mg.
+    """
+    editor = ChemicalEditor()
+    editor.addAqueousPhaseWithElementsOf('H2O NaCl CaCl2 MgCl2 CO2')
+    editor.addMineralPhase('Quartz')
+    editor.addMineralPhase('Calcite')
+
+    system = ChemicalSystem(editor)
+
+    def state(mgcl2):
+        problem = EquilibriumProblem(system)
+        problem.setTemperature(60.0, 'celsius')
+        problem.setPressure(100.0, 'bar')
+        problem.add('H2O', 1.0, 'kg')
+        problem.add('NaCl', 0.7, 'mol')
+        problem.add('CaCO3', 10, 'mol')
+        problem.add('SiO2', 10, 'mol')
+        problem.add('MgCl2', mgcl2, 'mol')
+        return equilibrate(problem)
+
+    return system, state(0.0), state(1e-4)
+
+
+def assert_same_cells(field, batch):
+    """Assert that the cells of a chemical field and of a batch of chemical states are the same."""
+    assert len(batch) == field.size()
+    for i in range(len(batch)):
+        assert batch[i].temperature() == field[i].temperature()
+        assert batch[i].pressure() == field[i].pressure()
+        assert batch[i].speciesAmounts() == approx(field[i].speciesAmounts(), rel=1e-10, abs=1e-14)
+
+
+def reactive_transport_solver(system, state, ncells):
+    solver = ReactiveTransportSolver(system)
+    solver.setMesh(Mesh(ncells, 0.0, 1.0))
+    solver.setVelocity(0.0)
+    solver.setDiffusionCoeff(0.0)
+    solver.setBoundaryState(state)
+    solver.setTimeStep(1.0)
+    return solver
+
+
+def test_reactive_transport_solver_num_skipped_cells():
+    """Test that cells without transport are skipped after their first equilibrium calculation."""
+
+    editor = ChemicalEditor()
+    editor.addAqueousPhaseWithElementsOf('H2O NaCl CaCO3')
+    editor.addMineralPhase('Calcite')
+
+    system = ChemicalSystem(editor)
+    state = equilibrium_state(system)
+
+    ncells = 5
+
+    # Every cell is equilibrated in every step when the detection of unchanged cells is disabled
+    field = ChemicalField(ncells, state)
+    solver = reactive_transport_solver(system, state, ncells)
+    solver.initialize(field)
+
+    for i in range(3):
+        solver.step(field)
+        assert solver.numSkippedCells() == 0
+
+    # Every cell is equilibrated in the first step, and skipped afterwards since nothing is transported
+    field = ChemicalField(ncells, state)
+    solver = reactive_transport_solver(system, state, ncells)
+    solver.setSkipTolerance(1e-6)
+    solver.initialize(field)
+
+    solver.step(field)
+    assert solver.numSkippedCells() == 0
+
+    for i in range(2):
+        solver.step(field)
+        assert solver.numSkippedCells() == ncells
+
+
+def test_reactive_transport_solver_skip_tolerance():
+    """
+    Test that skipping unchanged cells does not change the results of a front of a trace element.
+    A small diffusion coefficient spreads the front, which is otherwise held back by the flux
+    limiter of the advection step when neighbouring cells have identical amounts.
+    """
+
+    system, state_ic, state_bc = trace_mg_states()
+
+    ncells = 20
+
+    def simulate(skiptol):
+        field = ChemicalField(ncells, state_ic)
+        solver = ReactiveTransportSolver(system)
+        solver.setMesh(Mesh(ncells, 0.0, 1.0))
+        solver.setVelocity(1.0)
+        solver.setDiffusionCoeff(1e-3)
+        solver.setBoundaryState(state_bc)
+        solver.setTimeStep(0.025)
+        if skiptol is not None:
+            solver.setSkipTolerance(skiptol)
+        solver.initialize(field)
+        skipped = []
+        for i in range(10):
+            solver.step(field)
+            skipped.append(solver.numSkippedCells())
+        return field, skipped
+
+    field0, skipped0 = simulate(None)
+    field1, skipped1 = simulate(1e-6)
+
+    assert max(skipped0) == 0
+
+    # The cells ahead of the front are skipped, and the cells the front reaches are equilibrated
+    assert skipped1[0] == 0
+    assert all(0 < skipped < ncells for skipped in skipped1[1:])
+
+    iMg = system.indexSpecies('Mg++')
+
+    for i in range(ncells):
+        assert field1[i].elementAmounts() == approx(field0[i].elementAmounts(), rel=1e-5, abs=1e-12)
+        assert field1[i].speciesAmount(iMg) == approx(field0[i].speciesAmount(iMg), rel=1e-5, abs=1e-12)
+
+
+def test_reactive_transport_solver_kinetics_without_transport(kinetic_state_with_h2o_hcl_calcite):
+    """Test that the split steps of kinetics and transport in a cell without transport integrate its kinetics only."""
+
+    reactions, partition, state = kinetic_state_with_h2o_hcl_calcite
+
+    dt = 60.0
+
+    field = ChemicalField(1, state)
+    solver = ReactiveTransportSolver(reactions)
+    solver.setPartition(partition)
+    solver.setMesh(Mesh(1, 0.0, 1.0))
+    solver.setVelocity(0.0)
+    solver.setDiffusionCoeff(0.0)
+    solver.setBoundaryState(state)
+    solver.setTimeStep(dt)
+    solver.initialize(field)
+
+    # The kinetics of the cell is integrated over two halves of each time step
+    halves = state.clone()
+    halves_solver = KineticSolver(reactions)
+    halves_solver.setPartition(partition)
+
+    # The kinetics of the cell is integrated over each time step at once
+    steps = state.clone()
+    steps_solver = KineticSolver(reactions)
+    steps_solver.setPartition(partition)
+
+    t = 0.0
+    for i in range(5):
+        solver.step(field)
+        halves_solver.solve(halves, t, 0.5*dt)
+        halves_solver.solve(halves, t + 0.5*dt, 0.5*dt)
+        steps_solver.solve(steps, t, dt)
+        t += dt
+
+    # The amounts of the elements are conserved
+    assert field[0].elementAmounts() == approx(state.elementAmounts(), rel=1e-12, abs=1e-15)
+
+    # The equilibrium calculation between the two halves of a step leaves the cell unchanged
+    assert field[0].speciesAmounts() == approx(halves.speciesAmounts(), rel=1e-8, abs=1e-14)
+
+    # The splitting error is within the accuracy of the integration of the kinetics
+    dissolved = state.speciesAmount('Calcite') - field[0].speciesAmount('Calcite')
+    assert dissolved > 0.0
+    assert dissolved == approx(state.speciesAmount('Calcite') - steps.speciesAmount('Calcite'), rel=1e-2)
+    assert field[0].speciesAmount('Ca++') == approx(steps.speciesAmount('Ca++'), rel=1e-2)
+
+
+@pytest.mark.parametrize("skiptol", [None, 1e-6], ids=["every cell equilibrated", "unchanged cells skipped"])
+def test_reactive_transport_solver_batch(skiptol):
+    """Test that the steps on a batch of chemical states give the same results as those on a chemical field."""
+
+    system, state_ic, state_bc = trace_mg_states()
+
+    ncells = 10
+
+    def solver():
+        solver = ReactiveTransportSolver(system)
+        solver.setMesh(Mesh(ncells, 0.0, 1.0))
+        solver.setVelocity(1.0)
+        solver.setDiffusionCoeff(1e-3)
+        solver.setBoundaryState(state_bc)
+        solver.setTimeStep(0.05)
+        if skiptol is not None:
+            solver.setSkipTolerance(skiptol)
+        return solver
+
+    field = ChemicalField(ncells, state_ic)
+    field_solver = solver()
+    field_solver.initialize(field)
+
+    batch = ChemicalStateBatch(ncells, state_ic)
+    batch_solver = solver()
+    batch_solver.initialize(batch)
+
+    for i in range(5):
+        field_solver.step(field)
+        batch_solver.step(batch)
+        assert batch_solver.numSkippedCells() == field_solver.numSkippedCells()
+
+    assert_same_cells(field, batch)
+
+
+def test_reactive_transport_solver_batch_kinetics(kinetic_state_with_h2o_hcl_co2_gas_calcite):
+    """Test that the steps with kinetics on a batch of chemical states give the same results as those on a chemical field."""
+
+    reactions, partition, state, inflow = kinetic_state_with_h2o_hcl_co2_gas_calcite
+
+    ncells = 4
+
+    def solver():
+        solver = ReactiveTransportSolver(reactions)
+        solver.setPartition(partition)
+        solver.setMesh(Mesh(ncells, 0.0, 1.0))
+        solver.setVelocity(1e-3)
+        solver.setDiffusionCoeff(0.0)
+        solver.setBoundaryState(inflow)
+        solver.setTimeStep(60.0)
+        return solver
+
+    field = ChemicalField(ncells, state)
+    field_solver = solver()
+    field_solver.initialize(field)
+
+    batch = ChemicalStateBatch(ncells, state)
+    batch_solver = solver()
+    batch_solver.initialize(batch)
+
+    for i in range(3):
+        field_solver.step(field)
+        batch_solver.step(batch)
+
+    # The calcite dissolves faster in the first cell, which receives the acidic inflow
+    assert field[0].speciesAmount('Calcite') < field[ncells - 1].speciesAmount('Calcite') < state.speciesAmount('Calcite')
+
+    assert_same_cells(field, batch)
@@ -0,0 +1,101 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import pytest
+
+from reaktoro import Converter, convert, convertible, converter
+
+
+unit_pairs = pytest.mark.parametrize(
+    "value, from_unit, to_unit, expected",
+    [
+        (2.5, "m", "cm", 250.0),
+        (2.5, "kg", "g", 2500.0),
+        (2.5, "mol/kg", "mmol/g", 2.5),
+        (2.5, "bar", "Pa", 2.5e5),
+        (2.5, "m3", "L", 2500.0),
+        (2.5, "J/mol", "kJ/mol", 2.5e-3),
+        (25.0, "degC", "K", 298.15),
+        (298.15, "K", "degC", 25.0),
+    ],
+)
+
+
+@unit_pairs
+def test_converter_matches_convert(value, from_unit, to_unit, expected):
+    assert Converter(from_unit, to_unit)(value) == convert(value, from_unit, to_unit)
+    assert converter(from_unit, to_unit)(value) == convert(value, from_unit, to_unit)
+    assert convert(value, from_unit, to_unit) == pytest.approx(expected, rel=1e-14)
+
+
+@unit_pairs
+def test_converter_cache_returns_same_conversion(value, from_unit, to_unit, expected):
+    first = converter(from_unit, to_unit)
+    second = converter(from_unit, to_unit)
+    fresh = Converter(from_unit, to_unit)
+
+    for c in [second, fresh]:
+        assert c.factor() == first.factor()
+        assert c.divisor() == first.divisor()
+        assert c.offset() == first.offset()
+
+
+def test_converter_default_and_explicit():
+    assert Converter()(3.0) == 3.0
+    assert Converter(9.0, 5.0, 32.0)(100.0) == pytest.approx(212.0)
+
+
+@pytest.mark.parametrize(
+    "from_unit, to_unit",
+    [
+        ("m", "foo"),
+        ("foo", "m"),
+        ("degC", "foo"),
+        ("kg(", "g"),
+    ],
+)
+def test_converter_unknown_units(from_unit, to_unit):
+    # Repeat the calls so that the errors are also raised once the cache has seen the pair
+    for _ in range(2):
+        with pytest.raises(RuntimeError, match=r"there is no such unit named"):
+            convertible(from_unit, to_unit)
+        with pytest.raises(RuntimeError, match=r"there is no such unit named"):
+            convert(1.0, from_unit, to_unit)
+        with pytest.raises(RuntimeError, match=r"there is no such unit named"):
+            converter(from_unit, to_unit)
+        with pytest.raises(RuntimeError, match=r"there is no such unit named"):
+            Converter(from_unit, to_unit)
+
+
+@pytest.mark.parametrize(
+    "from_unit, to_unit",
+    [
+        ("m", "kg"),
+        ("degC", "m"),
+        ("mol/kg", "mol/m3"),
+    ],
+)
+def test_converter_incompatible_units(from_unit, to_unit):
+    # The cache records that these pairs are not convertible, which must not
+    # turn the errors of the conversions into silent identity conversions
+    for _ in range(2):
+        assert not convertible(from_unit, to_unit)
+        with pytest.raises(RuntimeError, match=r"do not match"):
+            convert(1.0, from_unit, to_unit)
+        with pytest.raises(RuntimeError, match=r"do not match"):
+            converter(from_unit, to_unit)